@@ -177,6 +177,11 @@ extern "C" {
 */
 #include "dart_synchronization.h"
 
+/*
+   --- DART communication statistics ---
+*/
+#include "dart_stats.h"
+
 
 #ifdef __cplusplus
 } // extern "C"
@@ -29,6 +29,13 @@ extern "C" {
 /**
  * \name Collective operations
  * Collective operations involving all units of a given team.
+ *
+ * If the environment variable \c DART_HIER_COLLECTIVES is set to \c 1 in
+ * all units before \ref dart_init, barriers, broadcasts, allgather and
+ * commutative allreduce operations on small messages combine the data of
+ * units on the same node in shared memory first, see
+ * \ref dart_config_t::hier_collectives. Otherwise, the flat MPI
+ * collectives are used.
  */
 
 /** \{ */
@@ -46,6 +53,45 @@ extern "C" {
 dart_ret_t dart_barrier(
   dart_team_t team) DART_NOTHROW;
 
+/**
+ * Enter a split-phase barrier of the units in \c team that are located on
+ * the same node as the calling unit.
+ * The barrier is completed with \c dart_barrier_node_wait, the calling
+ * unit may perform local work in between.
+ *
+ * Must be called by all units in \c team. The first call of a node
+ * barrier or a hierarchical collective operation on a team is collective
+ * on all units in the team.
+ *
+ * \param team The team to perform a node-local barrier on.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \see dart_barrier_node_wait
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_barrier_node_arrive(
+  dart_team_t team) DART_NOTHROW;
+
+/**
+ * Complete a split-phase node-local barrier entered with
+ * \c dart_barrier_node_arrive. Returns once all units in \c team located
+ * on the same node as the calling unit have entered the barrier.
+ *
+ * \param team The team to perform a node-local barrier on.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \see dart_barrier_node_arrive
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_barrier_node_wait(
+  dart_team_t team) DART_NOTHROW;
+
 /**
  * DART Equivalent to MPI broadcast.
  *
@@ -210,6 +256,37 @@ dart_ret_t dart_alltoall(
   dart_datatype_t  dtype,
   dart_team_t      team) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI alltoallv.
+ *
+ * \param sendbuf     The buffer containing the data to be sent by each unit.
+ * \param nsendelem   Array containing the number of values to send to
+ *                    each unit.
+ * \param senddispls  Array containing the displacements of data sent to
+ *                    each unit in \c sendbuf.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nrecvelem   Array containing the number of values to receive from
+ *                    each unit.
+ * \param recvdispls  Array containing the displacements of data received
+ *                    from each unit in \c recvbuf.
+ * \param teamid      The team to participate in the alltoallv.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendelem,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_team_t       teamid) DART_NOTHROW;
+
 /**
  * DART Equivalent to MPI_Reduce.
  *
@@ -426,6 +503,79 @@ dart_ret_t dart_put(
   dart_datatype_t   src_type,
   dart_datatype_t   dst_type) DART_NOTHROW;
 
+/**
+ * Write-combining variant of dart_put for fine-grained updates.
+ * Copy data from local memory into memory referenced by a global pointer.
+ *
+ * Small puts to units that are not accessible in shared memory are
+ * collected in a buffer per target unit and segment and transferred in a
+ * single put with an indexed target data type once the buffer exceeds
+ * its capacity or on the next flush operation on the target unit or
+ * segment. Puts to the same element are combined, the last value written
+ * is transferred. Other puts are forwarded to \ref dart_put.
+ *
+ * Combined puts and accumulates to the same target unit and segment are
+ * applied in the order they were issued: pending updates of another size,
+ * operation or data type, or that partially overlap the update, are
+ * transferred before the update is buffered.
+ *
+ * The buffer capacity in bytes is set in the environment variable
+ * \c DART_COMBINING_BUFFER_SIZE (default: 65536), \c 0 disables
+ * write-combining.
+ *
+ * The local buffer \c src can be reused immediately. Local and remote
+ * completion is guaranteed after a flush operation.
+ *
+ * \param gptr      A global pointer determining the target of the put operation.
+ * \param src       The local source buffer to load the data from.
+ * \param nelem     The number of elements of type \c dtype to transfer.
+ * \param dtype     The basic data type of the values in buffer \c src.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_put_combining(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nelem,
+  dart_datatype_t   dtype) DART_NOTHROW;
+
+/**
+ * Write-combining variant of dart_accumulate for fine-grained updates.
+ *
+ * Small accumulates with a predefined operation to units that are not
+ * accessible in shared memory are collected in a buffer per target unit,
+ * segment, data type and operation like in \ref dart_put_combining.
+ * Updates of the same element are reduced locally before the buffer is
+ * transferred in a single accumulate with an indexed target data type.
+ * Other accumulates are forwarded to \ref dart_accumulate.
+ *
+ * Pending combined accumulates on a target unit are transferred before
+ * \ref dart_accumulate, \ref dart_fetch_and_op and
+ * \ref dart_compare_and_swap on the same unit and segment to retain the
+ * ordering of atomic operations.
+ *
+ * \param gptr    A global pointer determining the target of the accumulate
+ *                operation.
+ * \param values  The local buffer holding the elements to accumulate.
+ * \param nelem   The number of local elements to accumulate per unit.
+ * \param dtype   The data type to use in the accumulate operation \c op.
+ * \param op      The accumulation operation to perform.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_accumulate_combining(
+  dart_gptr_t      gptr,
+  const void     * values,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op) DART_NOTHROW;
+
 
 /**
  * Guarantee completion of all outstanding operations involving a segment on a certain unit
@@ -434,6 +584,8 @@ dart_ret_t dart_put(
  * gets on a certain memory allocation / window / segment for the
  * target unit specified in gptr.
  * Similar to \c MPI_Win_flush().
+ * Puts and accumulates pending in write-combining buffers of the target
+ * unit are transferred first, see \ref dart_put_combining.
  *
  * \param gptr Global pointer identifying the segment and unit to complete outstanding operations for.
  * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
@@ -451,6 +603,8 @@ dart_ret_t dart_flush(
  * gets on a certain memory allocation / window / segment for all
  * target units.
  * Similar to \c MPI_Win_flush_all().
+ * Puts and accumulates pending in write-combining buffers of the segment
+ * are transferred first, see \ref dart_put_combining.
  *
  * \param gptr Global pointer identifying the segment to complete outstanding operations for.
  * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
@@ -467,6 +621,8 @@ dart_ret_t dart_flush_all(
  * Guarantees local completion of all pending puts and
  * gets on a certain memory allocation / window / segment for the
  * target unit specified in gptr. -> MPI_Win_flush_local()
+ * Puts and accumulates pending in write-combining buffers of the target
+ * unit are transferred first, see \ref dart_put_combining.
  *
  * \param gptr Global pointer identifying the segment and unit to complete outstanding operations for.
  *
@@ -484,6 +640,8 @@ dart_ret_t dart_flush_local(
  * Guarantees local completion of all pending puts and
  * gets on a certain memory allocation / window / segment for the
  * all units. -> MPI_Win_flush_local_all()
+ * Puts and accumulates pending in write-combining buffers of the segment
+ * are transferred first, see \ref dart_put_combining.
  *
  * \param gptr Global pointer identifying the segment to complete outstanding operations for.
  *
@@ -716,6 +874,111 @@ dart_ret_t dart_handle_free(
 
 /** \} */
 
+/**
+ * \name Non-blocking collective operations using handles
+ * Non-blocking variants of collective operations involving all units of a
+ * given team. Completion of the operation is tested or awaited using the
+ * returned handle with \c dart_test_local, \c dart_wait_local etc.
+ * Buffers passed to the operation must not be accessed before the
+ * operation completed.
+ */
+
+/** \{ */
+
+/**
+ * DART Equivalent to MPI_Ibarrier.
+ *
+ * \param team        The team to perform a barrier on.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ibarrier(
+  dart_team_t       team,
+  dart_handle_t   * handle) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Ibcast.
+ *
+ * \param buf    Buffer that is the source (on \c root) or the destination of
+ *               the broadcast.
+ * \param nelem  The number of values to broadcast/receive.
+ * \param dtype  The data type of values in \c buf.
+ * \param root   The unit that broadcasts data to all other members in \c team
+ * \param team   The team to participate in the broadcast.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ibcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         team,
+  dart_handle_t     * handle) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Iallreduce.
+ *
+ * \param sendbuf The buffer containing the data to be sent by each unit.
+ * \param recvbuf The buffer to hold the received data.
+ * \param nelem   Number of elements sent by each process and received from each unit.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf to use in \c op.
+ * \param op      The reduction operation to perform.
+ * \param team    The team to participate in the allreduce.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_iallreduce(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team,
+  dart_handle_t    * handle) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Ialltoall.
+ *
+ * \param sendbuf The buffer containing the data to be sent by each unit.
+ * \param recvbuf The buffer to hold the received data.
+ * \param nelem   Number of elements sent by each process and received from each unit.
+ *                The value of this parameter must not execeed INT_MAX.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf.
+ * \param team    The team to participate in the alltoall.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ialltoall(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_team_t        team,
+  dart_handle_t    * handle) DART_NOTHROW;
+
+/** \} */
+
 /**
  * \name Blocking single-sided communication operations
  * These operations will block until completion of put and get is guaranteed.
@@ -230,6 +230,16 @@ dart_ret_t dart_unit_locality(
   dart_team_unit_t                unit,
   dart_unit_locality_t         ** loc)                  DART_NOTHROW;
 
+/**
+ * Durations of the phases of the locality initialization in \c dart_init
+ * measured at the calling unit.
+ *
+ * \threadsafe
+ * \ingroup DartLocality
+ */
+dart_ret_t dart_locality_init_timing(
+  dart_locality_init_timing_t   * timing)               DART_NOTHROW;
+
 /** \cond DART_HIDDEN_SYMBOLS */
 #define DART_INTERFACE_OFF
 /** \endcond */
@@ -0,0 +1,176 @@
+/**
+ * \file dash/dart/if/dart_stats.h
+ *
+ * Per-unit statistics of communication operations.
+ *
+ */
+#ifndef DART__STATS_H_
+#define DART__STATS_H_
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_util.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \defgroup  DartStats  Communication statistics
+ * \ingroup   DartInterface
+ *
+ * Counters of calls and transferred bytes of DART communication operations
+ * at the calling unit.
+ *
+ * Counters are disabled by default and can be enabled at runtime with
+ * \c dart_stats_enable or by setting the environment variable
+ * \c DART_ENABLE_STATS to \c 1 before \c dart_init.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DART_INTERFACE_ON
+
+/**
+ * Communication operations with separate statistics counters.
+ *
+ * \ingroup DartStats
+ */
+typedef enum
+{
+  DART_STATS_GET = 0,
+  DART_STATS_GET_HANDLE,
+  DART_STATS_GET_BLOCKING,
+  DART_STATS_PUT,
+  DART_STATS_PUT_HANDLE,
+  DART_STATS_PUT_BLOCKING,
+  DART_STATS_PUT_COMBINING,
+  DART_STATS_ACCUMULATE,
+  DART_STATS_ACCUMULATE_COMBINING,
+  DART_STATS_FETCH_AND_OP,
+  DART_STATS_COMPARE_AND_SWAP,
+  DART_STATS_BARRIER,
+  DART_STATS_BCAST,
+  DART_STATS_SCATTER,
+  DART_STATS_GATHER,
+  DART_STATS_ALLGATHER,
+  DART_STATS_ALLGATHERV,
+  DART_STATS_ALLREDUCE,
+  DART_STATS_ALLTOALL,
+  DART_STATS_ALLTOALLV,
+  DART_STATS_REDUCE,
+  DART_STATS_IBARRIER,
+  DART_STATS_IBCAST,
+  DART_STATS_IALLREDUCE,
+  DART_STATS_IALLTOALL,
+  DART_STATS_SEND,
+  DART_STATS_RECV,
+  DART_STATS_SENDRECV,
+  /** Number of operations with statistics counters */
+  DART_STATS_NUM_OPS
+} dart_stats_op_t;
+
+/**
+ * Transfer paths taken by communication operations.
+ *
+ * \ingroup DartStats
+ */
+typedef enum
+{
+  /** Copy in local memory of the calling unit */
+  DART_STATS_PATH_LOCAL = 0,
+  /** Copy in a shared memory window of a unit on the same node */
+  DART_STATS_PATH_SHMEM,
+  /** MPI one-sided, collective or point-to-point operation */
+  DART_STATS_PATH_MPI,
+  /** Number of transfer paths */
+  DART_STATS_NUM_PATHS
+} dart_stats_path_t;
+
+/**
+ * Statistics counters of a communication operation.
+ *
+ * \ingroup DartStats
+ */
+typedef struct
+{
+  /** Number of calls */
+  uint64_t calls;
+  /** Number of bytes transferred from or to the calling unit */
+  uint64_t bytes;
+  /** Number of calls by transfer path */
+  uint64_t path_calls[DART_STATS_NUM_PATHS];
+  /** Number of bytes by transfer path */
+  uint64_t path_bytes[DART_STATS_NUM_PATHS];
+} dart_stats_counters_t;
+
+/**
+ * Enable or disable recording of statistics counters at the calling unit.
+ *
+ * \ingroup DartStats
+ */
+dart_ret_t dart_stats_enable(
+  bool                    enable)                       DART_NOTHROW;
+
+/**
+ * Whether statistics counters are recorded at the calling unit.
+ *
+ * \ingroup DartStats
+ */
+dart_ret_t dart_stats_enabled(
+  bool                  * enabled)                      DART_NOTHROW;
+
+/**
+ * Reset all statistics counters of the calling unit to zero.
+ *
+ * \ingroup DartStats
+ */
+dart_ret_t dart_stats_reset()                           DART_NOTHROW;
+
+/**
+ * Statistics counters of a communication operation at the calling unit.
+ *
+ * \threadsafe
+ * \ingroup DartStats
+ */
+dart_ret_t dart_stats_op(
+  dart_stats_op_t         op,
+  dart_stats_counters_t * counters)                     DART_NOTHROW;
+
+/**
+ * Name of a communication operation, e.g. \c "get_handle".
+ *
+ * \threadsafe
+ * \ingroup DartStats
+ */
+dart_ret_t dart_stats_op_name(
+  dart_stats_op_t         op,
+  const char           ** name)                         DART_NOTHROW;
+
+/**
+ * Number of one-sided and point-to-point operations and transferred bytes
+ * of the calling unit by target unit.
+ *
+ * \param calls      Array of at least \c num_units elements receiving the
+ *                   number of calls targeting every global unit, may be
+ *                   \c NULL.
+ * \param bytes      Array of at least \c num_units elements receiving the
+ *                   number of bytes transferred to or from every global
+ *                   unit, may be \c NULL.
+ * \param num_units  Number of elements in \c calls and \c bytes, at most
+ *                   the number of units in \c DART_TEAM_ALL are set.
+ *
+ * \threadsafe
+ * \ingroup DartStats
+ */
+dart_ret_t dart_stats_target_histogram(
+  uint64_t              * calls,
+  uint64_t              * bytes,
+  size_t                  num_units)                    DART_NOTHROW;
+
+#define DART_INTERFACE_OFF
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* DART__STATS_H_ */
@@ -25,6 +25,9 @@ extern "C" {
  * Lock type to ensure mutual exclusion among units in a team.
  * The lock is thread-aware so only one thread of a unit can acquire
  * the lock at once.
+ * The lock is hierarchical: units on the same node hand off the lock in
+ * shared memory and only one unit per node takes part in the queue of
+ * the lock across nodes.
  * \ingroup DartSync
  */
 typedef struct dart_lock_struct *dart_lock_t;
@@ -683,12 +683,64 @@ typedef struct {
 }
 dart_unit_locality_t;
 
+/**
+ * Durations of the phases of the locality initialization in
+ * \c dart_init at the calling unit, in microseconds.
+ *
+ * \ingroup DartTypes
+ */
+typedef struct {
+    /** Discovery of the node topology by the node leader unit and import
+     *  of the topology from node-shared memory at all other units. */
+    double                   node_topology_us;
+
+    /** Resolving hardware locality of the unit and exchange of unit
+     *  locality data. */
+    double                   unit_mapping_us;
+
+    /** Construction of the host topology. */
+    double                   host_topology_us;
+
+    /** Construction of the locality domain hierarchy. */
+    double                   domain_hierarchy_us;
+
+    /** Duration of the complete locality initialization. */
+    double                   total_us;
+}
+dart_locality_init_timing_t;
+
 /**
  * \ingroup DartTypes
  */
 typedef struct
 {
   int log_enabled;
+  /**
+   * Whether atomic operations on units on the same node are performed
+   * with processor atomics in shared memory windows instead of MPI RMA
+   * atomics.
+   * Enabled by setting the environment variable \c DART_SHMEM_ATOMICS to
+   * \c 1 if the MPI windows use the unified memory model.
+   * Only safe if the MPI implementation performs RMA atomics of units on
+   * other nodes with processor atomics as well, or if the atomically
+   * accessed elements are only accessed by units on the same node.
+   * Must be set to the same value in all units and must not be changed
+   * while atomic operations are in progress.
+   */
+  int shmem_atomics;
+  /**
+   * Whether collective operations on small messages are performed
+   * hierarchically: units on the same node combine their data in shared
+   * memory and only one leader unit per node takes part in the
+   * communication between nodes.
+   * Applies to \c dart_barrier, \c dart_bcast, \c dart_allgather and
+   * \c dart_allreduce with commutative operations.
+   * Enabled by setting the environment variable \c DART_HIER_COLLECTIVES
+   * to \c 1.
+   * Must be set to the same value in all units and must only be changed
+   * between collective operations.
+   */
+  int hier_collectives;
 }
 dart_config_t;
 
@@ -771,6 +823,22 @@ dart_type_create_custom(
 dart_ret_t
 dart_type_destroy(dart_datatype_t *dart_type);
 
+/**
+ * Query the number of hits and misses of lookups in the cache of
+ * transfer types created for strided data types at the calling unit.
+ *
+ * \param[out] hits   Number of lookups of cached types, may be \c NULL.
+ * \param[out] misses Number of types that had to be created, may be
+ *                    \c NULL.
+ *
+ * \return \ref DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartTypes
+ */
+dart_ret_t
+dart_type_cache_stats(size_t *hits, size_t *misses);
+
 /**
  * The operator called from a reduction operation.
  * The operator should apply the intended operation to each of the \c len
@@ -6,6 +6,8 @@
 
 #include <dash/dart/if/dart_types.h>
 
+#include <stddef.h>
+
 /**
  * Initializes hwinfo object with uninitialized defaults.
  */
@@ -25,4 +27,31 @@ dart_ret_t dart_hwinfo_init(
 dart_ret_t dart_hwinfo(
   dart_hwinfo_t * hwinfo);
 
+/**
+ * Serializes the hardware topology of the local node to a buffer allocated
+ * with \c malloc, discovering the topology if it has not been loaded yet.
+ *
+ * The buffer is empty (\c NULL, size 0) if topology discovery is not
+ * available in the DART build configuration.
+ */
+dart_ret_t dart__base__hwinfo__topology_export(
+  char   ** buffer,
+  size_t  * size);
+
+/**
+ * Loads the hardware topology of the local node from a buffer created with
+ * \c dart__base__hwinfo__topology_export by another unit on the same node.
+ * Subsequent calls of \c dart_hwinfo use the imported topology instead of
+ * discovering it.
+ */
+dart_ret_t dart__base__hwinfo__topology_import(
+  const char * buffer,
+  size_t       size);
+
+/**
+ * Releases the hardware topology loaded by \c dart_hwinfo or imported with
+ * \c dart__base__hwinfo__topology_import.
+ */
+dart_ret_t dart__base__hwinfo__finalize();
+
 #endif /* DART__BASE__HWINFO_H__ */
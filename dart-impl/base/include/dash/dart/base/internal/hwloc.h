@@ -37,6 +37,12 @@ static inline dart_locality_scope_t dart__base__hwloc__obj_type_to_dart_scope(
   }
 }
 
+/**
+ * Hardware topology of the local node, discovered on first use unless
+ * imported with \c dart__base__hwinfo__topology_import.
+ */
+hwloc_topology_t dart__base__hwloc__topology();
+
 #endif /* DART_ENABLE_HWLOC */
 
 #endif /* DART__BASE__LOCALITY__INTERNAL__HWLOC_H_INCLUDED */
@@ -21,6 +21,14 @@ dart_ret_t dart__base__locality__init();
 
 dart_ret_t dart__base__locality__finalize();
 
+/**
+ * Duration of the phases of the locality initialization of
+ * \c DART_TEAM_ALL at the calling unit. The node topology phase is
+ * measured by the communication backend and not set here.
+ */
+dart_ret_t dart__base__locality__init_timing(
+  dart_locality_init_timing_t * timing);
+
 /* ======================================================================== *
  * Create / Delete                                                          *
  * ======================================================================== */
@@ -69,6 +69,107 @@ static int osx_sched_getcpu() {
 
 static const int BYTES_PER_MB = (1024 * 1024);
 
+#ifdef DART_ENABLE_HWLOC
+/* Topology of the local node, shared by all hardware locality queries: */
+static hwloc_topology_t dart__base__hwinfo__topology_ = NULL;
+
+static void dart__base__hwinfo__topology_init_(
+  hwloc_topology_t * topology,
+  unsigned long      flags)
+{
+  hwloc_topology_init(topology);
+  hwloc_topology_set_flags(*topology,
+#if HWLOC_API_VERSION < 0x00020000
+                             HWLOC_TOPOLOGY_FLAG_IO_DEVICES
+                           | HWLOC_TOPOLOGY_FLAG_IO_BRIDGES
+  /*                       | HWLOC_TOPOLOGY_FLAG_WHOLE_IO  */
+#else
+                             HWLOC_TOPOLOGY_FLAG_WHOLE_SYSTEM
+#endif
+                           | flags
+                          );
+}
+
+hwloc_topology_t dart__base__hwloc__topology()
+{
+  if (NULL == dart__base__hwinfo__topology_) {
+    DART_LOG_TRACE("dart__base__hwloc__topology: discovering topology");
+    dart__base__hwinfo__topology_init_(&dart__base__hwinfo__topology_, 0);
+    hwloc_topology_load(dart__base__hwinfo__topology_);
+  }
+  return dart__base__hwinfo__topology_;
+}
+#endif /* DART_ENABLE_HWLOC */
+
+dart_ret_t dart__base__hwinfo__topology_export(
+  char   ** buffer,
+  size_t  * size)
+{
+  *buffer = NULL;
+  *size   = 0;
+#ifdef DART_ENABLE_HWLOC
+  char * xml_buffer;
+  int    xml_size;
+  hwloc_topology_t topology = dart__base__hwloc__topology();
+  if (hwloc_topology_export_xmlbuffer(topology, &xml_buffer, &xml_size
+#if HWLOC_API_VERSION >= 0x00020000
+                                      , 0
+#endif
+                                     ) != 0) {
+    DART_LOG_ERROR("dart__base__hwinfo__topology_export ! "
+                   "hwloc_topology_export_xmlbuffer failed");
+    return DART_ERR_OTHER;
+  }
+  *buffer = malloc(xml_size);
+  memcpy(*buffer, xml_buffer, xml_size);
+  *size   = xml_size;
+  hwloc_free_xmlbuffer(topology, xml_buffer);
+  DART_LOG_TRACE("dart__base__hwinfo__topology_export > size:%zu", *size);
+#endif
+  return DART_OK;
+}
+
+dart_ret_t dart__base__hwinfo__topology_import(
+  const char * buffer,
+  size_t       size)
+{
+#ifdef DART_ENABLE_HWLOC
+  DART_LOG_TRACE("dart__base__hwinfo__topology_import() size:%zu", size);
+  if (NULL != dart__base__hwinfo__topology_) {
+    hwloc_topology_destroy(dart__base__hwinfo__topology_);
+    dart__base__hwinfo__topology_ = NULL;
+  }
+  hwloc_topology_t topology;
+  /* Binding queries like the last CPU location of the unit require the
+   * imported topology to be marked as the topology of this system: */
+  dart__base__hwinfo__topology_init_(
+    &topology, HWLOC_TOPOLOGY_FLAG_IS_THISSYSTEM);
+  if (hwloc_topology_set_xmlbuffer(topology, buffer, (int)size) != 0 ||
+      hwloc_topology_load(topology) != 0) {
+    DART_LOG_ERROR("dart__base__hwinfo__topology_import ! "
+                   "failed to load topology from XML buffer");
+    hwloc_topology_destroy(topology);
+    return DART_ERR_OTHER;
+  }
+  dart__base__hwinfo__topology_ = topology;
+#else
+  dart__unused(buffer);
+  dart__unused(size);
+#endif
+  return DART_OK;
+}
+
+dart_ret_t dart__base__hwinfo__finalize()
+{
+#ifdef DART_ENABLE_HWLOC
+  if (NULL != dart__base__hwinfo__topology_) {
+    hwloc_topology_destroy(dart__base__hwinfo__topology_);
+    dart__base__hwinfo__topology_ = NULL;
+  }
+#endif
+  return DART_OK;
+}
+
 /* NOTE: The dart_hwinfo function must only return reliable information,
  *       typically obtained from system functions or libraries such as
  *       hwloc, PAPI, likwid etc.
@@ -154,18 +255,7 @@ dart_ret_t dart_hwinfo(
 #ifdef DART_ENABLE_HWLOC
   DART_LOG_TRACE("dart_hwinfo: using hwloc");
 
-  hwloc_topology_t topology;
-  hwloc_topology_init(&topology);
-  hwloc_topology_set_flags(topology,
-#if HWLOC_API_VERSION < 0x00020000
-                             HWLOC_TOPOLOGY_FLAG_IO_DEVICES
-                           | HWLOC_TOPOLOGY_FLAG_IO_BRIDGES
-  /*                       | HWLOC_TOPOLOGY_FLAG_WHOLE_IO  */
-#else
-                             HWLOC_TOPOLOGY_FLAG_WHOLE_SYSTEM
-#endif
-                          );
-  hwloc_topology_load(topology);
+  hwloc_topology_t topology = dart__base__hwloc__topology();
 
   /* hwloc can resolve the physical index (os_index) of the active unit,
    * not the logical index.
@@ -337,7 +427,6 @@ dart_ret_t dart_hwinfo(
     }
   }
 
-  hwloc_topology_destroy(topology);
   DART_LOG_TRACE("dart_hwinfo: hwloc: "
                  "num_numa:%d numa_id:%d "
                  "num_cores:%d core_id:%d cpu_id:%d",
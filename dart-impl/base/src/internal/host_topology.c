@@ -41,18 +41,7 @@ static dart_ret_t dart__base__host_topology__module_locations(
 #if defined(DART_ENABLE_HWLOC) && defined(DART_ENABLE_HWLOC_PCI)
   DART_LOG_TRACE("dart__base__host_topology__module_locations: using hwloc");
 
-  hwloc_topology_t topology;
-  hwloc_topology_init(&topology);
-  hwloc_topology_set_flags(topology,
-#if HWLOC_API_VERSION < 0x00020000
-                             HWLOC_TOPOLOGY_FLAG_IO_DEVICES
-                           | HWLOC_TOPOLOGY_FLAG_IO_BRIDGES
-  /*                       | HWLOC_TOPOLOGY_FLAG_WHOLE_IO  */
-#else
-                             HWLOC_TOPOLOGY_FLAG_WHOLE_SYSTEM
-#endif
-                          );
-  hwloc_topology_load(topology);
+  hwloc_topology_t topology = dart__base__hwloc__topology();
   DART_LOG_TRACE("dart__base__host_topology__module_locations: "
                  "hwloc: indexing PCI devices");
   /* Alternative: HWLOC_TYPE_DEPTH_PCI_DEVICE */
@@ -125,7 +114,6 @@ static dart_ret_t dart__base__host_topology__module_locations(
       }
     }
   }
-  hwloc_topology_destroy(topology);
   DART_LOG_TRACE("dart__base__host_topology__module_locations > "
                  "num_modules:%d", *num_modules);
 #endif /* ifdef DART_ENABLE_HWLOC */
@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <sched.h>
 #include <limits.h>
+#include <time.h>
 
 #include <dash/dart/base/locality.h>
 #include <dash/dart/base/macro.h>
@@ -42,6 +43,10 @@ dart__base__locality__unit_mapping_  = NULL;
 static dart_domain_locality_t **
 dart__base__locality__global_domain_ = NULL;
 
+/* Duration of the locality initialization phases of DART_TEAM_ALL */
+static dart_locality_init_timing_t
+dart__base__locality__init_timing_ = { 0, 0, 0, 0, 0 };
+
 /* dart_team_t is defined as int16_t */
 static const size_t max_num_teams = 1 << (sizeof(dart_team_t)*8 - 1);
 /* make sure the size of dart_team_t does not changed without us noticing */
@@ -57,6 +62,14 @@ static int cmpstr_(const void * p1, const void * p2)
   return strcmp(* (char * const *) p1, * (char * const *) p2);
 }
 
+static inline double dart__base__locality__timestamp_us_()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((ts.tv_sec * 1E6)
+            + (ts.tv_nsec / 1E3));
+}
+
 dart_ret_t dart__base__locality__scope_domains_rec(
   const dart_domain_locality_t   * domain,
   dart_locality_scope_t            scope,
@@ -121,6 +134,15 @@ dart_ret_t dart__base__locality__finalize()
   free(dart__base__locality__unit_mapping_);
   dart__base__locality__unit_mapping_  = NULL;
 
+  dart__base__hwinfo__finalize();
+
+  return DART_OK;
+}
+
+dart_ret_t dart__base__locality__init_timing(
+  dart_locality_init_timing_t * timing)
+{
+  *timing = dart__base__locality__init_timing_;
   return DART_OK;
 }
 
@@ -193,6 +215,10 @@ dart_ret_t dart__base__locality__create(
       DART_OK);
   }
 
+  double ts_phase = dart__base__locality__timestamp_us_();
+  double ts_start = ts_phase;
+  dart_locality_init_timing_t timing = { 0, 0, 0, 0, 0 };
+
   /* Exchange unit locality information between all units:
    */
   dart_unit_mapping_t * unit_mapping;
@@ -200,6 +226,8 @@ dart_ret_t dart__base__locality__create(
     dart__base__unit_locality__create(team, &unit_mapping),
     DART_OK);
   dart__base__locality__unit_mapping_[team] = unit_mapping;
+  timing.unit_mapping_us = dart__base__locality__timestamp_us_() - ts_phase;
+  ts_phase += timing.unit_mapping_us;
 
   /* Resolve host topology from the unit's host names:
    */
@@ -208,6 +236,8 @@ dart_ret_t dart__base__locality__create(
     dart__base__host_topology__create(unit_mapping, &topo),
     DART_OK);
   dart__base__locality__host_topology_[team] = topo;
+  timing.host_topology_us = dart__base__locality__timestamp_us_() - ts_phase;
+  ts_phase += timing.host_topology_us;
   size_t num_nodes = topo->num_nodes;
   DART_LOG_TRACE("dart__base__locality__create: nodes: %ld", num_nodes);
 
@@ -240,6 +270,18 @@ dart_ret_t dart__base__locality__create(
       dart__base__locality__host_topology_[team],
       dart__base__locality__unit_mapping_[team]),
     DART_OK);
+  double ts_end = dart__base__locality__timestamp_us_();
+  timing.domain_hierarchy_us = ts_end - ts_phase;
+  timing.total_us            = ts_end - ts_start;
+
+  DART_LOG_DEBUG("dart__base__locality__create: "
+                 "unit mapping:%.0fus host topology:%.0fus "
+                 "domain hierarchy:%.0fus",
+                 timing.unit_mapping_us, timing.host_topology_us,
+                 timing.domain_hierarchy_us);
+  if (team == DART_TEAM_ALL) {
+    dart__base__locality__init_timing_ = timing;
+  }
 
   DART_LOG_DEBUG("dart__base__locality__create >");
   return DART_OK;
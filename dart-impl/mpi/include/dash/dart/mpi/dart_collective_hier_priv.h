@@ -0,0 +1,177 @@
+/**
+ * \file dash/dart/mpi/dart_collective_hier_priv.h
+ *
+ * Internal interface of the node-aware (hierarchical) implementation of
+ * collective operations.
+ *
+ * Units of a team on the same node exchange data in a shared memory
+ * window of the node's shared memory communicator. Only one leader unit
+ * per node takes part in the inter-node step, which is performed with MPI
+ * collectives on the communicator of node leaders.
+ *
+ * The hierarchical implementation is only used if it is enabled with the
+ * environment variable \c DART_HIER_COLLECTIVES in \c dart_init, see
+ * \c dart__mpi__hier_init and \c dart_config_t::hier_collectives.
+ */
+#ifndef DART__MPI__DART_COLLECTIVE_HIER_PRIV_H__
+#define DART__MPI__DART_COLLECTIVE_HIER_PRIV_H__
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/base/macro.h>
+
+#include <dash/dart/mpi/dart_team_private.h>
+#include <dash/dart/mpi/dart_communication_priv.h>
+
+#include <mpi.h>
+#include <stdint.h>
+
+/**
+ * Size in bytes of the shared memory buffer of every unit, limits the
+ * message size of hierarchical reductions and broadcasts.
+ */
+#ifndef DART_HIER_SLOT_SIZE
+#define DART_HIER_SLOT_SIZE   (4096)
+#endif
+
+/**
+ * Size in bytes of the shared memory result buffer of a node, limits the
+ * total message size of hierarchical allgather operations.
+ */
+#ifndef DART_HIER_RESULT_SIZE
+#define DART_HIER_RESULT_SIZE (65536)
+#endif
+
+/**
+ * Synchronization flag in shared memory, padded to a cache line.
+ */
+typedef struct dart_hier_flag {
+  uint64_t value;
+  char     pad[64 - sizeof(uint64_t)];
+} dart_hier_flag_t;
+
+/**
+ * Node hierarchy of a team, created on first use.
+ */
+typedef struct dart_team_hier {
+  /**
+   * Whether the team spans a node with more than one unit, otherwise
+   * collective operations are not performed hierarchically.
+   */
+  int                enabled;
+  /// Rank of the unit in the node's shared memory communicator.
+  int                node_rank;
+  /// Number of the team's units on the unit's node, 0 if the units on
+  /// the node cannot be determined.
+  int                node_size;
+  /// Index of the unit's node, the rank of its leader in \c leader_comm.
+  int                node_id;
+  /// Number of nodes spanned by the team.
+  int                num_nodes;
+  /// Communicator of node leaders, \c MPI_COMM_NULL at other units.
+  MPI_Comm           leader_comm;
+  /// Node index of every unit in the team, by team-relative unit ID.
+  int              * unit_node;
+  /// Team-relative IDs of the team's units, ordered by node.
+  int              * node_units;
+  /// Offset of every node's units in \c node_units.
+  int              * node_displs;
+  /// Shared memory window containing flags and buffers.
+  MPI_Win            win;
+  /// Arrival flags of the units on the node, by node rank.
+  dart_hier_flag_t * arrive;
+  /// Release flag set by the node leader.
+  dart_hier_flag_t * release;
+  /// Buffers of the units on the node, by node rank.
+  char            ** slots;
+  /// Result buffer written by the node leader.
+  char             * result;
+  /// Private buffer of the node leader for allgather operations.
+  char             * gather_buf;
+  /// Byte counts and offsets of nodes in allgather operations.
+  int              * gather_counts;
+  int              * gather_displs;
+  /// Number of synchronization epochs started by the unit.
+  uint64_t           epoch;
+} dart_team_hier_t;
+
+/**
+ * Enable hierarchical collective operations if requested in the
+ * environment variable \c DART_HIER_COLLECTIVES.
+ * Collective on \c DART_TEAM_ALL.
+ */
+void dart__mpi__hier_init() DART_INTERNAL;
+
+/**
+ * Free the node hierarchy of a team, if it has been created.
+ */
+void dart__mpi__hier_fini(dart_team_data_t * team_data) DART_INTERNAL;
+
+/**
+ * Node hierarchy of a team, created if it does not exist yet. In that
+ * case, the call is collective on all units of the team.
+ *
+ * \return  The node hierarchy or \c NULL if the team does not span a node
+ *          with more than one unit.
+ */
+dart_team_hier_t * dart__mpi__hier_get(
+  dart_team_data_t * team_data) DART_INTERNAL;
+
+/*
+ * Hierarchical collective operations, only valid if
+ * \c dart__mpi__hier_use returned true for the team and message size.
+ * Buffer sizes are specified in bytes per unit.
+ */
+
+dart_ret_t dart__mpi__hier_barrier(
+  dart_team_data_t * team_data) DART_INTERNAL;
+
+dart_ret_t dart__mpi__hier_bcast(
+  dart_team_data_t * team_data,
+  void             * buf,
+  size_t             nbytes,
+  dart_team_unit_t   root) DART_INTERNAL;
+
+dart_ret_t dart__mpi__hier_allreduce(
+  dart_team_data_t * team_data,
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nbytes,
+  int                nelem,
+  MPI_Datatype       mpi_dtype,
+  MPI_Op             mpi_op) DART_INTERNAL;
+
+dart_ret_t dart__mpi__hier_allgather(
+  dart_team_data_t * team_data,
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nbytes) DART_INTERNAL;
+
+/*
+ * Split-phase barrier of the team's units on the calling unit's node.
+ */
+
+dart_ret_t dart__mpi__hier_node_arrive(
+  dart_team_data_t * team_data) DART_INTERNAL;
+
+dart_ret_t dart__mpi__hier_node_wait(
+  dart_team_data_t * team_data) DART_INTERNAL;
+
+/**
+ * Whether a collective operation on the team with \c nbytes bytes per
+ * unit in total is performed hierarchically: hierarchical collectives are
+ * enabled, the message fits into the shared memory buffers and the team
+ * spans a node with more than one unit.
+ */
+static inline
+bool dart__mpi__hier_use(
+  dart_team_data_t * team_data,
+  size_t             nbytes)
+{
+  if (dart__likely(!dart_config_.hier_collectives) ||
+      nbytes > DART_HIER_SLOT_SIZE) {
+    return false;
+  }
+  return (dart__mpi__hier_get(team_data) != NULL);
+}
+
+#endif /* DART__MPI__DART_COLLECTIVE_HIER_PRIV_H__ */
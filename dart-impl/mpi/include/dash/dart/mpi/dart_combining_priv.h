@@ -0,0 +1,61 @@
+/**
+ * \file dash/dart/mpi/dart_combining_priv.h
+ *
+ * Internal interface of the write-combining buffers of fine-grained puts
+ * and accumulates, see \c dart_put_combining.
+ */
+#ifndef DART__MPI__DART_COMBINING_PRIV_H__
+#define DART__MPI__DART_COMBINING_PRIV_H__
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/base/macro.h>
+
+#include <dash/dart/mpi/dart_team_private.h>
+#include <dash/dart/mpi/dart_segment.h>
+
+/**
+ * Number of write-combining buffers holding pending updates, checked before
+ * flushing buffers.
+ */
+extern int dart__mpi__combining_pending_ DART_INTERNAL;
+
+dart_ret_t dart__mpi__combining_init() DART_INTERNAL;
+
+dart_ret_t dart__mpi__combining_fini() DART_INTERNAL;
+
+/**
+ * Transfer the pending updates of all write-combining buffers of the given
+ * segment to unit \c unitid, or to all units if \c unitid is negative.
+ * The transfers are completed on return.
+ */
+dart_ret_t dart__mpi__combining_transfer(
+  dart_team_data_t    * team_data,
+  dart_segment_info_t * seginfo,
+  int                   unitid) DART_INTERNAL;
+
+/**
+ * Drop the write-combining buffers of a segment that is freed.
+ */
+void dart__mpi__combining_discard(
+  dart_team_t           teamid,
+  int16_t               segid) DART_INTERNAL;
+
+/**
+ * Transfer pending updates in write-combining buffers of a segment to unit
+ * \c unitid or all units, only checks a counter if no updates are pending.
+ */
+static inline
+dart_ret_t dart__mpi__combining_flush(
+  dart_team_data_t    * team_data,
+  dart_segment_info_t * seginfo,
+  int                   unitid)
+{
+  if (dart__likely(
+        __atomic_load_n(&dart__mpi__combining_pending_,
+                        __ATOMIC_RELAXED) == 0)) {
+    return DART_OK;
+  }
+  return dart__mpi__combining_transfer(team_data, seginfo, unitid);
+}
+
+#endif /* DART__MPI__DART_COMBINING_PRIV_H__ */
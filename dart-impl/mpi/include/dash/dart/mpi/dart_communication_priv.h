@@ -211,18 +211,63 @@ dart__mpi__create_strided_mpi(
   dart_datatype_t dart_type,
   size_t          num_blocks) DART_INTERNAL;
 
+/**
+ * Entry of the MPI type cache, see \c dart__mpi__datatype_cache_strided.
+ */
+typedef struct dart_type_cache_entry dart_type_cache_entry_t;
+
+/**
+ * Returns the committed MPI type representing \c num_blocks blocks of the
+ * strided DART type \c dart_type.
+ *
+ * MPI types are kept in a LRU cache keyed by \c (dart_type, num_blocks)
+ * and must not be freed by the caller. The least recently used type is
+ * released once the cache is full.
+ *
+ * The cache entry holding the type is returned in \c entry and remains
+ * valid until it is passed to \c dart__mpi__datatype_cache_release, which
+ * must be called once the MPI operation using the type has been started.
+ * Returns \c MPI_DATATYPE_NULL and sets \c entry to \c NULL if the entry
+ * could not be allocated.
+ */
+MPI_Datatype
+dart__mpi__datatype_cache_strided(
+  dart_datatype_t            dart_type,
+  size_t                     num_blocks,
+  dart_type_cache_entry_t ** entry) DART_INTERNAL;
+
+/**
+ * Releases a cache entry returned by \c dart__mpi__datatype_cache_strided,
+ * \c entry may be \c NULL.
+ */
 void
-dart__mpi__destroy_strided_mpi(MPI_Datatype *mpi_type) DART_INTERNAL;
+dart__mpi__datatype_cache_release(
+  dart_type_cache_entry_t  * entry) DART_INTERNAL;
 
-DART_INLINE
+/**
+ * Releases all cached MPI types created for the DART type \c dart_type.
+ * Types still in use are freed once they are released.
+ */
 void
+dart__mpi__datatype_cache_evict(dart_datatype_t dart_type) DART_INTERNAL;
+
+/**
+ * Converts \c dart_num_elem elements of \c dart_type to an MPI type and
+ * element count. For strided types, \c cache_entry receives the cache
+ * entry to be released with \c dart__mpi__datatype_cache_release after the
+ * MPI operation has been started, it is set to \c NULL otherwise.
+ */
+DART_INLINE
+dart_ret_t
 dart__mpi__datatype_convert_mpi(
-  dart_datatype_t  dart_type,
-  size_t           dart_num_elem,
-  MPI_Datatype   * mpi_type,
-  int            * mpi_num_elem)
+  dart_datatype_t            dart_type,
+  size_t                     dart_num_elem,
+  MPI_Datatype             * mpi_type,
+  int                      * mpi_num_elem,
+  dart_type_cache_entry_t ** cache_entry)
 {
   dart_datatype_struct_t *dts = dart__mpi__datatype_struct(dart_type);
+  *cache_entry = NULL;
   switch(dts->kind) {
     case DART_KIND_BASIC:  /* fall-through */
     case DART_KIND_CUSTOM:
@@ -231,8 +276,12 @@ dart__mpi__datatype_convert_mpi(
       break;
     case DART_KIND_STRIDED:
       *mpi_num_elem = 1;
-      *mpi_type     = dart__mpi__create_strided_mpi(
-                                      dart_type, dart_num_elem / dts->num_elem);
+      *mpi_type     = dart__mpi__datatype_cache_strided(
+                                      dart_type, dart_num_elem / dts->num_elem,
+                                      cache_entry);
+      if (*cache_entry == NULL) {
+        return DART_ERR_OTHER;
+      }
       break;
     case DART_KIND_INDEXED:
       *mpi_num_elem = dart_num_elem / dts->num_elem;
@@ -242,6 +291,7 @@ dart__mpi__datatype_convert_mpi(
       // should not happen!
       DART_ASSERT_MSG(NULL, "Unknown DART type detected!");
   }
+  return DART_OK;
 }
 
 char* dart__mpi__datatype_name(dart_datatype_t dart_type) DART_INTERNAL;
@@ -303,6 +353,23 @@ DART_INLINE MPI_Datatype dart__mpi__op_type(
   }
 }
 
+/*****************************************************************/
+/* Atomic operations                                             */
+/*****************************************************************/
+
+/**
+ * The DART runtime configuration, defined in dart_config.c.
+ */
+extern dart_config_t dart_config_;
+
+/**
+ * Enable atomic operations in shared memory windows if requested in the
+ * environment variable \c DART_SHMEM_ATOMICS and the windows \c win and
+ * \c local_win use the unified memory model in all units.
+ * Collective on \c DART_TEAM_ALL.
+ */
+DART_INTERNAL
+void dart__mpi__shmem_atomics_init(MPI_Win win, MPI_Win local_win);
 
 
 #endif /* DART_ADAPT_COMMUNICATION_PRIV_H_INCLUDED */
@@ -15,4 +15,7 @@ dart_ret_t dart__mpi__locality_init() DART_INTERNAL;
 
 dart_ret_t dart__mpi__locality_finalize() DART_INTERNAL;
 
+dart_ret_t dart__mpi__locality_init_timing(
+  dart_locality_init_timing_t * timing) DART_INTERNAL;
+
 #endif /* DART__MPI__DART_LOCALITY_PRIV_H__ */
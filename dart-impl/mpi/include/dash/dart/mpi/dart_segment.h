@@ -12,11 +12,20 @@
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/base/macro.h>
+#include <dash/dart/base/config.h>
 
 typedef int16_t dart_segid_t;
 
 #define DART_SEGMENT_HASH_SIZE 256
 
+/**
+ * Number of segment IDs resolved by direct lookup. The table covers the
+ * segment IDs in [-DART_SEGMENT_TABLE_SIZE/2, DART_SEGMENT_TABLE_SIZE/2),
+ * segments with IDs outside this range are kept in the hash table.
+ */
+#define DART_SEGMENT_TABLE_SIZE 256
+#define DART_SEGMENT_TABLE_OFFSET (DART_SEGMENT_TABLE_SIZE / 2)
+
 typedef struct
 {
   size_t       size;
@@ -35,6 +44,10 @@ typedef struct
 typedef struct dart_seghash_elem dart_seghash_elem_t;
 
 typedef struct {
+  /// segments with IDs in the range of the direct lookup table
+  dart_segment_info_t * segtab[DART_SEGMENT_TABLE_SIZE]
+                          __attribute__((aligned(DART__ARCH__CACHE_LINE_SIZE)));
+  /// segments with IDs exceeding the range of the direct lookup table
   dart_seghash_elem_t * hashtab[DART_SEGMENT_HASH_SIZE];
   dart_team_t           team_id;
   dart_seghash_elem_t * mem_freelist;
@@ -86,12 +99,33 @@ dart_segment_register(
   dart_segment_info_t *seg) DART_INTERNAL;
 
 /**
- * Returns the segment info for the segment with ID \c segid.
+ * Returns the segment info for the segment with ID \c segid from the hash
+ * table of segments outside the range of the direct lookup table.
  */
-dart_segment_info_t * dart_segment_get_info(
+dart_segment_info_t * dart_segment_get_info_overflow(
   dart_segmentdata_t *segdata,
   dart_segid_t        segid) DART_INTERNAL;
 
+/**
+ * Returns the segment info for the segment with ID \c segid.
+ */
+static inline
+dart_segment_info_t *
+dart_segment_get_info(
+  dart_segmentdata_t *segdata,
+  dart_segid_t        segid)
+{
+  int idx = segid + DART_SEGMENT_TABLE_OFFSET;
+  if (dart__likely(idx >= 0 && idx < DART_SEGMENT_TABLE_SIZE)) {
+    dart_segment_info_t *seg = segdata->segtab[idx];
+    if (dart__likely(seg != NULL)) {
+      return seg;
+    }
+  }
+  // not registered or outside the range of the direct lookup table
+  return dart_segment_get_info_overflow(segdata, segid);
+}
+
 /**
  * Returns the segment's displacement at unit \c team_unit_id.
  */
@@ -0,0 +1,47 @@
+/**
+ * \file dash/dart/mpi/dart_stats_priv.h
+ *
+ * Internal recording of communication statistics counters of the DART-MPI
+ * library.
+ */
+#ifndef DART__MPI__DART_STATS_PRIV_H__
+#define DART__MPI__DART_STATS_PRIV_H__
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_stats.h>
+#include <dash/dart/base/macro.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * Whether statistics counters are recorded, checked before every
+ * recording of counters.
+ */
+extern bool dart__mpi__stats_enabled_ DART_INTERNAL;
+
+dart_ret_t dart__mpi__stats_init(int num_units) DART_INTERNAL;
+
+dart_ret_t dart__mpi__stats_fini() DART_INTERNAL;
+
+/**
+ * Record a call of communication operation \c op on transfer path \c path,
+ * and the target in the global unit histogram if \c target is not negative.
+ */
+void dart__mpi__stats_record(
+  dart_stats_op_t   op,
+  dart_stats_path_t path,
+  size_t            nbytes,
+  int               target) DART_INTERNAL;
+
+/**
+ * Record counters of a communication operation if statistics are enabled.
+ */
+#define DART__MPI__STATS_RECORD(_op, _path, _nbytes, _target)             \
+  do {                                                                    \
+    if (dart__unlikely(dart__mpi__stats_enabled_)) {                      \
+      dart__mpi__stats_record((_op), (_path), (_nbytes), (_target));      \
+    }                                                                     \
+  } while (0)
+
+#endif /* DART__MPI__DART_STATS_PRIV_H__ */
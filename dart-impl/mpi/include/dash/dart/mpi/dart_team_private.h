@@ -143,6 +143,8 @@
 #include <dash/dart/mpi/dart_mem.h>
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/base/macro.h>
+#include <dash/dart/base/config.h>
+#include <dash/dart/if/dart_util.h>
 
 extern dart_team_t dart_next_availteamid DART_INTERNAL;
 
@@ -151,8 +153,36 @@ extern MPI_Comm dart_comm_world DART_INTERNAL;
 
 #define DART_MAX_TEAM_NUMBER (256)
 
+/**
+ * Number of team IDs resolved by direct lookup, team data of teams with
+ * higher IDs is kept in a hash table.
+ */
+#define DART_TEAM_TABLE_SIZE DART_MAX_TEAM_NUMBER
+
+/**
+ * Teams with less than 1/DART_TEAM_G2L_DENSE_RATIO of all units use a
+ * sorted, sparse global-to-local unit ID table if the number of all units
+ * exceeds DART_TEAM_G2L_DENSE_MIN.
+ */
+#define DART_TEAM_G2L_DENSE_RATIO (4)
+#define DART_TEAM_G2L_DENSE_MIN   (4096)
+
+/**
+ * Entry in the sparse global-to-local unit ID table of a team.
+ */
+typedef struct dart_team_unit_pair {
+  dart_global_unit_t global;
+  dart_team_unit_t   local;
+} dart_team_unit_pair_t;
+
 typedef struct dart_team_data {
 
+  /**
+   * @brief Direct-indexed and hashed segment data of this team, kept first
+   * to be aligned to cache lines.
+   */
+  dart_segmentdata_t segdata;
+
   struct dart_team_data *next;
 
   /**
@@ -165,8 +195,6 @@ typedef struct dart_team_data {
    */
   MPI_Win window;
 
-  dart_segmentdata_t segdata;
-
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   /**
    * @brief Store the sub-communicator with regard to certain node, where the units can
@@ -184,12 +212,37 @@ typedef struct dart_team_data {
    */
   int sharedmem_nodesize;
 
+  /**
+   * @brief Node hierarchy used by hierarchical collective operations,
+   * created on first use.
+   */
+  struct dart_team_hier *hier;
+
 #endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 
   dart_unit_t unitid;
 
   int         size;
 
+  /**
+   * @brief Global unit IDs of the team's units, indexed by team-relative
+   * unit ID. Not allocated for \c DART_TEAM_ALL.
+   */
+  dart_global_unit_t *unit_l2g;
+
+  /**
+   * @brief Team-relative unit IDs indexed by global unit ID, or \c NULL if
+   * \c unit_g2l_sparse is used.
+   */
+  dart_team_unit_t *unit_g2l;
+
+  /**
+   * @brief Team-relative unit IDs of the team's units in ascending order of
+   * their global unit IDs, used instead of \c unit_g2l for teams containing
+   * a small fraction of all units.
+   */
+  dart_team_unit_pair_t *unit_g2l_sparse;
+
   dart_team_t teamid;
 
   struct dart_lock_struct *allocated_locks;
@@ -227,11 +280,40 @@ dart_ret_t dart_adapt_teamlist_alloc(dart_team_t teamid) DART_INTERNAL;
 dart_ret_t
 dart_adapt_teamlist_dealloc(dart_team_t teamid) DART_INTERNAL;
 
+/**
+ * Retrieve the \c dart_team_data for \c teamid from the hash table of teams
+ * with IDs exceeding \c DART_TEAM_TABLE_SIZE.
+ */
+dart_team_data_t *
+dart_adapt_teamlist_get_overflow(dart_team_t teamid) DART_INTERNAL;
+
+extern dart_team_data_t *dart_team_table[DART_TEAM_TABLE_SIZE] DART_INTERNAL;
+
 /**
  * Retrieve the \c dart_team_data for \c teamid.
  */
+DART_INLINE
 dart_team_data_t *
-dart_adapt_teamlist_get(dart_team_t teamid) DART_INTERNAL;
+dart_adapt_teamlist_get(dart_team_t teamid)
+{
+  if (dart__likely(teamid >= 0 && teamid < DART_TEAM_TABLE_SIZE)) {
+    return dart_team_table[teamid];
+  }
+  return dart_adapt_teamlist_get_overflow(teamid);
+}
+
+/**
+ * Create the unit ID translation tables of the team from its communicator.
+ * Called once when the team is created.
+ */
+dart_ret_t
+dart_team_unit_tables_init(dart_team_data_t *team_data) DART_INTERNAL;
+
+/**
+ * Free the unit ID translation tables of the team.
+ */
+void
+dart_team_unit_tables_fini(dart_team_data_t *team_data) DART_INTERNAL;
 
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 /*
@@ -0,0 +1,551 @@
+/**
+ * \file dart_collective_hier.c
+ *
+ * Node-aware (hierarchical) collective operations.
+ *
+ * Units of a team on the same node are grouped by the team's shared
+ * memory communicator. Every unit owns a buffer in a shared memory window
+ * of its node, the unit with node rank 0 is the node leader and
+ * additionally owns the synchronization flags and a result buffer.
+ *
+ * Collective operations are performed in three steps:
+ *
+ * 1. Every unit copies its contribution to its buffer and signals its
+ *    arrival by storing the number of the current epoch in its flag.
+ * 2. The node leader waits for all arrivals, combines the contributions
+ *    of the node and performs the inter-node step with MPI collectives on
+ *    the communicator of node leaders. The result is stored in the result
+ *    buffer and the leader signals the release of the epoch.
+ * 3. All other units on the node wait for the release and copy the result.
+ *
+ * Buffers are reused in the next epoch only after all units on the node
+ * arrived in it, i.e. finished reading results of the previous epoch.
+ */
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_communication.h>
+
+#include <dash/dart/mpi/dart_collective_hier_priv.h>
+#include <dash/dart/mpi/dart_communication_priv.h>
+#include <dash/dart/mpi/dart_team_private.h>
+
+#include <dash/dart/base/logging.h>
+
+#include <mpi.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Number of polls of a flag between triggering MPI progress while waiting
+ * for units on the node.
+ */
+#define DART_HIER_SPIN_PROGRESS  64
+
+void dart__mpi__hier_init()
+{
+  dart_config_.hier_collectives = 0;
+
+  const char * env_hier = getenv("DART_HIER_COLLECTIVES");
+  int enabled = (env_hier != NULL &&
+                 (strcmp(env_hier, "1") == 0 || strcmp(env_hier, "on") == 0));
+  /* All units have to agree on the implementation of collectives */
+  MPI_Allreduce(
+    MPI_IN_PLACE, &enabled, 1, MPI_INT, MPI_MIN, DART_COMM_WORLD);
+  if (!enabled) {
+    return;
+  }
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  dart_config_.hier_collectives = 1;
+  DART_LOG_DEBUG("dart__mpi__hier_init: hierarchical collectives enabled");
+#else
+  DART_LOG_WARN("DART_HIER_COLLECTIVES ignored: shared windows are disabled");
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+}
+
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+
+void dart__mpi__hier_fini(dart_team_data_t * team_data)
+{
+  dart_team_hier_t * hier = team_data->hier;
+  if (hier == NULL) {
+    return;
+  }
+  if (hier->win != MPI_WIN_NULL) {
+    MPI_Win_unlock_all(hier->win);
+    MPI_Win_free(&hier->win);
+  }
+  if (hier->leader_comm != MPI_COMM_NULL) {
+    MPI_Comm_free(&hier->leader_comm);
+  }
+  free(hier->unit_node);
+  free(hier->node_units);
+  free(hier->node_displs);
+  free(hier->slots);
+  free(hier->gather_buf);
+  free(hier->gather_counts);
+  free(hier->gather_displs);
+  free(hier);
+  team_data->hier = NULL;
+}
+
+/**
+ * Create the node leader communicator and the tables of units by node.
+ */
+static
+void dart__mpi__hier_create_nodes(
+  dart_team_data_t * team_data,
+  dart_team_hier_t * hier)
+{
+  MPI_Comm node_comm = team_data->sharedmem_comm;
+  int      size      = team_data->size;
+
+  MPI_Comm_split(
+    team_data->comm, (hier->node_rank == 0) ? 0 : MPI_UNDEFINED,
+    team_data->unitid, &hier->leader_comm);
+
+  int node_info[2] = { 0, 0 };
+  if (hier->node_rank == 0) {
+    MPI_Comm_rank(hier->leader_comm, &node_info[0]);
+    MPI_Comm_size(hier->leader_comm, &node_info[1]);
+  }
+  MPI_Bcast(node_info, 2, MPI_INT, 0, node_comm);
+  hier->node_id   = node_info[0];
+  hier->num_nodes = node_info[1];
+
+  hier->unit_node = malloc(size * sizeof(int));
+  MPI_Allgather(
+    &hier->node_id, 1, MPI_INT, hier->unit_node, 1, MPI_INT,
+    team_data->comm);
+
+  /* Units ordered by node, and by unit ID within nodes: */
+  hier->node_displs = calloc(hier->num_nodes + 1, sizeof(int));
+  for (int u = 0; u < size; ++u) {
+    hier->node_displs[hier->unit_node[u] + 1]++;
+  }
+  for (int n = 0; n < hier->num_nodes; ++n) {
+    hier->node_displs[n + 1] += hier->node_displs[n];
+  }
+  int * node_pos   = malloc(hier->num_nodes * sizeof(int));
+  memcpy(node_pos, hier->node_displs, hier->num_nodes * sizeof(int));
+  hier->node_units = malloc(size * sizeof(int));
+  for (int u = 0; u < size; ++u) {
+    hier->node_units[node_pos[hier->unit_node[u]]++] = u;
+  }
+  free(node_pos);
+
+  if (hier->node_rank == 0 && hier->num_nodes > 1) {
+    hier->gather_buf    = malloc(DART_HIER_RESULT_SIZE);
+    hier->gather_counts = malloc(hier->num_nodes * sizeof(int));
+    hier->gather_displs = malloc(hier->num_nodes * sizeof(int));
+  }
+}
+
+/**
+ * Allocate the shared memory window of the node containing the buffers
+ * of all units and the node leader's flags and result buffer.
+ */
+static
+void dart__mpi__hier_create_window(
+  dart_team_data_t * team_data,
+  dart_team_hier_t * hier)
+{
+  MPI_Comm node_comm = team_data->sharedmem_comm;
+  size_t   ctrl_size = (hier->node_size + 1) * sizeof(dart_hier_flag_t);
+  MPI_Aint win_size  = DART_HIER_SLOT_SIZE;
+  if (hier->node_rank == 0) {
+    win_size += ctrl_size + DART_HIER_RESULT_SIZE;
+  }
+
+  MPI_Info win_info;
+  MPI_Info_create(&win_info);
+  MPI_Info_set(win_info, "alloc_shared_noncontig", "true");
+  char * baseptr;
+  MPI_Win_allocate_shared(
+    win_size, 1, win_info, node_comm, &baseptr, &hier->win);
+  MPI_Info_free(&win_info);
+
+  hier->slots = malloc(hier->node_size * sizeof(char *));
+  for (int r = 0; r < hier->node_size; ++r) {
+    MPI_Aint seg_size;
+    int      disp_unit;
+    char   * seg_base;
+    MPI_Win_shared_query(hier->win, r, &seg_size, &disp_unit, &seg_base);
+    if (r == 0) {
+      hier->arrive   = (dart_hier_flag_t *)seg_base;
+      hier->release  = hier->arrive + hier->node_size;
+      hier->result   = seg_base + ctrl_size;
+      hier->slots[0] = hier->result + DART_HIER_RESULT_SIZE;
+    } else {
+      hier->slots[r] = seg_base;
+    }
+  }
+  if (hier->node_rank == 0) {
+    memset(baseptr, 0, ctrl_size);
+  }
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, hier->win);
+  MPI_Win_sync(hier->win);
+  MPI_Barrier(node_comm);
+}
+
+dart_team_hier_t * dart__mpi__hier_get(dart_team_data_t * team_data)
+{
+  dart_team_hier_t * hier = team_data->hier;
+  if (dart__likely(hier != NULL)) {
+    return (hier->enabled) ? hier : NULL;
+  }
+
+  DART_LOG_DEBUG("dart__mpi__hier_get: creating node hierarchy of team %d",
+                 team_data->teamid);
+  hier              = calloc(1, sizeof(dart_team_hier_t));
+  hier->leader_comm = MPI_COMM_NULL;
+  hier->win         = MPI_WIN_NULL;
+  team_data->hier   = hier;
+
+  MPI_Comm node_comm = team_data->sharedmem_comm;
+  if (node_comm != MPI_COMM_NULL) {
+    MPI_Comm_rank(node_comm, &hier->node_rank);
+    MPI_Comm_size(node_comm, &hier->node_size);
+  }
+  /* Largest number of units on a node, and whether the node of any unit is
+   * unknown: */
+  int node_limits[2] = { hier->node_size, (node_comm == MPI_COMM_NULL) };
+  MPI_Allreduce(
+    MPI_IN_PLACE, node_limits, 2, MPI_INT, MPI_MAX, team_data->comm);
+  if (node_limits[1]) {
+    hier->node_size = 0;
+  }
+  if (node_limits[0] <= 1 || node_limits[1]) {
+    DART_LOG_DEBUG("dart__mpi__hier_get: no hierarchy in team %d "
+                   "(max. node size:%d)", team_data->teamid, node_limits[0]);
+    return NULL;
+  }
+
+  dart__mpi__hier_create_nodes(team_data, hier);
+  dart__mpi__hier_create_window(team_data, hier);
+  hier->enabled = 1;
+
+  DART_LOG_DEBUG("dart__mpi__hier_get > team:%d nodes:%d node:%d "
+                 "node rank:%d node size:%d",
+                 team_data->teamid, hier->num_nodes, hier->node_id,
+                 hier->node_rank, hier->node_size);
+  return hier;
+}
+
+/*
+ * Synchronization of units on a node
+ */
+
+static inline
+void dart__mpi__hier_wait_flag(
+  dart_team_data_t       * team_data,
+  const dart_hier_flag_t * flag,
+  uint64_t                 epoch)
+{
+  int spins = 0;
+  while (__atomic_load_n(&flag->value, __ATOMIC_ACQUIRE) < epoch) {
+    if (++spins == DART_HIER_SPIN_PROGRESS) {
+      // trigger progress of RMA operations targeting this unit
+      int msg_flag;
+      MPI_Iprobe(
+        MPI_ANY_SOURCE, MPI_ANY_TAG,
+        team_data->comm, &msg_flag, MPI_STATUS_IGNORE);
+      sched_yield();
+      spins = 0;
+    }
+  }
+}
+
+/**
+ * Start a new epoch and signal the arrival of the calling unit.
+ * Writes to the unit's buffer are visible to the units on the node once
+ * they have seen the arrival.
+ */
+static inline
+void dart__mpi__hier_arrive(dart_team_hier_t * hier)
+{
+  ++hier->epoch;
+  __atomic_store_n(
+    &hier->arrive[hier->node_rank].value, hier->epoch, __ATOMIC_RELEASE);
+}
+
+static inline
+void dart__mpi__hier_wait_arrivals(dart_team_data_t * team_data)
+{
+  dart_team_hier_t * hier = team_data->hier;
+  for (int r = 0; r < hier->node_size; ++r) {
+    dart__mpi__hier_wait_flag(team_data, &hier->arrive[r], hier->epoch);
+  }
+}
+
+static inline
+void dart__mpi__hier_release(dart_team_hier_t * hier)
+{
+  __atomic_store_n(&hier->release->value, hier->epoch, __ATOMIC_RELEASE);
+}
+
+static inline
+void dart__mpi__hier_wait_release(dart_team_data_t * team_data)
+{
+  dart_team_hier_t * hier = team_data->hier;
+  dart__mpi__hier_wait_flag(team_data, hier->release, hier->epoch);
+}
+
+/*
+ * Collective operations
+ */
+
+dart_ret_t dart__mpi__hier_barrier(dart_team_data_t * team_data)
+{
+  dart_team_hier_t * hier = team_data->hier;
+
+  dart__mpi__hier_arrive(hier);
+  if (hier->node_rank == 0) {
+    dart__mpi__hier_wait_arrivals(team_data);
+    if (hier->num_nodes > 1 &&
+        MPI_Barrier(hier->leader_comm) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart__mpi__hier_barrier ! MPI_Barrier failed");
+      return DART_ERR_OTHER;
+    }
+    dart__mpi__hier_release(hier);
+  } else {
+    dart__mpi__hier_wait_release(team_data);
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__hier_bcast(
+  dart_team_data_t * team_data,
+  void             * buf,
+  size_t             nbytes,
+  dart_team_unit_t   root)
+{
+  dart_team_hier_t * hier      = team_data->hier;
+  int                root_node = hier->unit_node[root.id];
+  int                is_root   = (root.id == team_data->unitid);
+
+  if (is_root) {
+    memcpy(hier->slots[hier->node_rank], buf, nbytes);
+  }
+  dart__mpi__hier_arrive(hier);
+  if (hier->node_rank == 0) {
+    dart__mpi__hier_wait_arrivals(team_data);
+    if (root_node == hier->node_id) {
+      dart_team_unit_t root_node_rank = team_data->sharedmem_tab[root.id];
+      memcpy(hier->result, hier->slots[root_node_rank.id], nbytes);
+    }
+    if (hier->num_nodes > 1 &&
+        MPI_Bcast(hier->result, (int)nbytes, MPI_BYTE, root_node,
+                  hier->leader_comm) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart__mpi__hier_bcast ! MPI_Bcast failed");
+      return DART_ERR_OTHER;
+    }
+    dart__mpi__hier_release(hier);
+  } else {
+    dart__mpi__hier_wait_release(team_data);
+  }
+  if (!is_root) {
+    memcpy(buf, hier->result, nbytes);
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__hier_allreduce(
+  dart_team_data_t * team_data,
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nbytes,
+  int                nelem,
+  MPI_Datatype       mpi_dtype,
+  MPI_Op             mpi_op)
+{
+  dart_team_hier_t * hier = team_data->hier;
+
+  if (sendbuf == MPI_IN_PLACE) {
+    sendbuf = recvbuf;
+  }
+  memcpy(hier->slots[hier->node_rank], sendbuf, nbytes);
+  dart__mpi__hier_arrive(hier);
+  if (hier->node_rank == 0) {
+    dart__mpi__hier_wait_arrivals(team_data);
+    /* Combine contributions of the node in order of node ranks */
+    memcpy(hier->result, hier->slots[hier->node_size - 1], nbytes);
+    for (int r = hier->node_size - 2; r >= 0; --r) {
+      MPI_Reduce_local(
+        hier->slots[r], hier->result, nelem, mpi_dtype, mpi_op);
+    }
+    if (hier->num_nodes > 1 &&
+        MPI_Allreduce(MPI_IN_PLACE, hier->result, nelem, mpi_dtype, mpi_op,
+                      hier->leader_comm) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart__mpi__hier_allreduce ! MPI_Allreduce failed");
+      return DART_ERR_OTHER;
+    }
+    dart__mpi__hier_release(hier);
+  } else {
+    dart__mpi__hier_wait_release(team_data);
+  }
+  memcpy(recvbuf, hier->result, nbytes);
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__hier_allgather(
+  dart_team_data_t * team_data,
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nbytes)
+{
+  dart_team_hier_t * hier   = team_data->hier;
+  const int        * units  = hier->node_units +
+                              hier->node_displs[hier->node_id];
+
+  if (sendbuf == MPI_IN_PLACE) {
+    sendbuf = (char *)recvbuf + team_data->unitid * nbytes;
+  }
+  memcpy(hier->slots[hier->node_rank], sendbuf, nbytes);
+  dart__mpi__hier_arrive(hier);
+  if (hier->node_rank == 0) {
+    dart__mpi__hier_wait_arrivals(team_data);
+    if (hier->num_nodes == 1) {
+      for (int r = 0; r < hier->node_size; ++r) {
+        memcpy(hier->result + units[r] * nbytes, hier->slots[r], nbytes);
+      }
+    } else {
+      /* Gather contributions ordered by node, then restore unit order */
+      for (int n = 0; n < hier->num_nodes; ++n) {
+        hier->gather_displs[n] = hier->node_displs[n] * nbytes;
+        hier->gather_counts[n] = (hier->node_displs[n + 1] -
+                                  hier->node_displs[n]) * nbytes;
+      }
+      char * node_buf = hier->gather_buf +
+                        hier->gather_displs[hier->node_id];
+      for (int r = 0; r < hier->node_size; ++r) {
+        memcpy(node_buf + r * nbytes, hier->slots[r], nbytes);
+      }
+      if (MPI_Allgatherv(
+            MPI_IN_PLACE, 0, MPI_DATATYPE_NULL,
+            hier->gather_buf, hier->gather_counts, hier->gather_displs,
+            MPI_BYTE, hier->leader_comm) != MPI_SUCCESS) {
+        DART_LOG_ERROR("dart__mpi__hier_allgather ! MPI_Allgatherv failed");
+        return DART_ERR_OTHER;
+      }
+      for (int i = 0; i < team_data->size; ++i) {
+        memcpy(hier->result + hier->node_units[i] * nbytes,
+               hier->gather_buf + i * nbytes, nbytes);
+      }
+    }
+    dart__mpi__hier_release(hier);
+  } else {
+    dart__mpi__hier_wait_release(team_data);
+  }
+  memcpy(recvbuf, hier->result, team_data->size * nbytes);
+  return DART_OK;
+}
+
+/*
+ * Split-phase node barrier
+ */
+
+dart_ret_t dart__mpi__hier_node_arrive(dart_team_data_t * team_data)
+{
+  dart_team_hier_t * hier = dart__mpi__hier_get(team_data);
+  if (hier != NULL) {
+    dart__mpi__hier_arrive(hier);
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__hier_node_wait(dart_team_data_t * team_data)
+{
+  dart_team_hier_t * hier = dart__mpi__hier_get(team_data);
+  if (hier != NULL) {
+    dart__mpi__hier_wait_arrivals(team_data);
+  } else if (team_data->hier->node_size == 0) {
+    /* Units on the node are unknown, synchronize the whole team */
+    if (MPI_Barrier(team_data->comm) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart__mpi__hier_node_wait ! MPI_Barrier failed");
+      return DART_ERR_OTHER;
+    }
+  }
+  return DART_OK;
+}
+
+#else // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+
+void dart__mpi__hier_fini(dart_team_data_t * team_data)
+{
+  dart__unused(team_data);
+}
+
+dart_team_hier_t * dart__mpi__hier_get(dart_team_data_t * team_data)
+{
+  dart__unused(team_data);
+  return NULL;
+}
+
+dart_ret_t dart__mpi__hier_barrier(dart_team_data_t * team_data)
+{
+  dart__unused(team_data);
+  return DART_ERR_INVAL;
+}
+
+dart_ret_t dart__mpi__hier_bcast(
+  dart_team_data_t * team_data,
+  void             * buf,
+  size_t             nbytes,
+  dart_team_unit_t   root)
+{
+  dart__unused(team_data);
+  dart__unused(buf);
+  dart__unused(nbytes);
+  dart__unused(root);
+  return DART_ERR_INVAL;
+}
+
+dart_ret_t dart__mpi__hier_allreduce(
+  dart_team_data_t * team_data,
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nbytes,
+  int                nelem,
+  MPI_Datatype       mpi_dtype,
+  MPI_Op             mpi_op)
+{
+  dart__unused(team_data);
+  dart__unused(sendbuf);
+  dart__unused(recvbuf);
+  dart__unused(nbytes);
+  dart__unused(nelem);
+  dart__unused(mpi_dtype);
+  dart__unused(mpi_op);
+  return DART_ERR_INVAL;
+}
+
+dart_ret_t dart__mpi__hier_allgather(
+  dart_team_data_t * team_data,
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nbytes)
+{
+  dart__unused(team_data);
+  dart__unused(sendbuf);
+  dart__unused(recvbuf);
+  dart__unused(nbytes);
+  return DART_ERR_INVAL;
+}
+
+dart_ret_t dart__mpi__hier_node_arrive(dart_team_data_t * team_data)
+{
+  dart__unused(team_data);
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__hier_node_wait(dart_team_data_t * team_data)
+{
+  /* Units on the node are unknown, synchronize the whole team */
+  if (MPI_Barrier(team_data->comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__mpi__hier_node_wait ! MPI_Barrier failed");
+    return DART_ERR_OTHER;
+  }
+  return DART_OK;
+}
+
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
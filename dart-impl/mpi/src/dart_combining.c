@@ -0,0 +1,632 @@
+/**
+ * \file dart_combining.c
+ *
+ * Write-combining buffers of fine-grained puts and accumulates.
+ *
+ * Small puts and accumulates to units that are not accessible in shared
+ * memory are collected in a buffer per target unit, segment and kind of
+ * update. The pending updates of a buffer are sorted by target offset,
+ * updates of the same element are combined and runs of adjacent elements
+ * are merged. The buffer is then transferred in a single \c MPI_Put or
+ * \c MPI_Accumulate with an hindexed target data type.
+ *
+ * At most one buffer of a target unit and segment holds pending updates:
+ * before an update of another kind is buffered, the pending updates of the
+ * target are transferred, so updates are applied in the order they were
+ * issued.
+ */
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_communication.h>
+
+#include <dash/dart/mpi/dart_combining_priv.h>
+#include <dash/dart/mpi/dart_communication_priv.h>
+#include <dash/dart/mpi/dart_team_private.h>
+#include <dash/dart/mpi/dart_segment.h>
+#include <dash/dart/mpi/dart_stats_priv.h>
+
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/mutex.h>
+
+#include <mpi.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Default capacity of a write-combining buffer in bytes */
+#define DART_COMBINING_DEFAULT_SIZE  65536
+/** Maximum size in bytes of puts and accumulates that are buffered */
+#define DART_COMBINING_MAX_NBYTES    64
+/** Initial number of elements allocated in a buffer */
+#define DART_COMBINING_INIT_ELEMS    64
+/** Number of hash buckets of buffers, must be a power of two */
+#define DART_COMBINING_NUM_BUCKETS   256
+
+typedef struct dart_combining_buffer_s
+{
+  struct dart_combining_buffer_s * next;
+  dart_team_t                      teamid;
+  int16_t                          segid;
+  dart_team_unit_t                 unitid;
+  /* Accumulate operation, DART_OP_UNDEFINED for puts */
+  dart_operation_t                 op;
+  /* Element type of accumulates, DART_TYPE_BYTE for puts */
+  dart_datatype_t                  dtype;
+  /* Size of an element in bytes, the size of a single put for puts */
+  size_t                           elem_size;
+  size_t                           count;
+  size_t                           capacity;
+  uint64_t                       * offsets;
+  char                           * values;
+} dart_combining_buffer_t;
+
+typedef struct
+{
+  uint64_t offset;
+  size_t   idx;
+} dart_combining_entry_t;
+
+int dart__mpi__combining_pending_ = 0;
+
+/* Capacity of a buffer in bytes, 0 if write-combining is disabled: */
+static size_t                    dart__mpi__combining_size_ =
+                                   DART_COMBINING_DEFAULT_SIZE;
+static dart_combining_buffer_t * dart__mpi__combining_buckets_[
+                                   DART_COMBINING_NUM_BUCKETS];
+static dart_mutex_t              dart__mpi__combining_mutex_ =
+                                   DART_MUTEX_INITIALIZER;
+
+static inline
+size_t dart__mpi__combining_bucket(
+  dart_team_t      teamid,
+  int16_t          segid,
+  dart_team_unit_t unitid)
+{
+  size_t hash = ((size_t)teamid * 31 + (uint16_t)segid) * 131 + unitid.id;
+  return hash & (DART_COMBINING_NUM_BUCKETS - 1);
+}
+
+/**
+ * Whether updates of the given target are transferred with MPI, updates
+ * of the calling unit are not buffered. Puts to units in shared memory are
+ * copied directly, accumulates only if shared memory atomics are enabled.
+ */
+static inline
+bool dart__mpi__combining_is_remote(
+  const dart_team_data_t    * team_data,
+  const dart_segment_info_t * seginfo,
+  dart_team_unit_t            unitid,
+  bool                        is_put)
+{
+  if (team_data->unitid == unitid.id) {
+    return false;
+  }
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if ((is_put || dart_config_.shmem_atomics) &&
+      seginfo->segid >= 0 && team_data->sharedmem_tab[unitid.id].id >= 0) {
+    return false;
+  }
+#else
+  dart__unused(seginfo);
+  dart__unused(is_put);
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  return true;
+}
+
+static int dart__mpi__combining_entry_cmp(const void * lhs, const void * rhs)
+{
+  const dart_combining_entry_t * a = (const dart_combining_entry_t *)lhs;
+  const dart_combining_entry_t * b = (const dart_combining_entry_t *)rhs;
+  if (a->offset != b->offset) {
+    return (a->offset < b->offset) ? -1 : 1;
+  }
+  // retain the order of updates of the same element:
+  return (a->idx < b->idx) ? -1 : (a->idx > b->idx);
+}
+
+static dart_combining_buffer_t * dart__mpi__combining_buffer(
+  dart_team_t      teamid,
+  int16_t          segid,
+  dart_team_unit_t unitid,
+  dart_operation_t op,
+  dart_datatype_t  dtype,
+  size_t           elem_size)
+{
+  size_t bucket = dart__mpi__combining_bucket(teamid, segid, unitid);
+  dart_combining_buffer_t * buf;
+  for (buf = dart__mpi__combining_buckets_[bucket];
+       buf != NULL; buf = buf->next) {
+    if (buf->teamid    == teamid    && buf->segid == segid &&
+        buf->unitid.id == unitid.id && buf->op    == op    &&
+        buf->dtype     == dtype     && buf->elem_size == elem_size) {
+      return buf;
+    }
+  }
+  buf = calloc(1, sizeof(dart_combining_buffer_t));
+  if (buf == NULL) {
+    return NULL;
+  }
+  buf->teamid    = teamid;
+  buf->segid     = segid;
+  buf->unitid    = unitid;
+  buf->op        = op;
+  buf->dtype     = dtype;
+  buf->elem_size = elem_size;
+  buf->next      = dart__mpi__combining_buckets_[bucket];
+  dart__mpi__combining_buckets_[bucket] = buf;
+  return buf;
+}
+
+static void dart__mpi__combining_buffer_free(dart_combining_buffer_t * buf)
+{
+  if (buf->count > 0) {
+    __atomic_fetch_sub(&dart__mpi__combining_pending_, 1, __ATOMIC_RELAXED);
+  }
+  free(buf->offsets);
+  free(buf->values);
+  free(buf);
+}
+
+/**
+ * Transfer the pending updates of a buffer and wait for completion before
+ * the packed values are released. Must be called with the buffer mutex
+ * held.
+ */
+static dart_ret_t dart__mpi__combining_buffer_transfer(
+  dart_combining_buffer_t   * buf,
+  const dart_team_data_t    * team_data,
+  const dart_segment_info_t * seginfo)
+{
+  const size_t count     = buf->count;
+  const size_t elem_size = buf->elem_size;
+  const bool   is_put    = (buf->op == DART_OP_UNDEFINED);
+
+  if (count == 0) {
+    return DART_OK;
+  }
+  DART_LOG_TRACE("dart__mpi__combining_buffer_transfer: "
+                 "unit:%d segid:%d team:%d count:%zu elem_size:%zu put:%d",
+                 buf->unitid.id, buf->segid, buf->teamid, count, elem_size,
+                 is_put);
+
+  dart_combining_entry_t * entries   = malloc(
+                                         count * sizeof(*entries));
+  char                   * packed    = malloc(count * elem_size);
+  int                    * blocklens = malloc(count * sizeof(int));
+  MPI_Aint               * displs    = malloc(count * sizeof(MPI_Aint));
+  if (entries == NULL || packed == NULL ||
+      blocklens == NULL || displs == NULL) {
+    DART_LOG_ERROR("dart__mpi__combining_buffer_transfer ! "
+                   "Failed to allocate %zu elements", count);
+    free(entries);
+    free(packed);
+    free(blocklens);
+    free(displs);
+    return DART_ERR_OTHER;
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    entries[i].offset = buf->offsets[i];
+    entries[i].idx    = i;
+  }
+  qsort(entries, count, sizeof(*entries), &dart__mpi__combining_entry_cmp);
+
+  // Puts are transferred as bytes, accumulates in their element type:
+  MPI_Datatype mpi_type  = MPI_BYTE;
+  MPI_Op       mpi_op    = MPI_REPLACE;
+  int          elem_len  = (int)elem_size;
+  if (!is_put) {
+    mpi_type = dart__mpi__datatype_struct(buf->dtype)->contiguous.mpi_type;
+    mpi_op   = dart__mpi__op(buf->op, buf->dtype);
+    elem_len = 1;
+  }
+
+  const uint64_t base    = entries[0].offset;
+  size_t         npacked = 0;
+  int            nblocks = 0;
+  for (size_t i = 0; i < count; ++npacked) {
+    const uint64_t offset = entries[i].offset;
+    char         * dst    = packed + npacked * elem_size;
+    memcpy(dst, buf->values + entries[i].idx * elem_size, elem_size);
+    // combine updates of the same element:
+    for (++i; i < count && entries[i].offset == offset; ++i) {
+      const char * src = buf->values + entries[i].idx * elem_size;
+      if (is_put || buf->op == DART_OP_REPLACE) {
+        memcpy(dst, src, elem_size);
+      } else {
+        MPI_Reduce_local(src, dst, 1, mpi_type, mpi_op);
+      }
+    }
+    // merge runs of adjacent elements:
+    if (nblocks > 0 &&
+        (uint64_t)(displs[nblocks-1]) +
+          (uint64_t)(blocklens[nblocks-1] / elem_len) * elem_size
+        == offset - base) {
+      blocklens[nblocks-1] += elem_len;
+    } else {
+      displs[nblocks]    = (MPI_Aint)(offset - base);
+      blocklens[nblocks] = elem_len;
+      ++nblocks;
+    }
+  }
+
+  dart_team_unit_t unitid       = buf->unitid;
+  MPI_Win          win          = seginfo->win;
+  MPI_Aint         disp         = dart_segment_disp(seginfo, unitid) + base;
+  int              origin_count = (int)npacked * elem_len;
+  MPI_Datatype     target_type  = mpi_type;
+  int              target_count = origin_count;
+  dart_ret_t       ret          = DART_OK;
+
+  if (nblocks > 1) {
+    MPI_Type_create_hindexed(
+      nblocks, blocklens, displs, mpi_type, &target_type);
+    MPI_Type_commit(&target_type);
+    target_count = 1;
+  }
+
+  DART_LOG_TRACE("dart__mpi__combining_buffer_transfer: "
+                 "%zu elements in %d blocks to unit %d",
+                 npacked, nblocks, unitid.id);
+
+  int mpi_ret;
+  if (is_put) {
+    mpi_ret = MPI_Put(packed, origin_count, mpi_type,
+                      unitid.id, disp, target_count, target_type, win);
+  } else {
+    mpi_ret = MPI_Accumulate(packed, origin_count, mpi_type,
+                             unitid.id, disp, target_count, target_type,
+                             mpi_op, win);
+  }
+  if (mpi_ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__mpi__combining_buffer_transfer ! "
+                   "%s failed", is_put ? "MPI_Put" : "MPI_Accumulate");
+    ret = DART_ERR_OTHER;
+  } else if (MPI_Win_flush(unitid.id, win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__mpi__combining_buffer_transfer ! "
+                   "MPI_Win_flush failed");
+    ret = DART_ERR_OTHER;
+  }
+
+  if (nblocks > 1) {
+    MPI_Type_free(&target_type);
+  }
+  free(entries);
+  free(packed);
+  free(blocklens);
+  free(displs);
+
+  buf->count = 0;
+  __atomic_fetch_sub(&dart__mpi__combining_pending_, 1, __ATOMIC_RELAXED);
+
+  DART__MPI__STATS_RECORD(
+    is_put ? DART_STATS_PUT : DART_STATS_ACCUMULATE, DART_STATS_PATH_MPI,
+    npacked * elem_size,
+    (team_data->teamid == DART_TEAM_ALL)
+      ? unitid.id : team_data->unit_l2g[unitid.id].id);
+
+  return ret;
+}
+
+/**
+ * Transfer the pending updates of a target unit and segment that are
+ * buffered for another kind of update than the given one, to retain the
+ * order of updates to the target. Must be called with the buffer mutex
+ * held.
+ */
+static dart_ret_t dart__mpi__combining_transfer_other(
+  const dart_team_data_t    * team_data,
+  const dart_segment_info_t * seginfo,
+  dart_team_unit_t            unitid,
+  dart_operation_t            op,
+  dart_datatype_t             dtype,
+  size_t                      elem_size)
+{
+  dart_ret_t ret    = DART_OK;
+  size_t     bucket = dart__mpi__combining_bucket(
+                        team_data->teamid, seginfo->segid, unitid);
+  dart_combining_buffer_t * buf;
+  for (buf = dart__mpi__combining_buckets_[bucket];
+       buf != NULL; buf = buf->next) {
+    if (buf->count > 0 &&
+        buf->teamid    == team_data->teamid && buf->segid == seginfo->segid &&
+        buf->unitid.id == unitid.id &&
+        (buf->op != op || buf->dtype != dtype ||
+         buf->elem_size != elem_size)) {
+      dart_ret_t buf_ret = dart__mpi__combining_buffer_transfer(
+                             buf, team_data, seginfo);
+      if (buf_ret != DART_OK) {
+        ret = buf_ret;
+      }
+    }
+  }
+  return ret;
+}
+
+/**
+ * Append \c nelem elements at consecutive offsets to a buffer and transfer
+ * the buffer if its capacity is exceeded.
+ */
+static dart_ret_t dart__mpi__combining_append(
+  dart_team_data_t    * team_data,
+  dart_segment_info_t * seginfo,
+  dart_team_unit_t      unitid,
+  uint64_t              offset,
+  const void          * values,
+  size_t                nelem,
+  dart_operation_t      op,
+  dart_datatype_t       dtype,
+  size_t                elem_size)
+{
+  dart_ret_t   ret       = DART_OK;
+  size_t       max_elems = dart__mpi__combining_size_ / elem_size;
+  const char * src       = (const char *)values;
+
+  dart__base__mutex_lock(&dart__mpi__combining_mutex_);
+
+  ret = dart__mpi__combining_transfer_other(
+          team_data, seginfo, unitid, op, dtype, elem_size);
+  if (ret != DART_OK) {
+    dart__base__mutex_unlock(&dart__mpi__combining_mutex_);
+    return ret;
+  }
+
+  dart_combining_buffer_t * buf = dart__mpi__combining_buffer(
+                                    team_data->teamid, seginfo->segid,
+                                    unitid, op, dtype, elem_size);
+  if (buf == NULL) {
+    dart__base__mutex_unlock(&dart__mpi__combining_mutex_);
+    return DART_ERR_OTHER;
+  }
+  // Elements of a buffer either match or do not overlap, an element that
+  // partially overlaps pending elements is only buffered after these have
+  // been transferred:
+  if (buf->count > 0 && (offset - buf->offsets[0]) % elem_size != 0) {
+    ret = dart__mpi__combining_buffer_transfer(buf, team_data, seginfo);
+  }
+
+  for (size_t i = 0; i < nelem && ret == DART_OK; ++i) {
+    if (buf->count == buf->capacity) {
+      size_t capacity = (buf->capacity == 0)
+                        ? DART_COMBINING_INIT_ELEMS
+                        : 2 * buf->capacity;
+      if (capacity > max_elems) {
+        capacity = max_elems;
+      }
+      uint64_t * offsets = realloc(buf->offsets, capacity * sizeof(uint64_t));
+      if (offsets != NULL) {
+        buf->offsets = offsets;
+      }
+      char * vals = realloc(buf->values, capacity * elem_size);
+      if (vals != NULL) {
+        buf->values = vals;
+      }
+      if (offsets == NULL || vals == NULL) {
+        DART_LOG_ERROR("dart__mpi__combining_append ! "
+                       "Failed to allocate %zu elements", capacity);
+        ret = DART_ERR_OTHER;
+        break;
+      }
+      buf->capacity = capacity;
+    }
+    if (buf->count == 0) {
+      __atomic_fetch_add(&dart__mpi__combining_pending_, 1, __ATOMIC_RELAXED);
+    }
+    buf->offsets[buf->count] = offset + i * elem_size;
+    memcpy(buf->values + buf->count * elem_size,
+           src + i * elem_size, elem_size);
+    if (++buf->count >= max_elems) {
+      ret = dart__mpi__combining_buffer_transfer(buf, team_data, seginfo);
+    }
+  }
+
+  dart__base__mutex_unlock(&dart__mpi__combining_mutex_);
+  return ret;
+}
+
+dart_ret_t dart__mpi__combining_init()
+{
+  const char * env_size = getenv("DART_COMBINING_BUFFER_SIZE");
+  if (env_size != NULL) {
+    dart__mpi__combining_size_ = strtoull(env_size, NULL, 10);
+  }
+  DART_LOG_DEBUG("dart__mpi__combining_init: buffer size:%zu",
+                 dart__mpi__combining_size_);
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__combining_fini()
+{
+  dart__base__mutex_lock(&dart__mpi__combining_mutex_);
+  for (int bucket = 0; bucket < DART_COMBINING_NUM_BUCKETS; ++bucket) {
+    dart_combining_buffer_t * buf = dart__mpi__combining_buckets_[bucket];
+    while (buf != NULL) {
+      dart_combining_buffer_t * next = buf->next;
+      if (buf->count > 0) {
+        DART_LOG_WARN("dart__mpi__combining_fini: dropping %zu pending "
+                      "updates of unit %d in segment %d",
+                      buf->count, buf->unitid.id, buf->segid);
+      }
+      dart__mpi__combining_buffer_free(buf);
+      buf = next;
+    }
+    dart__mpi__combining_buckets_[bucket] = NULL;
+  }
+  dart__base__mutex_unlock(&dart__mpi__combining_mutex_);
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__combining_transfer(
+  dart_team_data_t    * team_data,
+  dart_segment_info_t * seginfo,
+  int                   unitid)
+{
+  dart_ret_t ret = DART_OK;
+  int        first_bucket = 0;
+  int        last_bucket  = DART_COMBINING_NUM_BUCKETS - 1;
+  if (unitid >= 0) {
+    first_bucket = last_bucket = dart__mpi__combining_bucket(
+                                   team_data->teamid, seginfo->segid,
+                                   DART_TEAM_UNIT_ID(unitid));
+  }
+
+  dart__base__mutex_lock(&dart__mpi__combining_mutex_);
+  for (int bucket = first_bucket; bucket <= last_bucket; ++bucket) {
+    dart_combining_buffer_t * buf;
+    for (buf = dart__mpi__combining_buckets_[bucket];
+         buf != NULL; buf = buf->next) {
+      if (buf->count > 0 &&
+          buf->teamid == team_data->teamid && buf->segid == seginfo->segid &&
+          (unitid < 0 || buf->unitid.id == unitid)) {
+        dart_ret_t buf_ret = dart__mpi__combining_buffer_transfer(
+                               buf, team_data, seginfo);
+        if (buf_ret != DART_OK) {
+          ret = buf_ret;
+        }
+      }
+    }
+  }
+  dart__base__mutex_unlock(&dart__mpi__combining_mutex_);
+  return ret;
+}
+
+void dart__mpi__combining_discard(
+  dart_team_t teamid,
+  int16_t     segid)
+{
+  dart__base__mutex_lock(&dart__mpi__combining_mutex_);
+  for (int bucket = 0; bucket < DART_COMBINING_NUM_BUCKETS; ++bucket) {
+    dart_combining_buffer_t ** link = &dart__mpi__combining_buckets_[bucket];
+    while (*link != NULL) {
+      dart_combining_buffer_t * buf = *link;
+      if (buf->teamid == teamid && buf->segid == segid) {
+        if (buf->count > 0) {
+          DART_LOG_WARN("dart__mpi__combining_discard: dropping %zu "
+                        "pending updates of unit %d in freed segment %d",
+                        buf->count, buf->unitid.id, segid);
+        }
+        *link = buf->next;
+        dart__mpi__combining_buffer_free(buf);
+      } else {
+        link = &buf->next;
+      }
+    }
+  }
+  dart__base__mutex_unlock(&dart__mpi__combining_mutex_);
+}
+
+dart_ret_t dart_put_combining(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nelem,
+  dart_datatype_t   dtype)
+{
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+
+  if (dart__unlikely(!dart__mpi__datatype_iscontiguous(dtype))) {
+    DART_LOG_ERROR("dart_put_combining ! Only contiguous data types allowed");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_put_combining ! failed: Unknown team %i!",
+                   gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+  if (dart__unlikely(team_unit_id.id < 0 ||
+                     team_unit_id.id >= team_data->size)) {
+    DART_LOG_ERROR("dart_put_combining ! failed: unitid out of range 0 <= "
+                   "%d < %d", team_unit_id.id, team_data->size);
+    return DART_ERR_INVAL;
+  }
+
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+      &(team_data->segdata), gptr.segid);
+  if (dart__unlikely(seginfo == NULL)) {
+    DART_LOG_ERROR("dart_put_combining ! "
+        "Unknown segment %i on team %i", gptr.segid, gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+
+  size_t nbytes = nelem * dart__mpi__datatype_sizeof(dtype);
+  if (nbytes == 0 || nbytes > DART_COMBINING_MAX_NBYTES ||
+      nbytes > dart__mpi__combining_size_) {
+    // pending puts to the target must not overwrite this put:
+    dart_ret_t ret = dart__mpi__combining_flush(
+                       team_data, seginfo, team_unit_id.id);
+    if (ret == DART_OK) {
+      ret = dart_put(gptr, src, nelem, dtype, dtype);
+    }
+    // the source buffer must be reusable on return:
+    return (ret == DART_OK) ? dart_flush_local(gptr) : ret;
+  }
+
+  if (!dart__mpi__combining_is_remote(
+         team_data, seginfo, team_unit_id, true)) {
+    // copied in local or shared memory:
+    return dart_put(gptr, src, nelem, dtype, dtype);
+  }
+
+  DART__MPI__STATS_RECORD(
+    DART_STATS_PUT_COMBINING, DART_STATS_PATH_MPI, nbytes, -1);
+
+  // every put is a single element of its size in the buffer:
+  return dart__mpi__combining_append(
+           team_data, seginfo, team_unit_id, gptr.addr_or_offs.offset,
+           src, 1, DART_OP_UNDEFINED, DART_TYPE_BYTE, nbytes);
+}
+
+dart_ret_t dart_accumulate_combining(
+  dart_gptr_t      gptr,
+  const void     * values,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op)
+{
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+
+  // only predefined operations can be applied locally:
+  if (op < DART_OP_MIN || op > DART_OP_REPLACE || op == DART_OP_MINMAX ||
+      !dart__mpi__datatype_isbasic(dtype)) {
+    return dart_accumulate_blocking_local(gptr, values, nelem, dtype, op);
+  }
+
+  size_t elem_size = dart__mpi__datatype_sizeof(dtype);
+  size_t nbytes    = nelem * elem_size;
+  if (nbytes == 0 || nbytes > DART_COMBINING_MAX_NBYTES ||
+      nbytes > dart__mpi__combining_size_) {
+    return dart_accumulate_blocking_local(gptr, values, nelem, dtype, op);
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_accumulate_combining ! failed: Unknown team %i!",
+                   gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+  if (dart__unlikely(team_unit_id.id < 0 ||
+                     team_unit_id.id >= team_data->size)) {
+    DART_LOG_ERROR("dart_accumulate_combining ! failed: unitid out of range "
+                   "0 <= %d < %d", team_unit_id.id, team_data->size);
+    return DART_ERR_INVAL;
+  }
+
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+      &(team_data->segdata), gptr.segid);
+  if (dart__unlikely(seginfo == NULL)) {
+    DART_LOG_ERROR("dart_accumulate_combining ! "
+        "Unknown segment %i on team %i", gptr.segid, gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (!dart__mpi__combining_is_remote(
+         team_data, seginfo, team_unit_id, false)) {
+    return dart_accumulate_blocking_local(gptr, values, nelem, dtype, op);
+  }
+
+  DART__MPI__STATS_RECORD(
+    DART_STATS_ACCUMULATE_COMBINING, DART_STATS_PATH_MPI, nbytes, -1);
+
+  return dart__mpi__combining_append(
+           team_data, seginfo, team_unit_id, gptr.addr_or_offs.offset,
+           values, nelem, op, dtype, elem_size);
+}
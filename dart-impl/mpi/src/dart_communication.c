@@ -19,11 +19,15 @@
 #include <dash/dart/mpi/dart_mpi_util.h>
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
+#include <dash/dart/mpi/dart_stats_priv.h>
+#include <dash/dart/mpi/dart_combining_priv.h>
+#include <dash/dart/mpi/dart_collective_hier_priv.h>
 
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/math.h>
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <mpi.h>
 #include <string.h>
 #include <limits.h>
@@ -118,6 +122,77 @@ struct dart_handle_struct
   } while (0)
 
 
+/**
+ * Transfer path of a one-sided operation on contiguous data, as selected
+ * in \c dart__mpi__get_basic and \c dart__mpi__put_basic.
+ */
+static inline
+dart_stats_path_t dart__mpi__stats_path(
+    const dart_team_data_t    * team_data,
+    dart_team_unit_t            team_unit_id,
+    const dart_segment_info_t * seginfo)
+{
+  if (team_data->unitid == team_unit_id.id) {
+    return DART_STATS_PATH_LOCAL;
+  }
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (seginfo->segid >= 0 &&
+      team_data->sharedmem_tab[team_unit_id.id].id >= 0) {
+    return DART_STATS_PATH_SHMEM;
+  }
+#else
+  (void)seginfo;
+#endif
+  return DART_STATS_PATH_MPI;
+}
+
+/**
+ * Global unit ID of a team-relative unit ID, used as index in the target
+ * histogram of the statistics counters.
+ */
+static inline
+int dart__mpi__stats_target(
+    const dart_team_data_t    * team_data,
+    dart_team_unit_t            team_unit_id)
+{
+  return (team_data->teamid == DART_TEAM_ALL)
+         ? team_unit_id.id
+         : team_data->unit_l2g[team_unit_id.id].id;
+}
+
+static inline
+size_t dart__mpi__stats_nbytes(
+    size_t                      nelem,
+    dart_datatype_t             dtype)
+{
+  return nelem * dart__mpi__datatype_sizeof(dart__mpi__datatype_base(dtype));
+}
+
+/**
+ * Record statistics counters of a one-sided operation, operations on
+ * derived data types and atomic operations always use MPI.
+ */
+#define DART__MPI__STATS_ONESIDED(                                        \
+          _op, _team_data, _unit, _seginfo, _basic, _nelem, _dtype)       \
+  do {                                                                    \
+    if (dart__unlikely(dart__mpi__stats_enabled_)) {                      \
+      dart__mpi__stats_record(                                            \
+        (_op),                                                            \
+        (_basic) ? dart__mpi__stats_path((_team_data), (_unit), (_seginfo))\
+                 : DART_STATS_PATH_MPI,                                   \
+        dart__mpi__stats_nbytes((_nelem), (_dtype)),                      \
+        dart__mpi__stats_target((_team_data), (_unit)));                  \
+    }                                                                     \
+  } while (0)
+
+/**
+ * Record statistics counters of a collective operation.
+ */
+#define DART__MPI__STATS_COLLECTIVE(_op, _nelem, _dtype)                  \
+  DART__MPI__STATS_RECORD(                                                \
+    (_op), DART_STATS_PATH_MPI,                                           \
+    ((_nelem) > 0) ? dart__mpi__stats_nbytes((_nelem), (_dtype)) : 0, -1)
+
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 static dart_ret_t get_shared_mem(
     const dart_team_data_t    * team_data,
@@ -162,6 +237,223 @@ static dart_ret_t put_shared_mem(
 }
 #endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 
+/*
+ * Atomic operations in shared memory windows
+ *
+ * If enabled in the runtime configuration, atomic operations on units on
+ * the same node are performed with processor atomics on the shared memory
+ * window instead of MPI RMA atomics.
+ */
+
+static bool dart__mpi__win_unified(MPI_Win win)
+{
+  int *mem_model, flag;
+  MPI_Win_get_attr(win, MPI_WIN_MODEL, &mem_model, &flag);
+  return (flag != 0 && *mem_model == MPI_WIN_UNIFIED);
+}
+
+void dart__mpi__shmem_atomics_init(MPI_Win win, MPI_Win local_win)
+{
+  dart_config_.shmem_atomics = 0;
+
+  const char * env_atomics = getenv("DART_SHMEM_ATOMICS");
+  if (env_atomics == NULL ||
+      (strcmp(env_atomics, "1") != 0 && strcmp(env_atomics, "on") != 0)) {
+    return;
+  }
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  int enabled = dart__mpi__win_unified(win) &&
+                dart__mpi__win_unified(local_win);
+  /* All units have to agree on the mode of atomic operations */
+  MPI_Allreduce(
+    MPI_IN_PLACE, &enabled, 1, MPI_INT, MPI_MIN, DART_COMM_WORLD);
+  if (!enabled) {
+    DART_LOG_WARN("DART_SHMEM_ATOMICS ignored: MPI windows do not use the "
+                  "unified memory model");
+    return;
+  }
+  dart_config_.shmem_atomics = 1;
+  DART_LOG_DEBUG("dart__mpi__shmem_atomics_init: atomic operations in "
+                 "shared memory windows enabled");
+#else
+  dart__unused(win);
+  dart__unused(local_win);
+  DART_LOG_WARN("DART_SHMEM_ATOMICS ignored: shared windows are disabled");
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+}
+
+/**
+ * Address of the target element in the shared memory window if atomic
+ * operations on it are performed in shared memory, otherwise NULL.
+ */
+static inline
+char * dart__mpi__shmem_atomic_addr(
+    const dart_team_data_t    * team_data,
+    const dart_segment_info_t * seginfo,
+    dart_team_unit_t            team_unit_id,
+    uint64_t                    offset)
+{
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (dart_config_.shmem_atomics &&
+      seginfo->segid >= 0 && seginfo->baseptr != NULL &&
+      team_data->sharedmem_tab[team_unit_id.id].id >= 0) {
+    dart_team_unit_t luid = team_data->sharedmem_tab[team_unit_id.id];
+    return seginfo->baseptr[luid.id] + offset;
+  }
+#else
+  dart__unused(team_data);
+  dart__unused(seginfo);
+  dart__unused(team_unit_id);
+  dart__unused(offset);
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  return NULL;
+}
+
+#define DART__MPI__SHMEM_INT_OPS                                          \
+          case DART_OP_BAND: new_ = old_ & value_;                 break; \
+          case DART_OP_BOR:  new_ = old_ | value_;                 break; \
+          case DART_OP_BXOR: new_ = old_ ^ value_;                 break; \
+          case DART_OP_LAND: new_ = old_ && value_;                break; \
+          case DART_OP_LOR:  new_ = old_ || value_;                break; \
+          case DART_OP_LXOR: new_ = (!old_) != (!value_);          break;
+
+#define DART__MPI__SHMEM_FETCH_OP(_type, _int_ops)                        \
+  do {                                                                    \
+    _type * target_ = (_type *)target;                                    \
+    _type   value_  = *(const _type *)value;                              \
+    _type   old_;                                                         \
+    _type   new_;                                                         \
+    if (op == DART_OP_NO_OP) {                                            \
+      __atomic_load(target_, &old_, __ATOMIC_ACQUIRE);                    \
+    } else if (op == DART_OP_REPLACE) {                                   \
+      __atomic_exchange(target_, &value_, &old_, __ATOMIC_ACQ_REL);       \
+    } else {                                                              \
+      __atomic_load(target_, &old_, __ATOMIC_RELAXED);                    \
+      do {                                                                \
+        switch (op) {                                                     \
+          case DART_OP_SUM:  new_ = old_ + value_;                 break; \
+          case DART_OP_PROD: new_ = old_ * value_;                 break; \
+          case DART_OP_MIN:  new_ = (value_ < old_) ? value_ : old_; break; \
+          case DART_OP_MAX:  new_ = (value_ > old_) ? value_ : old_; break; \
+          _int_ops                                                        \
+          default:           return false;                                \
+        }                                                                 \
+      } while (!__atomic_compare_exchange(                                \
+                 target_, &old_, &new_, false,                            \
+                 __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));                    \
+    }                                                                     \
+    if (result != NULL) {                                                 \
+      *(_type *)result = old_;                                            \
+    }                                                                     \
+    return true;                                                          \
+  } while (0)
+
+#define DART__MPI__SHMEM_FETCH_OP_INT(_type)                              \
+  do {                                                                    \
+    if (op == DART_OP_SUM) {                                              \
+      _type old_ = __atomic_fetch_add(                                    \
+                     (_type *)target, *(const _type *)value,              \
+                     __ATOMIC_ACQ_REL);                                   \
+      if (result != NULL) {                                               \
+        *(_type *)result = old_;                                          \
+      }                                                                   \
+      return true;                                                        \
+    }                                                                     \
+    DART__MPI__SHMEM_FETCH_OP(_type, DART__MPI__SHMEM_INT_OPS);           \
+  } while (0)
+
+/**
+ * Apply \c op to the element at \c target and \c value atomically and
+ * store the previous value in \c result unless it is NULL.
+ *
+ * \return  false if the operation is not supported for the data type and
+ *          has not been applied, otherwise true.
+ */
+static
+bool dart__mpi__shmem_fetch_and_op(
+    void             * target,
+    const void       * value,
+    void             * result,
+    dart_datatype_t    dtype,
+    dart_operation_t   op)
+{
+  switch (dtype) {
+    case DART_TYPE_BYTE:      DART__MPI__SHMEM_FETCH_OP_INT(char);
+    case DART_TYPE_SHORT:     DART__MPI__SHMEM_FETCH_OP_INT(short);
+    case DART_TYPE_INT:       DART__MPI__SHMEM_FETCH_OP_INT(int);
+    case DART_TYPE_UINT:      DART__MPI__SHMEM_FETCH_OP_INT(unsigned int);
+    case DART_TYPE_LONG:      DART__MPI__SHMEM_FETCH_OP_INT(long);
+    case DART_TYPE_ULONG:     DART__MPI__SHMEM_FETCH_OP_INT(unsigned long);
+    case DART_TYPE_LONGLONG:  DART__MPI__SHMEM_FETCH_OP_INT(long long);
+    case DART_TYPE_ULONGLONG:
+      DART__MPI__SHMEM_FETCH_OP_INT(unsigned long long);
+    case DART_TYPE_FLOAT:     DART__MPI__SHMEM_FETCH_OP(float, );
+    case DART_TYPE_DOUBLE:    DART__MPI__SHMEM_FETCH_OP(double, );
+    default:                  return false;
+  }
+}
+
+#define DART__MPI__SHMEM_CAS(_type)                                       \
+  do {                                                                    \
+    _type expected_ = *(const _type *)compare;                            \
+    __atomic_compare_exchange_n(                                          \
+      (_type *)target, &expected_, *(const _type *)value, false,          \
+      __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);                                \
+    *(_type *)result = expected_;                                         \
+    return true;                                                          \
+  } while (0)
+
+/**
+ * Replace the element at \c target with \c value atomically if it is
+ * equal to \c compare, the previous value is stored in \c result.
+ *
+ * \return  false if the data type is not supported, otherwise true.
+ */
+static
+bool dart__mpi__shmem_compare_and_swap(
+    void             * target,
+    const void       * value,
+    const void       * compare,
+    void             * result,
+    dart_datatype_t    dtype)
+{
+  switch (dart__mpi__datatype_sizeof(dtype)) {
+    case 1:  DART__MPI__SHMEM_CAS(uint8_t);
+    case 2:  DART__MPI__SHMEM_CAS(uint16_t);
+    case 4:  DART__MPI__SHMEM_CAS(uint32_t);
+    case 8:  DART__MPI__SHMEM_CAS(uint64_t);
+    default: return false;
+  }
+}
+
+/**
+ * Apply \c op to \c nelem elements at \c target element-wise atomically.
+ *
+ * \return  false if the operation is not supported for the data type and
+ *          has not been applied, otherwise true.
+ */
+static
+bool dart__mpi__shmem_accumulate(
+    char             * target,
+    const void       * values,
+    size_t             nelem,
+    dart_datatype_t    dtype,
+    dart_operation_t   op)
+{
+  const size_t dtype_size = dart__mpi__datatype_sizeof(dtype);
+  const char * src        = (const char *)values;
+  for (size_t i = 0; i < nelem; ++i) {
+    /* Support depends on operation and type only, so only the first
+     * element can fail */
+    if (!dart__mpi__shmem_fetch_and_op(
+           target + i * dtype_size, src + i * dtype_size, NULL,
+           dtype, op)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 /**
  * Internal implementations of put/get with and without handles for
  * basic data types and complex data types.
@@ -305,34 +597,40 @@ dart__mpi__get_complex(
 
   MPI_Datatype src_mpi_type, dst_mpi_type;
   int src_num_elem, dst_num_elem;
-  dart__mpi__datatype_convert_mpi(
-      src_type, nelem, &src_mpi_type, &src_num_elem);
+  dart_type_cache_entry_t *src_cache_entry, *dst_cache_entry = NULL;
+  if (dart__mpi__datatype_convert_mpi(
+        src_type, nelem, &src_mpi_type, &src_num_elem,
+        &src_cache_entry) != DART_OK) {
+    return DART_ERR_OTHER;
+  }
   if (src_type != dst_type) {
-    dart__mpi__datatype_convert_mpi(
-        dst_type, nelem, &dst_mpi_type, &dst_num_elem);
+    if (dart__mpi__datatype_convert_mpi(
+          dst_type, nelem, &dst_mpi_type, &dst_num_elem,
+          &dst_cache_entry) != DART_OK) {
+      dart__mpi__datatype_cache_release(src_cache_entry);
+      return DART_ERR_OTHER;
+    }
   } else {
     dst_mpi_type = src_mpi_type;
     dst_num_elem = src_num_elem;
   }
 
   DART_LOG_TRACE("dart_get:  MPI_Rget (dest %p, size %zu)", dest_ptr, nelem);
-  CHECK_MPI_RET(
-      dart__mpi__get(dest_ptr,
-        dst_num_elem,
-        dst_mpi_type,
-        team_unit_id.id,
-        offset,
-        src_num_elem,
-        src_mpi_type,
-        win,
-        reqs, num_reqs),
-      "MPI_Rget");
-  // clean-up strided data types
-  if (dart__mpi__datatype_isstrided(src_type)) {
-    dart__mpi__destroy_strided_mpi(&src_mpi_type);
-  }
-  if (src_type != dst_type && dart__mpi__datatype_isstrided(dst_type)) {
-    dart__mpi__destroy_strided_mpi(&dst_mpi_type);
+  int mpi_ret = dart__mpi__get(dest_ptr,
+                               dst_num_elem,
+                               dst_mpi_type,
+                               team_unit_id.id,
+                               offset,
+                               src_num_elem,
+                               src_mpi_type,
+                               win,
+                               reqs, num_reqs);
+  // Release cached types before checking for errors so they can be evicted:
+  dart__mpi__datatype_cache_release(src_cache_entry);
+  dart__mpi__datatype_cache_release(dst_cache_entry);
+  if (mpi_ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_get ! MPI_Rget failed");
+    return DART_ERR_OTHER;
   }
   return DART_OK;
 }
@@ -445,11 +743,19 @@ dart__mpi__put_complex(
 
   MPI_Datatype src_mpi_type, dst_mpi_type;
   int src_num_elem, dst_num_elem;
-  dart__mpi__datatype_convert_mpi(
-      src_type, nelem, &src_mpi_type, &src_num_elem);
+  dart_type_cache_entry_t *src_cache_entry, *dst_cache_entry = NULL;
+  if (dart__mpi__datatype_convert_mpi(
+        src_type, nelem, &src_mpi_type, &src_num_elem,
+        &src_cache_entry) != DART_OK) {
+    return DART_ERR_OTHER;
+  }
   if (src_type != dst_type) {
-    dart__mpi__datatype_convert_mpi(
-        dst_type, nelem, &dst_mpi_type, &dst_num_elem);
+    if (dart__mpi__datatype_convert_mpi(
+          dst_type, nelem, &dst_mpi_type, &dst_num_elem,
+          &dst_cache_entry) != DART_OK) {
+      dart__mpi__datatype_cache_release(src_cache_entry);
+      return DART_ERR_OTHER;
+    }
   } else {
     dst_mpi_type = src_mpi_type;
     dst_num_elem = src_num_elem;
@@ -459,25 +765,23 @@ dart__mpi__put_complex(
       "dart_put:  MPI_Put (src %p, size %zu, src_type %ld, dst_type %ld)",
       src_ptr, nelem, src_type,  dst_type);
 
-  CHECK_MPI_RET(
-      dart__mpi__put(src_ptr,
-        src_num_elem,
-        src_mpi_type,
-        team_unit_id.id,
-        offset,
-        dst_num_elem,
-        dst_mpi_type,
-        win,
-        reqs, num_reqs),
-      "MPI_Put");
-
-  // clean-up strided data types
-  if (dart__mpi__datatype_isstrided(src_type)) {
-    dart__mpi__destroy_strided_mpi(&src_mpi_type);
-  }
-  if (src_type != dst_type && dart__mpi__datatype_isstrided(dst_type)) {
-    dart__mpi__destroy_strided_mpi(&dst_mpi_type);
+  int mpi_ret = dart__mpi__put(src_ptr,
+                               src_num_elem,
+                               src_mpi_type,
+                               team_unit_id.id,
+                               offset,
+                               dst_num_elem,
+                               dst_mpi_type,
+                               win,
+                               reqs, num_reqs);
+  // Release cached types before checking for errors so they can be evicted:
+  dart__mpi__datatype_cache_release(src_cache_entry);
+  dart__mpi__datatype_cache_release(dst_cache_entry);
+  if (mpi_ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_put ! MPI_Put failed");
+    return DART_ERR_OTHER;
   }
+
   return DART_OK;
 }
 
@@ -517,6 +821,12 @@ dart_ret_t dart_get(
     return DART_ERR_INVAL;
   }
 
+  DART__MPI__STATS_ONESIDED(
+    DART_STATS_GET, team_data, team_unit_id, seginfo,
+    dart__mpi__datatype_iscontiguous(src_type) &&
+    dart__mpi__datatype_iscontiguous(dst_type),
+    nelem, src_type);
+
   dart_ret_t ret = DART_OK;
 
   // leave complex data type handling to MPI
@@ -565,6 +875,12 @@ dart_ret_t dart_put(
     return DART_ERR_INVAL;
   }
 
+  DART__MPI__STATS_ONESIDED(
+    DART_STATS_PUT, team_data, team_unit_id, seginfo,
+    dart__mpi__datatype_iscontiguous(src_type) &&
+    dart__mpi__datatype_iscontiguous(dst_type),
+    nelem, src_type);
+
   dart_ret_t ret = DART_OK;
 
   if (dart__mpi__datatype_iscontiguous(src_type) &&
@@ -622,6 +938,28 @@ dart_ret_t dart_accumulate(
     return DART_ERR_INVAL;
   }
 
+  // transfer pending combined accumulates to retain the order of atomics:
+  if (dart__unlikely(
+        dart__mpi__combining_flush(
+          team_data, seginfo, team_unit_id.id) != DART_OK)) {
+    return DART_ERR_OTHER;
+  }
+
+  char * shmem_addr = dart__mpi__shmem_atomic_addr(
+                        team_data, seginfo, team_unit_id, offset);
+  if (shmem_addr != NULL &&
+      dart__mpi__shmem_accumulate(shmem_addr, values, nelem, dtype, op)) {
+    DART__MPI__STATS_ONESIDED(
+      DART_STATS_ACCUMULATE, team_data, team_unit_id, seginfo, true,
+      nelem, dtype);
+    DART_LOG_DEBUG("dart_accumulate > finished in shared memory");
+    return DART_OK;
+  }
+
+  DART__MPI__STATS_ONESIDED(
+    DART_STATS_ACCUMULATE, team_data, team_unit_id, seginfo, false,
+    nelem, dtype);
+
   MPI_Win win = seginfo->win;
   offset     += dart_segment_disp(seginfo, team_unit_id);
 
@@ -713,6 +1051,28 @@ dart_ret_t dart_accumulate_blocking_local(
     return DART_ERR_INVAL;
   }
 
+  // transfer pending combined accumulates to retain the order of atomics:
+  if (dart__unlikely(
+        dart__mpi__combining_flush(
+          team_data, seginfo, team_unit_id.id) != DART_OK)) {
+    return DART_ERR_OTHER;
+  }
+
+  char * shmem_addr = dart__mpi__shmem_atomic_addr(
+                        team_data, seginfo, team_unit_id, offset);
+  if (shmem_addr != NULL &&
+      dart__mpi__shmem_accumulate(shmem_addr, values, nelem, dtype, op)) {
+    DART__MPI__STATS_ONESIDED(
+      DART_STATS_ACCUMULATE, team_data, team_unit_id, seginfo, true,
+      nelem, dtype);
+    DART_LOG_DEBUG("dart_accumulate > finished in shared memory");
+    return DART_OK;
+  }
+
+  DART__MPI__STATS_ONESIDED(
+    DART_STATS_ACCUMULATE, team_data, team_unit_id, seginfo, false,
+    nelem, dtype);
+
   MPI_Win win = seginfo->win;
   offset     += dart_segment_disp(seginfo, team_unit_id);
 
@@ -810,11 +1170,33 @@ dart_ret_t dart_fetch_and_op(
 
   CHECK_UNITID_RANGE(team_unit_id, team_data);
 
+  // transfer pending combined accumulates to retain the order of atomics:
+  if (dart__unlikely(
+        dart__mpi__combining_flush(
+          team_data, seginfo, team_unit_id.id) != DART_OK)) {
+    return DART_ERR_OTHER;
+  }
+
   DART_LOG_DEBUG("dart_fetch_and_op() dtype:%ld op:%ld unit:%d "
       "offset:%"PRIu64" segid:%d",
       dtype, op, team_unit_id.id,
       gptr.addr_or_offs.offset, seg_id);
 
+  char * shmem_addr = dart__mpi__shmem_atomic_addr(
+                        team_data, seginfo, team_unit_id, offset);
+  if (shmem_addr != NULL &&
+      dart__mpi__shmem_fetch_and_op(shmem_addr, value, result, dtype, op)) {
+    DART__MPI__STATS_ONESIDED(
+      DART_STATS_FETCH_AND_OP, team_data, team_unit_id, seginfo, true,
+      1, dtype);
+    DART_LOG_DEBUG("dart_fetch_and_op > finished in shared memory");
+    return DART_OK;
+  }
+
+  DART__MPI__STATS_ONESIDED(
+    DART_STATS_FETCH_AND_OP, team_data, team_unit_id, seginfo, false,
+    1, dtype);
+
   MPI_Win win = seginfo->win;
   offset     += dart_segment_disp(seginfo, team_unit_id);
 
@@ -873,6 +1255,29 @@ dart_ret_t dart_compare_and_swap(
     return DART_ERR_INVAL;
   }
 
+  // transfer pending combined accumulates to retain the order of atomics:
+  if (dart__unlikely(
+        dart__mpi__combining_flush(
+          team_data, seginfo, team_unit_id.id) != DART_OK)) {
+    return DART_ERR_OTHER;
+  }
+
+  char * shmem_addr = dart__mpi__shmem_atomic_addr(
+                        team_data, seginfo, team_unit_id, offset);
+  if (shmem_addr != NULL &&
+      dart__mpi__shmem_compare_and_swap(
+        shmem_addr, value, compare, result, dtype)) {
+    DART__MPI__STATS_ONESIDED(
+      DART_STATS_COMPARE_AND_SWAP, team_data, team_unit_id, seginfo, true,
+      1, dtype);
+    DART_LOG_DEBUG("dart_compare_and_swap > finished in shared memory");
+    return DART_OK;
+  }
+
+  DART__MPI__STATS_ONESIDED(
+    DART_STATS_COMPARE_AND_SWAP, team_data, team_unit_id, seginfo, false,
+    1, dtype);
+
   MPI_Win win  = seginfo->win;
   offset      += dart_segment_disp(seginfo, team_unit_id);
 
@@ -937,6 +1342,12 @@ dart_ret_t dart_get_handle(
       team_unit_id.id, offset, seg_id, gptr.teamid, nelem);
   DART_LOG_TRACE("dart_get_handle:  allocated handle:%p", (void *)(handle));
 
+  DART__MPI__STATS_ONESIDED(
+    DART_STATS_GET_HANDLE, team_data, team_unit_id, seginfo,
+    dart__mpi__datatype_iscontiguous(src_type) &&
+    dart__mpi__datatype_iscontiguous(dst_type),
+    nelem, src_type);
+
   dart_ret_t ret = DART_OK;
 
   // leave complex data type handling to MPI
@@ -1006,6 +1417,12 @@ dart_ret_t dart_put_handle(
   handle->win            = win;
   handle->needs_flush    = true;
 
+  DART__MPI__STATS_ONESIDED(
+    DART_STATS_PUT_HANDLE, team_data, team_unit_id, seginfo,
+    dart__mpi__datatype_iscontiguous(src_type) &&
+    dart__mpi__datatype_iscontiguous(dst_type),
+    nelem, src_type);
+
   dart_ret_t ret = DART_OK;
 
   if (dart__mpi__datatype_iscontiguous(src_type) &&
@@ -1078,6 +1495,12 @@ dart_ret_t dart_put_blocking(
 
   MPI_Win win  = seginfo->win;
 
+  DART__MPI__STATS_ONESIDED(
+    DART_STATS_PUT_BLOCKING, team_data, team_unit_id, seginfo,
+    dart__mpi__datatype_iscontiguous(src_type) &&
+    dart__mpi__datatype_iscontiguous(dst_type),
+    nelem, src_type);
+
   dart_ret_t ret = DART_OK;
   bool needs_flush = false;
 
@@ -1141,6 +1564,12 @@ dart_ret_t dart_get_blocking(
     return DART_ERR_INVAL;
   }
 
+  DART__MPI__STATS_ONESIDED(
+    DART_STATS_GET_BLOCKING, team_data, team_unit_id, seginfo,
+    dart__mpi__datatype_iscontiguous(src_type) &&
+    dart__mpi__datatype_iscontiguous(dst_type),
+    nelem, src_type);
+
   dart_ret_t ret = DART_OK;
 
   MPI_Request reqs[2]  = {MPI_REQUEST_NULL, MPI_REQUEST_NULL};
@@ -1198,6 +1627,12 @@ dart_ret_t dart_flush(
     return DART_ERR_INVAL;
   }
 
+  if (dart__unlikely(
+        dart__mpi__combining_flush(
+          team_data, seginfo, team_unit_id.id) != DART_OK)) {
+    return DART_ERR_OTHER;
+  }
+
   MPI_Comm comm = team_data->comm;
   MPI_Win  win  = seginfo->win;
 
@@ -1246,6 +1681,11 @@ dart_ret_t dart_flush_all(
     return DART_ERR_INVAL;
   }
 
+  if (dart__unlikely(
+        dart__mpi__combining_flush(team_data, seginfo, -1) != DART_OK)) {
+    return DART_ERR_OTHER;
+  }
+
   MPI_Comm comm = team_data->comm;
   MPI_Win  win  = seginfo->win;
 
@@ -1296,6 +1736,13 @@ dart_ret_t dart_flush_local(
                    "Unknown segment %i on team %i", seg_id, teamid);
     return DART_ERR_INVAL;
   }
+
+  if (dart__unlikely(
+        dart__mpi__combining_flush(
+          team_data, seginfo, team_unit_id.id) != DART_OK)) {
+    return DART_ERR_OTHER;
+  }
+
   MPI_Comm comm = team_data->comm;
   MPI_Win  win  = seginfo->win;
 
@@ -1338,6 +1785,11 @@ dart_ret_t dart_flush_local_all(
     return DART_ERR_INVAL;
   }
 
+  if (dart__unlikely(
+        dart__mpi__combining_flush(team_data, seginfo, -1) != DART_OK)) {
+    return DART_ERR_OTHER;
+  }
+
   MPI_Comm comm = team_data->comm;
   MPI_Win  win  = seginfo->win;
 
@@ -1853,6 +2305,12 @@ dart_ret_t dart_barrier(
     return DART_ERR_INVAL;
   }
 
+  DART__MPI__STATS_COLLECTIVE(DART_STATS_BARRIER, 0, DART_TYPE_BYTE);
+
+  if (dart__mpi__hier_use(team_data, 0)) {
+    return dart__mpi__hier_barrier(team_data);
+  }
+
   /* Fetch proper communicator from teams. */
   CHECK_MPI_RET(
     MPI_Barrier(team_data->comm), "MPI_Barrier");
@@ -1861,6 +2319,30 @@ dart_ret_t dart_barrier(
   return DART_OK;
 }
 
+dart_ret_t dart_barrier_node_arrive(
+  dart_team_t teamid)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_barrier_node_arrive ! failed: Unknown team: %d",
+                   teamid);
+    return DART_ERR_INVAL;
+  }
+  return dart__mpi__hier_node_arrive(team_data);
+}
+
+dart_ret_t dart_barrier_node_wait(
+  dart_team_t teamid)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_barrier_node_wait ! failed: Unknown team: %d",
+                   teamid);
+    return DART_ERR_INVAL;
+  }
+  return dart__mpi__hier_node_wait(team_data);
+}
+
 dart_ret_t dart_bcast(
   void              * buf,
   size_t              nelem,
@@ -1877,8 +2359,16 @@ dart_ret_t dart_bcast(
     return DART_ERR_INVAL;
   }
 
+  DART__MPI__STATS_COLLECTIVE(DART_STATS_BCAST, nelem, dtype);
+
   CHECK_UNITID_RANGE(root, team_data);
 
+  int dtype_size = dart__mpi__datatype_sizeof(dtype);
+  if (dtype_size > 0 &&
+      dart__mpi__hier_use(team_data, nelem * dtype_size)) {
+    return dart__mpi__hier_bcast(team_data, buf, nelem * dtype_size, root);
+  }
+
   MPI_Comm comm = team_data->comm;
 
   // chunk up the bcast if necessary
@@ -1923,6 +2413,8 @@ dart_ret_t dart_scatter(
     return DART_ERR_INVAL;
   }
 
+  DART__MPI__STATS_COLLECTIVE(DART_STATS_SCATTER, nelem, dtype);
+
   CHECK_UNITID_RANGE(root, team_data);
 
   // chunk up the scatter if necessary
@@ -1987,6 +2479,8 @@ dart_ret_t dart_gather(
     return DART_ERR_INVAL;
   }
 
+  DART__MPI__STATS_COLLECTIVE(DART_STATS_GATHER, nelem, dtype);
+
   CHECK_UNITID_RANGE(root, team_data);
 
   // chunk up the scatter if necessary
@@ -2050,10 +2544,18 @@ dart_ret_t dart_allgather(
     return DART_ERR_INVAL;
   }
 
+  DART__MPI__STATS_COLLECTIVE(DART_STATS_ALLGATHER, nelem, dtype);
+
   if (sendbuf == recvbuf || NULL == sendbuf) {
     sendbuf = MPI_IN_PLACE;
   }
 
+  size_t nbytes = nelem * dart__mpi__datatype_sizeof(dtype);
+  if (nbytes * team_data->size <= DART_HIER_RESULT_SIZE &&
+      dart__mpi__hier_use(team_data, nbytes)) {
+    return dart__mpi__hier_allgather(team_data, sendbuf, recvbuf, nbytes);
+  }
+
   // chunk up the scatter if necessary
   const size_t nchunks   = nelem / MAX_CONTIG_ELEMENTS;
   const size_t remainder = nelem % MAX_CONTIG_ELEMENTS;
@@ -2125,6 +2627,9 @@ dart_ret_t dart_allgatherv(
     DART_LOG_ERROR("dart_allgatherv ! unknown teamid %d", teamid);
     return DART_ERR_INVAL;
   }
+
+  DART__MPI__STATS_COLLECTIVE(DART_STATS_ALLGATHERV, nsendelem, dtype);
+
   if (sendbuf == recvbuf || NULL == sendbuf) {
     sendbuf = MPI_IN_PLACE;
   }
@@ -2200,6 +2705,21 @@ dart_ret_t dart_allreduce(
     DART_LOG_ERROR("dart_allreduce ! unknown teamid %d", team);
     return DART_ERR_INVAL;
   }
+
+  DART__MPI__STATS_COLLECTIVE(DART_STATS_ALLREDUCE, nelem, dtype);
+
+  if (dart_config_.hier_collectives) {
+    /* Contributions are combined in node order, not in unit order */
+    int commute, type_size;
+    MPI_Op_commutative(mpi_op, &commute);
+    MPI_Type_size(mpi_dtype, &type_size);
+    if (commute && dart__mpi__hier_use(team_data, nelem * type_size)) {
+      return dart__mpi__hier_allreduce(
+               team_data, sendbuf, recvbuf, nelem * type_size, nelem,
+               mpi_dtype, mpi_op);
+    }
+  }
+
   MPI_Comm comm = team_data->comm;
   CHECK_MPI_RET(
     MPI_Allreduce(
@@ -2238,6 +2758,9 @@ dart_ret_t dart_alltoall(
     return DART_ERR_INVAL;
   }
 
+  DART__MPI__STATS_COLLECTIVE(
+    DART_STATS_ALLTOALL, nelem * team_data->size, dtype);
+
   if (sendbuf == recvbuf || NULL == sendbuf) {
     sendbuf = MPI_IN_PLACE;
   }
@@ -2261,6 +2784,88 @@ dart_ret_t dart_alltoall(
   return DART_OK;
 }
 
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendcounts,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvcounts,
+  const size_t    * recvdispls,
+  dart_team_t       teamid)
+{
+  DART_LOG_TRACE("dart_alltoallv() team:%d", teamid);
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_alltoallv ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (dart__unlikely(dart__mpi__stats_enabled_)) {
+    size_t nsendelem = 0;
+    for (int u = 0; u < team_data->size; ++u) {
+      nsendelem += nsendcounts[u];
+    }
+    DART__MPI__STATS_COLLECTIVE(DART_STATS_ALLTOALLV, nsendelem, dtype);
+  }
+
+  MPI_Comm comm      = team_data->comm;
+  int      comm_size = team_data->size;
+
+  /*
+   * MPI uses offset type int, convert counts and displacements:
+   */
+  int *isendcounts = malloc(sizeof(int) * comm_size);
+  int *isenddispls = malloc(sizeof(int) * comm_size);
+  int *irecvcounts = malloc(sizeof(int) * comm_size);
+  int *irecvdispls = malloc(sizeof(int) * comm_size);
+  for (int i = 0; i < comm_size; i++) {
+    if (nsendcounts[i] > MAX_CONTIG_ELEMENTS ||
+        senddispls[i]  > MAX_CONTIG_ELEMENTS ||
+        nrecvcounts[i] > MAX_CONTIG_ELEMENTS ||
+        recvdispls[i]  > MAX_CONTIG_ELEMENTS)
+    {
+      DART_LOG_ERROR(
+        "dart_alltoallv ! failed: counts or displacements of unit %i "
+        "exceed INT_MAX", i);
+      free(isendcounts);
+      free(isenddispls);
+      free(irecvcounts);
+      free(irecvdispls);
+      return DART_ERR_INVAL;
+    }
+    isendcounts[i] = nsendcounts[i];
+    isenddispls[i] = senddispls[i];
+    irecvcounts[i] = nrecvcounts[i];
+    irecvdispls[i] = recvdispls[i];
+  }
+
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+  int ret = MPI_Alltoallv(
+              sendbuf,
+              isendcounts,
+              isenddispls,
+              mpi_dtype,
+              recvbuf,
+              irecvcounts,
+              irecvdispls,
+              mpi_dtype,
+              comm);
+  free(isendcounts);
+  free(isenddispls);
+  free(irecvcounts);
+  free(irecvdispls);
+  if (ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoallv ! team:%d failed", teamid);
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_TRACE("dart_alltoallv > team:%d", teamid);
+  return DART_OK;
+}
+
 dart_ret_t dart_reduce(
   const void        * sendbuf,
   void              * recvbuf,
@@ -2288,6 +2893,8 @@ dart_ret_t dart_reduce(
     return DART_ERR_INVAL;
   }
 
+  DART__MPI__STATS_COLLECTIVE(DART_STATS_REDUCE, nelem, dtype);
+
   CHECK_UNITID_RANGE(root, team_data);
 
   comm = team_data->comm;
@@ -2304,6 +2911,250 @@ dart_ret_t dart_reduce(
   return DART_OK;
 }
 
+/* -- Non-blocking collective operations -- */
+
+/**
+ * Allocate a handle for a non-blocking collective operation on \c team_data.
+ * Collective operations complete locally, the handle does not require a
+ * flush for remote completion.
+ */
+static inline
+dart_handle_t dart__mpi__coll_handle_alloc(
+  const dart_team_data_t * team_data)
+{
+  dart_handle_t handle = calloc(1, sizeof(struct dart_handle_struct));
+  handle->dest         = team_data->unitid;
+  handle->win          = MPI_WIN_NULL;
+  handle->needs_flush  = false;
+  handle->num_reqs     = 0;
+  return handle;
+}
+
+dart_ret_t dart_ibarrier(
+  dart_team_t     teamid,
+  dart_handle_t * handleptr)
+{
+  DART_LOG_DEBUG("dart_ibarrier() team:%d", teamid);
+
+  if (dart__unlikely(handleptr == NULL)) {
+    DART_LOG_ERROR("dart_ibarrier ! handle may not be NULL");
+    return DART_ERR_INVAL;
+  }
+  *handleptr = DART_HANDLE_NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_ibarrier ! failed: unknown team %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  DART__MPI__STATS_COLLECTIVE(DART_STATS_IBARRIER, 0, DART_TYPE_BYTE);
+
+  dart_handle_t handle = dart__mpi__coll_handle_alloc(team_data);
+  if (MPI_Ibarrier(team_data->comm, &handle->reqs[0]) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_ibarrier ! MPI_Ibarrier failed");
+    free(handle);
+    return DART_ERR_INVAL;
+  }
+  handle->num_reqs = 1;
+  *handleptr       = handle;
+
+  DART_LOG_DEBUG("dart_ibarrier > team:%d handle:%p",
+                 teamid, (void*)handle);
+  return DART_OK;
+}
+
+dart_ret_t dart_ibcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         teamid,
+  dart_handle_t     * handleptr)
+{
+  DART_LOG_TRACE("dart_ibcast() root:%d team:%d nelem:%"PRIu64"",
+                 root.id, teamid, nelem);
+
+  if (dart__unlikely(handleptr == NULL)) {
+    DART_LOG_ERROR("dart_ibcast ! handle may not be NULL");
+    return DART_ERR_INVAL;
+  }
+  *handleptr = DART_HANDLE_NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_ibcast ! failed: unknown team %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  DART__MPI__STATS_COLLECTIVE(DART_STATS_IBCAST, nelem, dtype);
+
+  CHECK_UNITID_RANGE(root, team_data);
+
+  MPI_Comm      comm   = team_data->comm;
+  dart_handle_t handle = dart__mpi__coll_handle_alloc(team_data);
+
+  // chunk up the bcast if necessary, every chunk requires a request
+  const size_t nchunks   = nelem / MAX_CONTIG_ELEMENTS;
+  const size_t remainder = nelem % MAX_CONTIG_ELEMENTS;
+        char * src_ptr   = (char*) buf;
+
+  if (nchunks > 0) {
+    if (MPI_Ibcast(src_ptr, nchunks,
+                   dart__mpi__datatype_maxtype(dtype),
+                   root.id, comm,
+                   &handle->reqs[handle->num_reqs]) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_ibcast ! MPI_Ibcast failed");
+      free(handle);
+      return DART_ERR_INVAL;
+    }
+    handle->num_reqs++;
+    src_ptr += nchunks * MAX_CONTIG_ELEMENTS;
+  }
+
+  if (remainder > 0) {
+    MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+    if (MPI_Ibcast(src_ptr, remainder, mpi_dtype, root.id, comm,
+                   &handle->reqs[handle->num_reqs]) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_ibcast ! MPI_Ibcast failed");
+      // the request of the first chunk has already been started
+      if (handle->num_reqs > 0) {
+        MPI_Wait(&handle->reqs[0], MPI_STATUS_IGNORE);
+      }
+      free(handle);
+      return DART_ERR_INVAL;
+    }
+    handle->num_reqs++;
+  }
+  *handleptr = handle;
+
+  DART_LOG_TRACE("dart_ibcast > root:%d team:%d nelem:%zu handle:%p",
+                 root.id, teamid, nelem, (void*)handle);
+  return DART_OK;
+}
+
+dart_ret_t dart_iallreduce(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        teamid,
+  dart_handle_t    * handleptr)
+{
+  DART_LOG_TRACE("dart_iallreduce() team:%d nelem:%zu", teamid, nelem);
+
+  if (dart__unlikely(handleptr == NULL)) {
+    DART_LOG_ERROR("dart_iallreduce ! handle may not be NULL");
+    return DART_ERR_INVAL;
+  }
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  MPI_Op       mpi_op    = dart__mpi__op(op, dtype);
+  MPI_Datatype mpi_dtype = dart__mpi__op_type(op, dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_iallreduce ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_iallreduce ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  DART__MPI__STATS_COLLECTIVE(DART_STATS_IALLREDUCE, nelem, dtype);
+
+  dart_handle_t handle = dart__mpi__coll_handle_alloc(team_data);
+  if (MPI_Iallreduce(
+        sendbuf,   // send buffer
+        recvbuf,   // receive buffer
+        nelem,     // buffer size
+        mpi_dtype, // datatype
+        mpi_op,    // reduce operation
+        team_data->comm,
+        &handle->reqs[0]) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_iallreduce ! MPI_Iallreduce failed");
+    free(handle);
+    return DART_ERR_INVAL;
+  }
+  handle->num_reqs = 1;
+  *handleptr       = handle;
+
+  DART_LOG_TRACE("dart_iallreduce > team:%d nelem:%zu handle:%p",
+                 teamid, nelem, (void*)handle);
+  return DART_OK;
+}
+
+dart_ret_t dart_ialltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid,
+  dart_handle_t   * handleptr)
+{
+  DART_LOG_TRACE("dart_ialltoall() team:%d nelem:%" PRIu64 "", teamid, nelem);
+
+  if (dart__unlikely(handleptr == NULL)) {
+    DART_LOG_ERROR("dart_ialltoall ! handle may not be NULL");
+    return DART_ERR_INVAL;
+  }
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_ialltoall ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_ialltoall ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  DART__MPI__STATS_COLLECTIVE(
+    DART_STATS_IALLTOALL, nelem * team_data->size, dtype);
+
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  MPI_Datatype  mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+  dart_handle_t handle    = dart__mpi__coll_handle_alloc(team_data);
+
+  if (MPI_Ialltoall(
+        sendbuf,
+        nelem,
+        mpi_dtype,
+        recvbuf,
+        nelem,
+        mpi_dtype,
+        team_data->comm,
+        &handle->reqs[0]) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_ialltoall ! MPI_Ialltoall failed");
+    free(handle);
+    return DART_ERR_INVAL;
+  }
+  handle->num_reqs = 1;
+  *handleptr       = handle;
+
+  DART_LOG_TRACE("dart_ialltoall > team:%d nelem:%" PRIu64 " handle:%p",
+                 teamid, nelem, (void*)handle);
+  return DART_OK;
+}
+
 dart_ret_t dart_send(
   const void         * sendbuf,
   size_t               nelem,
@@ -2332,6 +3183,11 @@ dart_ret_t dart_send(
 
   CHECK_UNITID_RANGE(unit, team_data);
 
+  DART__MPI__STATS_RECORD(
+    DART_STATS_SEND, DART_STATS_PATH_MPI,
+    dart__mpi__stats_nbytes(nelem, dtype),
+    dart__mpi__stats_target(team_data, DART_TEAM_UNIT_ID(unit.id)));
+
   comm = team_data->comm;
   // dart_unit = MPI rank in comm_world
   CHECK_MPI_RET(
@@ -2374,6 +3230,11 @@ dart_ret_t dart_recv(
 
   CHECK_UNITID_RANGE(unit, team_data);
 
+  DART__MPI__STATS_RECORD(
+    DART_STATS_RECV, DART_STATS_PATH_MPI,
+    dart__mpi__stats_nbytes(nelem, dtype),
+    dart__mpi__stats_target(team_data, DART_TEAM_UNIT_ID(unit.id)));
+
   comm = team_data->comm;
   // dart_unit = MPI rank in comm_world
   CHECK_MPI_RET(
@@ -2429,6 +3290,11 @@ dart_ret_t dart_sendrecv(
   CHECK_UNITID_RANGE(dest, team_data);
   CHECK_UNITID_RANGE(src, team_data);
 
+  DART__MPI__STATS_RECORD(
+    DART_STATS_SENDRECV, DART_STATS_PATH_MPI,
+    dart__mpi__stats_nbytes(send_nelem, send_dtype),
+    dart__mpi__stats_target(team_data, DART_TEAM_UNIT_ID(dest.id)));
+
   comm = team_data->comm;
   CHECK_MPI_RET(
     MPI_Sendrecv(
@@ -2,7 +2,7 @@
 #include <dash/dart/if/dart_config.h>
 #include <dash/dart/if/dart_types.h>
 
-dart_config_t dart_config_ = { 1 };
+dart_config_t dart_config_ = { 1, 0, 0 };
 
 void dart_config(
   dart_config_t ** config_out)
@@ -21,6 +21,7 @@
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
+#include <dash/dart/mpi/dart_combining_priv.h>
 
 #include <stdio.h>
 #include <mpi.h>
@@ -529,6 +530,8 @@ dart_ret_t dart_team_memfree(
     return DART_ERR_INVAL;
   }
 
+  dart__mpi__combining_discard(teamid, segid);
+
   if (seginfo->is_dynamic) {
     MPI_Win win = team_data->window;
     if (dart_segment_get_selfbaseptr(
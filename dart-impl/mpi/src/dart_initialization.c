@@ -18,6 +18,9 @@
 #include <dash/dart/mpi/dart_globmem_priv.h>
 #include <dash/dart/mpi/dart_communication_priv.h>
 #include <dash/dart/mpi/dart_locality_priv.h>
+#include <dash/dart/mpi/dart_stats_priv.h>
+#include <dash/dart/mpi/dart_combining_priv.h>
+#include <dash/dart/mpi/dart_collective_hier_priv.h>
 #include <dash/dart/mpi/dart_segment.h>
 
 #define DART_LOCAL_ALLOC_SIZE (1024UL*1024*16)
@@ -182,6 +185,10 @@ dart_ret_t do_init()
   MPI_Comm_rank(team_data->comm, &team_data->unitid);
   MPI_Comm_size(team_data->comm, &team_data->size);
 
+  dart__mpi__stats_init(team_data->size);
+
+  dart__mpi__combining_init();
+
   ret = create_local_alloc(team_data);
   if (ret != DART_OK) {
     return ret;
@@ -203,6 +210,10 @@ dart_ret_t do_init()
    */
   MPI_Win_lock_all(MPI_MODE_NOCHECK, win);
 
+  dart__mpi__shmem_atomics_init(win, dart_win_local_alloc);
+
+  dart__mpi__hier_init();
+
   DART_LOG_DEBUG("dart_init: communication backend initialization finished");
 
   _dart_initialized = 1;
@@ -319,6 +330,7 @@ dart_ret_t dart_exit()
   }
 
   /* -- Free up all the resources for dart programme -- */
+  dart__mpi__hier_fini(team_data);
   MPI_Win_free(&seginfo->win);
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   /* Has MPI shared windows: */
@@ -342,6 +354,10 @@ dart_ret_t dart_exit()
 
   dart__mpi__op_fini();
 
+  dart__mpi__stats_fini();
+
+  dart__mpi__combining_fini();
+
   if (_init_by_dart) {
     DART_LOG_DEBUG("%2d: dart_exit: MPI_Finalize", unitid.id);
     MPI_Finalize();
@@ -13,6 +13,8 @@
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_locality.h>
 
+#include <dash/dart/mpi/dart_locality_priv.h>
+
 #include <mpi.h>
 
 #include <unistd.h>
@@ -306,3 +308,13 @@ dart_ret_t dart_unit_locality(
   return DART_OK;
 }
 
+/* ==================================================================== *
+ * Initialization Timing                                                *
+ * ==================================================================== */
+
+dart_ret_t dart_locality_init_timing(
+  dart_locality_init_timing_t   * timing)
+{
+  DART_LOG_DEBUG("dart_locality_init_timing()");
+  return dart__mpi__locality_init_timing(timing);
+}
@@ -4,6 +4,7 @@
  */
 
 #include <dash/dart/mpi/dart_locality_priv.h>
+#include <dash/dart/mpi/dart_team_private.h>
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_communication.h>
@@ -12,20 +13,139 @@
 
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/locality.h>
+#include <dash/dart/base/hwinfo.h>
 
+#include <mpi.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+static dart_locality_init_timing_t
+dart__mpi__locality_init_timing_ = { 0, 0, 0, 0, 0 };
+
+/**
+ * Discovers the hardware topology of the local node at a single unit per
+ * node only. The node leader serializes the topology to a shared memory
+ * window from which all other units on the node import it, avoiding
+ * concurrent topology discovery of all units on the node.
+ *
+ * Units fall back to discovering the topology individually if shared
+ * memory windows are disabled or sharing the topology fails.
+ */
+static dart_ret_t dart__mpi__locality_node_topology()
+{
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  dart_team_data_t * team_data = dart_adapt_teamlist_get(DART_TEAM_ALL);
+  if (team_data == NULL || team_data->sharedmem_comm == MPI_COMM_NULL) {
+    return DART_OK;
+  }
+  MPI_Comm node_comm = team_data->sharedmem_comm;
+  int      node_rank;
+  int      node_size;
+  MPI_Comm_rank(node_comm, &node_rank);
+  MPI_Comm_size(node_comm, &node_size);
+  if (node_size < 2) {
+    return DART_OK;
+  }
+
+  char               * buffer   = NULL;
+  size_t               size     = 0;
+  unsigned long long   xml_size = 0;
+  if (node_rank == 0) {
+    if (dart__base__hwinfo__topology_export(&buffer, &size) == DART_OK) {
+      xml_size = size;
+    }
+  }
+  MPI_Bcast(&xml_size, 1, MPI_UNSIGNED_LONG_LONG, 0, node_comm);
+  if (xml_size == 0) {
+    /* Topology discovery not available or failed at the node leader */
+    free(buffer);
+    return DART_OK;
+  }
+
+  char    * shmem_buffer;
+  MPI_Win   shmem_win = MPI_WIN_NULL;
+  if (MPI_Win_allocate_shared(
+        (node_rank == 0) ? (MPI_Aint)xml_size : 0, 1, MPI_INFO_NULL,
+        node_comm, &shmem_buffer, &shmem_win) != MPI_SUCCESS) {
+    DART_LOG_WARN("dart__mpi__locality_node_topology ! "
+                  "MPI_Win_allocate_shared failed, "
+                  "falling back to local topology discovery");
+    if (shmem_win != MPI_WIN_NULL) {
+      MPI_Win_free(&shmem_win);
+    }
+    free(buffer);
+    return DART_OK;
+  }
+  MPI_Win_fence(0, shmem_win);
+  if (node_rank == 0) {
+    memcpy(shmem_buffer, buffer, xml_size);
+    free(buffer);
+  }
+  MPI_Win_fence(0, shmem_win);
+
+  if (node_rank != 0) {
+    MPI_Aint   leader_size;
+    int        leader_disp;
+    char     * leader_buffer;
+    MPI_Win_shared_query(shmem_win, 0, &leader_size, &leader_disp,
+                         &leader_buffer);
+    if (dart__base__hwinfo__topology_import(leader_buffer, xml_size)
+        != DART_OK) {
+      /* No topology is set, hwinfo discovers it at this unit: */
+      DART_LOG_WARN("dart__mpi__locality_node_topology ! "
+                    "import of node topology failed, "
+                    "falling back to local topology discovery");
+    }
+  }
+  /* Window is freed collectively, after all units imported the topology: */
+  MPI_Win_free(&shmem_win);
+
+  DART_LOG_DEBUG("dart__mpi__locality_node_topology: "
+                 "node rank:%d/%d topology size:%llu",
+                 node_rank, node_size, xml_size);
+  return DART_OK;
+#else
+  return DART_OK;
+#endif
+}
 
 dart_ret_t dart__mpi__locality_init()
 {
   DART_LOG_DEBUG("dart__mpi__locality_init()");
   dart_ret_t ret;
 
+  double ts_start = MPI_Wtime();
+  ret = dart__mpi__locality_node_topology();
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("dart__mpi__locality_init ! "
+                   "dart__mpi__locality_node_topology failed: %d", ret);
+    return ret;
+  }
+  double node_topology_us = (MPI_Wtime() - ts_start) * 1.0e6;
+
   ret = dart__base__locality__init();
   if (ret != DART_OK) {
     DART_LOG_ERROR("dart__mpi__locality_init ! "
                    "dart__base__locality__init failed: %d", ret);
     return ret;
   }
-  DART_LOG_DEBUG("dart__mpi__locality_init >");
+  dart__base__locality__init_timing(&dart__mpi__locality_init_timing_);
+  dart__mpi__locality_init_timing_.node_topology_us = node_topology_us;
+  dart__mpi__locality_init_timing_.total_us         =
+    (MPI_Wtime() - ts_start) * 1.0e6;
+
+  DART_LOG_DEBUG("dart__mpi__locality_init > "
+                 "node topology:%.0fus total:%.0fus",
+                 dart__mpi__locality_init_timing_.node_topology_us,
+                 dart__mpi__locality_init_timing_.total_us);
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__locality_init_timing(
+  dart_locality_init_timing_t * timing)
+{
+  *timing = dart__mpi__locality_init_timing_;
   return DART_OK;
 }
 
@@ -46,4 +166,3 @@ dart_ret_t dart__mpi__locality_finalize()
   DART_LOG_DEBUG("dart__mpi__locality_finalize >");
   return DART_OK;
 }
-
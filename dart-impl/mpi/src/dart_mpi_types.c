@@ -9,6 +9,7 @@
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_initialization.h>
 #include <dash/dart/base/logging.h>
+#include <dash/dart/base/mutex.h>
 #include <dash/dart/mpi/dart_communication_priv.h>
 
 #include <stdlib.h>
@@ -18,6 +19,44 @@
 
 #define DART_TYPE_NAMELEN 256
 
+/**
+ * Maximum number of committed MPI types held in the type cache.
+ */
+#ifndef DART_MPI_TYPE_CACHE_SIZE
+#define DART_MPI_TYPE_CACHE_SIZE 64
+#endif
+
+#define DART_MPI_TYPE_CACHE_HASH_SIZE 127
+
+struct dart_type_cache_entry {
+  /// the DART type the MPI type has been created for
+  dart_datatype_t                dart_type;
+  /// the number of blocks represented by the MPI type
+  size_t                         num_blocks;
+  /// the committed MPI type
+  MPI_Datatype                   mpi_type;
+  /// number of callers using the MPI type
+  int                            refcount;
+  /// whether the entry has been removed from the cache while in use
+  bool                           evicted;
+  /// next entry in the same hash slot
+  struct dart_type_cache_entry * hash_next;
+  /// previous (more recently used) entry in the LRU list
+  struct dart_type_cache_entry * lru_prev;
+  /// next (less recently used) entry in the LRU list
+  struct dart_type_cache_entry * lru_next;
+};
+
+static dart_type_cache_entry_t * type_cache_hashtab[DART_MPI_TYPE_CACHE_HASH_SIZE];
+/// most recently used entry
+static dart_type_cache_entry_t * type_cache_lru_head = NULL;
+/// least recently used entry
+static dart_type_cache_entry_t * type_cache_lru_tail = NULL;
+static size_t                    type_cache_size     = 0;
+static size_t                    type_cache_hits     = 0;
+static size_t                    type_cache_misses   = 0;
+static dart_mutex_t              type_cache_mtx      = DART_MUTEX_INITIALIZER;
+
 static const char* __dart_base_type_names[DART_TYPE_LAST+1] = {
   "UNDEFINED",
   "BYTE",
@@ -198,10 +237,193 @@ dart__mpi__create_strided_mpi(
   return new_mpi_dtype;
 }
 
+/**************************************************************/
+/** MPI type cache                                            */
+/**************************************************************/
+
+static inline int
+type_cache_slot(dart_datatype_t dart_type, size_t num_blocks)
+{
+  uint64_t key = ((uint64_t)dart_type) ^ (((uint64_t)num_blocks) << 16);
+  key ^= key >> 29;
+  return (int)(key % DART_MPI_TYPE_CACHE_HASH_SIZE);
+}
+
+static void
+type_cache_lru_unlink(dart_type_cache_entry_t *entry)
+{
+  if (entry->lru_prev != NULL) {
+    entry->lru_prev->lru_next = entry->lru_next;
+  } else {
+    type_cache_lru_head = entry->lru_next;
+  }
+  if (entry->lru_next != NULL) {
+    entry->lru_next->lru_prev = entry->lru_prev;
+  } else {
+    type_cache_lru_tail = entry->lru_prev;
+  }
+  entry->lru_prev = NULL;
+  entry->lru_next = NULL;
+}
+
+static void
+type_cache_lru_push_front(dart_type_cache_entry_t *entry)
+{
+  entry->lru_prev = NULL;
+  entry->lru_next = type_cache_lru_head;
+  if (type_cache_lru_head != NULL) {
+    type_cache_lru_head->lru_prev = entry;
+  }
+  type_cache_lru_head = entry;
+  if (type_cache_lru_tail == NULL) {
+    type_cache_lru_tail = entry;
+  }
+}
+
+static void
+type_cache_entry_free(dart_type_cache_entry_t *entry)
+{
+  MPI_Type_free(&entry->mpi_type);
+  free(entry);
+}
+
+/**
+ * Unlinks the entry from the hash table and the LRU list and frees it
+ * together with its MPI type once it is no longer in use.
+ * Requires the cache mutex to be held.
+ */
+static void
+type_cache_remove(dart_type_cache_entry_t *entry)
+{
+  int slot = type_cache_slot(entry->dart_type, entry->num_blocks);
+  dart_type_cache_entry_t **elem = &type_cache_hashtab[slot];
+  while (*elem != NULL) {
+    if (*elem == entry) {
+      *elem = entry->hash_next;
+      break;
+    }
+    elem = &(*elem)->hash_next;
+  }
+  type_cache_lru_unlink(entry);
+  --type_cache_size;
+  if (entry->refcount > 0) {
+    // freed in dart__mpi__datatype_cache_release:
+    entry->evicted = true;
+  } else {
+    type_cache_entry_free(entry);
+  }
+}
+
+MPI_Datatype
+dart__mpi__datatype_cache_strided(
+  dart_datatype_t            dart_type,
+  size_t                     num_blocks,
+  dart_type_cache_entry_t ** entry)
+{
+  int slot = type_cache_slot(dart_type, num_blocks);
+  dart__base__mutex_lock(&type_cache_mtx);
+  dart_type_cache_entry_t *elem = type_cache_hashtab[slot];
+  while (elem != NULL) {
+    if (elem->dart_type == dart_type && elem->num_blocks == num_blocks) {
+      break;
+    }
+    elem = elem->hash_next;
+  }
+
+  if (elem != NULL) {
+    ++type_cache_hits;
+    if (elem != type_cache_lru_head) {
+      type_cache_lru_unlink(elem);
+      type_cache_lru_push_front(elem);
+    }
+  } else {
+    ++type_cache_misses;
+    if (type_cache_size >= DART_MPI_TYPE_CACHE_SIZE) {
+      DART_LOG_TRACE("dart__mpi__datatype_cache_strided: "
+                     "evicting MPI type for DART type %p (%zu blocks)",
+                     (void*)type_cache_lru_tail->dart_type,
+                     type_cache_lru_tail->num_blocks);
+      type_cache_remove(type_cache_lru_tail);
+    }
+    elem = malloc(sizeof(dart_type_cache_entry_t));
+    if (elem == NULL) {
+      dart__base__mutex_unlock(&type_cache_mtx);
+      DART_LOG_ERROR("dart__mpi__datatype_cache_strided ! "
+                     "Failed to allocate cache entry");
+      *entry = NULL;
+      return MPI_DATATYPE_NULL;
+    }
+    elem->dart_type  = dart_type;
+    elem->num_blocks = num_blocks;
+    elem->mpi_type   = dart__mpi__create_strided_mpi(dart_type, num_blocks);
+    elem->refcount   = 0;
+    elem->evicted    = false;
+    elem->hash_next  = type_cache_hashtab[slot];
+    type_cache_hashtab[slot] = elem;
+    type_cache_lru_push_front(elem);
+    ++type_cache_size;
+  }
+  ++elem->refcount;
+  MPI_Datatype mpi_type = elem->mpi_type;
+  dart__base__mutex_unlock(&type_cache_mtx);
+
+  *entry = elem;
+  return mpi_type;
+}
+
+void
+dart__mpi__datatype_cache_release(dart_type_cache_entry_t *entry)
+{
+  if (entry == NULL) {
+    return;
+  }
+  dart__base__mutex_lock(&type_cache_mtx);
+  if (--entry->refcount == 0 && entry->evicted) {
+    type_cache_entry_free(entry);
+  }
+  dart__base__mutex_unlock(&type_cache_mtx);
+}
+
 void
-dart__mpi__destroy_strided_mpi(MPI_Datatype *mpi_type)
+dart__mpi__datatype_cache_evict(dart_datatype_t dart_type)
 {
-  MPI_Type_free(mpi_type);
+  dart__base__mutex_lock(&type_cache_mtx);
+  dart_type_cache_entry_t *elem = type_cache_lru_head;
+  while (elem != NULL) {
+    dart_type_cache_entry_t *next = elem->lru_next;
+    if (elem->dart_type == dart_type) {
+      type_cache_remove(elem);
+    }
+    elem = next;
+  }
+  dart__base__mutex_unlock(&type_cache_mtx);
+}
+
+dart_ret_t
+dart_type_cache_stats(
+  size_t * hits,
+  size_t * misses)
+{
+  dart__base__mutex_lock(&type_cache_mtx);
+  if (hits   != NULL) *hits   = type_cache_hits;
+  if (misses != NULL) *misses = type_cache_misses;
+  dart__base__mutex_unlock(&type_cache_mtx);
+  return DART_OK;
+}
+
+static void
+type_cache_fini()
+{
+  dart__base__mutex_lock(&type_cache_mtx);
+  DART_LOG_DEBUG("dart__mpi__datatype_fini: MPI type cache "
+                 "hits: %zu, misses: %zu",
+                 type_cache_hits, type_cache_misses);
+  while (type_cache_lru_head != NULL) {
+    type_cache_remove(type_cache_lru_head);
+  }
+  type_cache_hits   = 0;
+  type_cache_misses = 0;
+  dart__base__mutex_unlock(&type_cache_mtx);
 }
 
 dart_ret_t
@@ -341,6 +563,9 @@ dart_type_destroy(dart_datatype_t *dart_type_ptr)
     free(dart_type->indexed.offsets);
     dart_type->indexed.offsets   = NULL;
     MPI_Type_free(&dart_type->indexed.mpi_type);
+  } else if (dart_type->kind == DART_KIND_STRIDED) {
+    // the type's address may be reused by a new type
+    dart__mpi__datatype_cache_evict(*dart_type_ptr);
   } else if (dart_type->kind == DART_KIND_CUSTOM) {
     MPI_Type_free(&dart_type->contiguous.mpi_type);
     if (dart_type->contiguous.max_type != DART_MPI_TYPE_UNDEFINED) {
@@ -364,6 +589,8 @@ static void destroy_basic_type(dart_datatype_t dart_type_id)
 dart_ret_t
 dart__mpi__datatype_fini()
 {
+  type_cache_fini();
+
   destroy_basic_type(DART_TYPE_BYTE);
   destroy_basic_type(DART_TYPE_SHORT);
   destroy_basic_type(DART_TYPE_INT);
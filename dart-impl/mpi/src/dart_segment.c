@@ -1,6 +1,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include <inttypes.h>
+#include <stddef.h>
 
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/assert.h>
@@ -15,6 +16,22 @@ struct dart_seghash_elem {
   dart_segment_info_t  data;
 };
 
+/**
+ * Returns the index of the segment in the direct lookup table or -1 if the
+ * segment ID is outside the range of the table.
+ */
+static inline int table_idx_segid(dart_segid_t segid)
+{
+  int idx = segid + DART_SEGMENT_TABLE_OFFSET;
+  return (idx >= 0 && idx < DART_SEGMENT_TABLE_SIZE) ? idx : -1;
+}
+
+static inline dart_seghash_elem_t * table_elem(dart_segment_info_t *seg)
+{
+  return (dart_seghash_elem_t *)(
+           (char *)seg - offsetof(dart_seghash_elem_t, data));
+}
+
 
 static inline int hash_segid(dart_segid_t segid)
 {
@@ -30,23 +47,32 @@ static inline int hash_segid(dart_segid_t segid)
 static inline void
 register_segment(dart_segmentdata_t *segdata, dart_seghash_elem_t *elem)
 {
+  int idx = table_idx_segid(elem->data.segid);
+  if (idx >= 0) {
+    elem->next = NULL;
+    segdata->segtab[idx] = &(elem->data);
+    return;
+  }
   int slot = hash_segid(elem->data.segid);
   elem->next = segdata->hashtab[slot];
   segdata->hashtab[slot] = elem;
 }
 
-static dart_segment_info_t * get_segment(
-    dart_segmentdata_t *segdata,
-    dart_segid_t        segid)
+dart_segment_info_t * dart_segment_get_info_overflow(
+  dart_segmentdata_t *segdata,
+  dart_segid_t        segid)
 {
-  int slot = hash_segid(segid);
-  dart_seghash_elem_t *elem = segdata->hashtab[slot];
+  dart_seghash_elem_t *elem = NULL;
+  if (table_idx_segid(segid) < 0) {
+    int slot = hash_segid(segid);
+    elem = segdata->hashtab[slot];
 
-  while (elem != NULL) {
-    if (elem->data.segid == segid) {
-      break;
+    while (elem != NULL) {
+      if (elem->data.segid == segid) {
+        break;
+      }
+      elem = elem->next;
     }
-    elem = elem->next;
   }
 
   if (elem == NULL) {
@@ -59,11 +85,11 @@ static dart_segment_info_t * get_segment(
   return &(elem->data);
 }
 
-dart_segment_info_t * dart_segment_get_info(
-  dart_segmentdata_t *segdata,
-  dart_segid_t        segid)
+static inline dart_segment_info_t * get_segment(
+    dart_segmentdata_t *segdata,
+    dart_segid_t        segid)
 {
-  return get_segment(segdata, segid);
+  return dart_segment_get_info(segdata, segid);
 }
 
 /**
@@ -71,6 +97,8 @@ dart_segment_info_t * dart_segment_get_info(
  */
 dart_ret_t dart_segment_init(dart_segmentdata_t *segdata, dart_team_t teamid)
 {
+  memset(segdata->segtab, 0,
+    sizeof(dart_segment_info_t*) * DART_SEGMENT_TABLE_SIZE);
   memset(segdata->hashtab, 0,
     sizeof(dart_seghash_elem_t*) * DART_SEGMENT_HASH_SIZE);
 
@@ -297,43 +325,52 @@ dart_ret_t dart_segment_free(
   dart_segmentdata_t  * segdata,
   dart_segid_t          segid)
 {
-  int slot = hash_segid(segid);
-  dart_seghash_elem_t *pred = NULL;
-  dart_seghash_elem_t *elem = segdata->hashtab[slot];
-
-  // find the correct entry in this bucket
-  pred = NULL;
-  while (elem != NULL) {
-
-    if (elem->data.segid == segid) {
+  dart_seghash_elem_t *elem = NULL;
+  int idx = table_idx_segid(segid);
+  if (idx >= 0) {
+    if (segdata->segtab[idx] != NULL) {
+      elem = table_elem(segdata->segtab[idx]);
+      segdata->segtab[idx] = NULL;
+    }
+  } else {
+    int slot = hash_segid(segid);
+    dart_seghash_elem_t *pred = NULL;
+    elem = segdata->hashtab[slot];
+
+    // find the correct entry in this bucket
+    while (elem != NULL && elem->data.segid != segid) {
+      pred = elem;
+      elem = elem->next;
+    }
+    if (elem != NULL) {
       if (pred != NULL) {
         pred->next = elem->next;
       } else {
         segdata->hashtab[slot] = elem->next;
       }
-      // no need for locking since operations on the same segmentdata
-      // are not thread-safe
-      if (segid > 0) {
-        elem->next            = segdata->mem_freelist;
-        segdata->mem_freelist = elem;
-      } else if (segid < 0){
-        elem->next            = segdata->reg_freelist;
-        segdata->reg_freelist = elem;
-      } else {
-        // This should not happen!
-        DART_ASSERT(segid != 0);
-      }
-      // set the segment ID again
-      elem->data.segid = segid;
-      return DART_OK;
     }
+  }
 
-    pred = elem;
-    elem = elem->next;
+  if (elem == NULL) {
+    // element not found
+    return DART_ERR_INVAL;
   }
 
-  // element not found
-  return DART_ERR_INVAL;
+  // no need for locking since operations on the same segmentdata
+  // are not thread-safe
+  if (segid > 0) {
+    elem->next            = segdata->mem_freelist;
+    segdata->mem_freelist = elem;
+  } else if (segid < 0){
+    elem->next            = segdata->reg_freelist;
+    segdata->reg_freelist = elem;
+  } else {
+    // This should not happen!
+    DART_ASSERT(segid != 0);
+  }
+  // set the segment ID again
+  elem->data.segid = segid;
+  return DART_OK;
 }
 
 static void clear_segdata_list(dart_seghash_elem_t *listhead)
@@ -365,7 +402,13 @@ dart_ret_t dart_segment_fini(
     free_segment_info(seg);
   }
 
-  // clear the remaining hash table
+  // clear the remaining direct lookup table and hash table
+  for (int i = 0; i < DART_SEGMENT_TABLE_SIZE; i++) {
+    if (segdata->segtab[i] != NULL) {
+      clear_segdata_list(table_elem(segdata->segtab[i]));
+      segdata->segtab[i] = NULL;
+    }
+  }
   for (int i = 0; i < DART_SEGMENT_HASH_SIZE; i++) {
     clear_segdata_list(segdata->hashtab[i]);
     segdata->hashtab[i] = NULL;
@@ -0,0 +1,181 @@
+/**
+ * \file dart_stats.c
+ *
+ * Implementation of communication statistics counters.
+ */
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_stats.h>
+
+#include <dash/dart/mpi/dart_stats_priv.h>
+
+#include <dash/dart/base/logging.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+bool dart__mpi__stats_enabled_ = false;
+
+static dart_stats_counters_t dart__mpi__stats_ops_[DART_STATS_NUM_OPS];
+
+/* Calls and bytes by global target unit, interleaved: */
+static uint64_t            * dart__mpi__stats_targets_     = NULL;
+static int                   dart__mpi__stats_num_targets_ = 0;
+
+static const char * const dart__mpi__stats_op_names_[DART_STATS_NUM_OPS] = {
+  "get",
+  "get_handle",
+  "get_blocking",
+  "put",
+  "put_handle",
+  "put_blocking",
+  "put_combining",
+  "accumulate",
+  "accumulate_combining",
+  "fetch_and_op",
+  "compare_and_swap",
+  "barrier",
+  "bcast",
+  "scatter",
+  "gather",
+  "allgather",
+  "allgatherv",
+  "allreduce",
+  "alltoall",
+  "alltoallv",
+  "reduce",
+  "ibarrier",
+  "ibcast",
+  "iallreduce",
+  "ialltoall",
+  "send",
+  "recv",
+  "sendrecv"
+};
+
+/* Counters are updated with relaxed atomics as units may communicate from
+ * multiple threads: */
+#define DART__MPI__STATS_ADD(_counter, _val) \
+  __atomic_fetch_add(&(_counter), (_val), __ATOMIC_RELAXED)
+
+#define DART__MPI__STATS_LOAD(_counter) \
+  __atomic_load_n(&(_counter), __ATOMIC_RELAXED)
+
+dart_ret_t dart__mpi__stats_init(int num_units)
+{
+  memset(dart__mpi__stats_ops_, 0, sizeof(dart__mpi__stats_ops_));
+  dart__mpi__stats_targets_     = calloc(2 * num_units, sizeof(uint64_t));
+  dart__mpi__stats_num_targets_ = num_units;
+
+  const char * env_stats = getenv("DART_ENABLE_STATS");
+  dart__mpi__stats_enabled_ = (env_stats != NULL &&
+                               (strcmp(env_stats, "1")  == 0 ||
+                                strcmp(env_stats, "on") == 0));
+  DART_LOG_DEBUG("dart__mpi__stats_init: units:%d enabled:%d",
+                 num_units, dart__mpi__stats_enabled_);
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__stats_fini()
+{
+  dart__mpi__stats_enabled_     = false;
+  free(dart__mpi__stats_targets_);
+  dart__mpi__stats_targets_     = NULL;
+  dart__mpi__stats_num_targets_ = 0;
+  return DART_OK;
+}
+
+void dart__mpi__stats_record(
+  dart_stats_op_t   op,
+  dart_stats_path_t path,
+  size_t            nbytes,
+  int               target)
+{
+  dart_stats_counters_t * counters = &dart__mpi__stats_ops_[op];
+  DART__MPI__STATS_ADD(counters->calls, 1);
+  DART__MPI__STATS_ADD(counters->bytes, nbytes);
+  DART__MPI__STATS_ADD(counters->path_calls[path], 1);
+  DART__MPI__STATS_ADD(counters->path_bytes[path], nbytes);
+  if (target >= 0 && target < dart__mpi__stats_num_targets_) {
+    DART__MPI__STATS_ADD(dart__mpi__stats_targets_[2 * target],     1);
+    DART__MPI__STATS_ADD(dart__mpi__stats_targets_[2 * target + 1], nbytes);
+  }
+}
+
+dart_ret_t dart_stats_enable(
+  bool                    enable)
+{
+  DART_LOG_DEBUG("dart_stats_enable(%d)", enable);
+  dart__mpi__stats_enabled_ = enable;
+  return DART_OK;
+}
+
+dart_ret_t dart_stats_enabled(
+  bool                  * enabled)
+{
+  *enabled = dart__mpi__stats_enabled_;
+  return DART_OK;
+}
+
+dart_ret_t dart_stats_reset()
+{
+  DART_LOG_DEBUG("dart_stats_reset()");
+  memset(dart__mpi__stats_ops_, 0, sizeof(dart__mpi__stats_ops_));
+  if (dart__mpi__stats_targets_ != NULL) {
+    memset(dart__mpi__stats_targets_, 0,
+           2 * dart__mpi__stats_num_targets_ * sizeof(uint64_t));
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_stats_op(
+  dart_stats_op_t         op,
+  dart_stats_counters_t * counters)
+{
+  if (op < 0 || op >= DART_STATS_NUM_OPS || counters == NULL) {
+    DART_LOG_ERROR("dart_stats_op ! invalid arguments (op:%d)", op);
+    return DART_ERR_INVAL;
+  }
+  const dart_stats_counters_t * op_counters = &dart__mpi__stats_ops_[op];
+  counters->calls = DART__MPI__STATS_LOAD(op_counters->calls);
+  counters->bytes = DART__MPI__STATS_LOAD(op_counters->bytes);
+  for (int p = 0; p < DART_STATS_NUM_PATHS; ++p) {
+    counters->path_calls[p] =
+      DART__MPI__STATS_LOAD(op_counters->path_calls[p]);
+    counters->path_bytes[p] =
+      DART__MPI__STATS_LOAD(op_counters->path_bytes[p]);
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_stats_op_name(
+  dart_stats_op_t         op,
+  const char           ** name)
+{
+  if (op < 0 || op >= DART_STATS_NUM_OPS || name == NULL) {
+    DART_LOG_ERROR("dart_stats_op_name ! invalid arguments (op:%d)", op);
+    return DART_ERR_INVAL;
+  }
+  *name = dart__mpi__stats_op_names_[op];
+  return DART_OK;
+}
+
+dart_ret_t dart_stats_target_histogram(
+  uint64_t              * calls,
+  uint64_t              * bytes,
+  size_t                  num_units)
+{
+  size_t num_targets = (size_t)dart__mpi__stats_num_targets_;
+  if (num_units < num_targets) {
+    num_targets = num_units;
+  }
+  for (size_t u = 0; u < num_targets; ++u) {
+    if (calls != NULL) {
+      calls[u] = DART__MPI__STATS_LOAD(dart__mpi__stats_targets_[2 * u]);
+    }
+    if (bytes != NULL) {
+      bytes[u] =
+        DART__MPI__STATS_LOAD(dart__mpi__stats_targets_[2 * u + 1]);
+    }
+  }
+  return DART_OK;
+}
@@ -7,6 +7,8 @@
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/assert.h>
 #include <dash/dart/base/mutex.h>
+#include <dash/dart/base/macro.h>
+#include <dash/dart/base/config.h>
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_globmem.h>
@@ -23,6 +25,57 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
+#include <sched.h>
+
+/**
+ * Maximum number of consecutive hand-offs of the lock between units on the
+ * same node before the global lock is passed on to the next node.
+ */
+#define DART_LOCK_MAX_LOCAL_PASSES 64
+
+/**
+ * Number of spin iterations between triggering MPI progress while waiting
+ * for a node-local hand-off.
+ */
+#define DART_LOCK_SPIN_PROGRESS    256
+
+/**
+ * States of a unit waiting in the node-local lock queue.
+ */
+enum {
+  /** Waiting for the hand-off from the predecessor */
+  DART_LOCK_NODE_WAIT        = 0,
+  /** Node-local lock handed off, global lock has to be acquired */
+  DART_LOCK_NODE_PASS_LOCAL  = 1,
+  /** Node-local lock handed off together with the global lock */
+  DART_LOCK_NODE_PASS_GLOBAL = 2
+};
+
+/**
+ * Queue element of a unit in the node-local lock queue, padded to a
+ * cache line so units spin on separate lines.
+ */
+typedef struct
+{
+  /** Node-local ID of the successor in the queue, -1 if none */
+  int32_t next;
+  /** Hand-off state the unit spins on, see DART_LOCK_NODE_* */
+  int32_t state;
+  char    padding[DART__ARCH__CACHE_LINE_SIZE - 2 * sizeof(int32_t)];
+} dart_lock_node_slot_t;
+
+/**
+ * Node-local lock queue in shared memory, followed by the slots of all
+ * units on the node.
+ */
+typedef struct
+{
+  /** Node-local ID of the unit at the tail of the queue, -1 if none */
+  int32_t tail;
+  /** Number of consecutive hand-offs with the global lock held */
+  int32_t num_local_passes;
+  char    padding[DART__ARCH__CACHE_LINE_SIZE - 2 * sizeof(int32_t)];
+} dart_lock_node_header_t;
 
 struct dart_lock_struct
 {
@@ -33,9 +86,28 @@ struct dart_lock_struct
   dart_gptr_t  gptr_tail;
   /**
    * Pointer to the current unit's successor in the waiting list,
-   * to which we send a release message.
+   * to which we send a release message, followed by the notification
+   * flag of the global queue of the hierarchical lock.
    */
   dart_gptr_t  gptr_list;
+  /**
+   * Shared memory window of the node-local lock queue, \c MPI_WIN_NULL
+   * if the lock is not hierarchical.
+   */
+  MPI_Win      node_win;
+  /** Node-local lock queue in \c node_win, \c NULL if not hierarchical */
+  dart_lock_node_header_t * node_header;
+  /** Node-local queue elements of all units on the node */
+  dart_lock_node_slot_t   * node_slots;
+  /** ID of this unit in the node-local queue */
+  int32_t      node_unitid;
+  /**
+   * Team-relative ID of the node leader, identifies the node in the
+   * global lock queue.
+   */
+  dart_team_unit_t node_leader;
+  /** Whether the team spans multiple nodes and the global queue is used */
+  bool         is_multinode;
   /**
    * Pointer to the next element a the list.
    */
@@ -51,6 +123,23 @@ struct dart_lock_struct
 
 static dart_ret_t destroy_lock_segments(dart_lock_t lock);
 
+static dart_ret_t init_node_queue(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data);
+
+static dart_ret_t acquire_hierarchical(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data);
+
+static dart_ret_t try_acquire_hierarchical(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data,
+  int32_t                * is_acquired);
+
+static dart_ret_t release_hierarchical(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data);
+
 dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
 {
   int ret;
@@ -88,8 +177,8 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
 
   /* Create a global memory region across the team.
    * Every local memory segment holds the next unit
-   * waiting on the lock. */
-  ret = dart_team_memalloc_aligned(teamid, 1, DART_TYPE_INT, &gptr_list);
+   * waiting on the lock and the notification flag. */
+  ret = dart_team_memalloc_aligned(teamid, 2, DART_TYPE_INT, &gptr_list);
   if (ret != DART_OK) {
     DART_LOG_ERROR("%s: Failed to allocate global memory!", __func__);
     return ret;
@@ -102,7 +191,8 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
 
   dart_gptr_setunit(&gptr_list, unitid);
   dart_gptr_getaddr(gptr_list, (void*)&list_ptr);
-  *list_ptr = -1;
+  list_ptr[0] = -1;
+  list_ptr[1] = 0;
   MPI_Win_sync(win);
 
   // communicate tail pointer
@@ -123,10 +213,19 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
   (*lock)->gptr_list   = gptr_list;
   (*lock)->teamid      = teamid;
   (*lock)->is_acquired = 0;
+  (*lock)->node_win    = MPI_WIN_NULL;
+  (*lock)->node_header = NULL;
+  (*lock)->node_slots  = NULL;
   DART_ASSERT_RETURNS(
     dart__base__mutex_init_recursive(&(*lock)->mutex),
     DART_OK);
 
+  ret = init_node_queue(*lock, team_data);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to create node-local lock queue!", __func__);
+    return ret;
+  }
+
   // register the lock
   (*lock)->next   = team_data->allocated_locks;
   team_data->allocated_locks = (*lock);
@@ -156,6 +255,18 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
     return DART_ERR_INVAL;
   }
 
+  if (lock->node_header != NULL) {
+    dart_ret_t ret = acquire_hierarchical(lock, team_data);
+    if (ret != DART_OK) {
+      DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+      return ret;
+    }
+    DART_LOG_DEBUG("dart_lock_acquire: lock acquired in team %d",
+                   lock->teamid);
+    lock->is_acquired = 1;
+    return DART_OK;
+  }
+
   dart_gptr_t gptr_tail = lock->gptr_tail;
   dart_gptr_t gptr_list = lock->gptr_list;
 
@@ -249,6 +360,21 @@ dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *is_acquired)
     return DART_ERR_INVAL;
   }
 
+  if (lock->node_header != NULL) {
+    dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+    DART_ASSERT(team_data != NULL);
+    dart_ret_t ret = try_acquire_hierarchical(lock, team_data, is_acquired);
+    if (ret != DART_OK || !(*is_acquired)) {
+      DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    } else {
+      lock->is_acquired = 1;
+    }
+    DART_LOG_DEBUG("dart_lock_try_acquire: trylock %s in team %d",
+                   (*is_acquired) ? "succeeded" : "failed",
+                   lock->teamid);
+    return ret;
+  }
+
   dart_team_unit_t unitid;
   dart_team_myid(lock->teamid, &unitid);
 
@@ -306,6 +432,18 @@ dart_ret_t dart_lock_release(dart_lock_t lock)
   dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
   DART_ASSERT(team_data != NULL);
 
+  if (lock->node_header != NULL) {
+    dart_ret_t ret = release_hierarchical(lock, team_data);
+    if (ret != DART_OK) {
+      return ret;
+    }
+    lock->is_acquired = 0;
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    DART_LOG_DEBUG("dart_lock_release: release lock in team %d",
+                   (lock -> teamid));
+    return DART_OK;
+  }
+
   uint64_t      offset_tail = gptr_tail.addr_or_offs.offset;
   dart_unit_t   tail        = gptr_tail.unitid;
   int32_t     * addr;
@@ -373,7 +511,7 @@ dart_ret_t dart_lock_release(dart_lock_t lock)
 
     /* Notifying the next unit waiting on the lock queue. */
     MPI_Send(NULL, 0, MPI_INT, next, 0, team_data->comm);
-    *addr = -1;
+    addr[0] = -1;
     MPI_Win_sync(win);
   }
   lock->is_acquired = 0;
@@ -442,6 +580,449 @@ dart_ret_t dart__mpi__destroylocks(struct dart_lock_struct *allocated_locks)
   return DART_OK;
 }
 
+/*
+ * Hierarchical lock
+ *
+ * Units on the same node queue in a node-local MCS lock in a shared memory
+ * window and spin on their own cache line until their predecessor hands
+ * off the lock without involving MPI.
+ * The unit holding the node-local lock acquires the global MCS lock on
+ * behalf of its node: the global queue contains one element per node
+ * stored at the node leader, the tail identifies the node by its leader.
+ * The global lock is passed on to the next unit in the node-local queue
+ * together with the node-local lock up to DART_LOCK_MAX_LOCAL_PASSES
+ * times before it is released to other nodes.
+ */
+
+static inline
+dart_lock_node_slot_t * node_slot(dart_lock_t lock, int32_t node_unitid)
+{
+  return &lock->node_slots[node_unitid];
+}
+
+static inline void node_spin_progress(
+  dart_team_data_t       * team_data,
+  int                      iteration)
+{
+  if (iteration % DART_LOCK_SPIN_PROGRESS == 0) {
+    // trigger progress of RMA operations targeting this unit
+    int flag;
+    MPI_Iprobe(
+      MPI_ANY_SOURCE, MPI_ANY_TAG,
+      team_data->comm, &flag, MPI_STATUS_IGNORE);
+    sched_yield();
+  }
+}
+
+static dart_ret_t init_node_queue(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data)
+{
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (team_data->sharedmem_comm == MPI_COMM_NULL) {
+    return DART_OK;
+  }
+
+  int node_unitid;
+  MPI_Comm_rank(team_data->sharedmem_comm, &node_unitid);
+
+  /* The node leader allocates the queue of all units on the node with
+   * additional space to align it to a cache line: */
+  MPI_Aint nbytes = (node_unitid != 0)
+                    ? 0
+                    : sizeof(dart_lock_node_header_t) +
+                      team_data->sharedmem_nodesize *
+                        sizeof(dart_lock_node_slot_t) +
+                      DART__ARCH__CACHE_LINE_SIZE;
+  char   * baseptr;
+  MPI_Win  node_win;
+  if (MPI_Win_allocate_shared(
+        nbytes, 1, MPI_INFO_NULL, team_data->sharedmem_comm,
+        &baseptr, &node_win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("%s: MPI_Win_allocate_shared failed", __func__);
+    return DART_ERR_OTHER;
+  }
+  if (node_unitid != 0) {
+    MPI_Aint winseg_size;
+    int      disp_unit;
+    MPI_Win_shared_query(node_win, 0, &winseg_size, &disp_unit, &baseptr);
+  }
+  /* Shared memory is mapped at page boundaries so the aligned address
+   * refers to the same location in all units: */
+  const uintptr_t line_size = DART__ARCH__CACHE_LINE_SIZE;
+  uintptr_t aligned = ((uintptr_t)baseptr + line_size - 1) &
+                      ~(line_size - 1);
+
+  lock->node_win    = node_win;
+  lock->node_header = (dart_lock_node_header_t *)aligned;
+  lock->node_slots  = (dart_lock_node_slot_t *)(lock->node_header + 1);
+  lock->node_unitid = node_unitid;
+
+  if (node_unitid == 0) {
+    lock->node_header->tail             = -1;
+    lock->node_header->num_local_passes = 0;
+    for (int i = 0; i < team_data->sharedmem_nodesize; ++i) {
+      lock->node_slots[i].next  = -1;
+      lock->node_slots[i].state = DART_LOCK_NODE_WAIT;
+    }
+  }
+
+  for (size_t u = 0; u < team_data->size; ++u) {
+    if (team_data->sharedmem_tab[u].id == 0) {
+      lock->node_leader = DART_TEAM_UNIT_ID(u);
+      break;
+    }
+  }
+  lock->is_multinode = (team_data->sharedmem_nodesize <
+                        (int)team_data->size);
+
+  MPI_Barrier(team_data->sharedmem_comm);
+
+  DART_LOG_DEBUG("%s: node unit:%d node leader:%d multi-node:%d",
+                 __func__, node_unitid, lock->node_leader.id,
+                 lock->is_multinode);
+#else
+  dart__unused(lock);
+  dart__unused(team_data);
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  return DART_OK;
+}
+
+/**
+ * Acquire the global lock on behalf of the node of the calling unit.
+ */
+static dart_ret_t acquire_global(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data)
+{
+  dart_team_unit_t unitid = DART_TEAM_UNIT_ID(team_data->unitid);
+  dart_gptr_t gptr_tail   = lock->gptr_tail;
+  dart_unit_t tail_unit   = gptr_tail.unitid;
+  uint64_t    tail_offset = gptr_tail.addr_or_offs.offset;
+
+  dart_segment_info_t *list_seginfo = dart_segment_get_info(
+                                    &(team_data->segdata),
+                                    lock->gptr_list.segid);
+  MPI_Win  win       = list_seginfo->win;
+  MPI_Aint disp_flag = dart_segment_disp(list_seginfo, unitid) +
+                       sizeof(int32_t);
+
+  /* Reset the notification flag before enqueuing the node */
+  int32_t * list_ptr;
+  dart_gptr_t gptr_list = lock->gptr_list;
+  dart_gptr_setunit(&gptr_list, unitid);
+  DART_ASSERT_RETURNS(dart_gptr_getaddr(gptr_list, (void*)&list_ptr),
+                      DART_OK);
+  list_ptr[1] = 0;
+  MPI_Win_sync(win);
+
+  int32_t predecessor;
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(
+      &lock->node_leader.id,
+      &predecessor,
+      MPI_INT32_T,
+      tail_unit,
+      tail_offset,
+      MPI_REPLACE,
+      dart_win_local_alloc),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(tail_unit, dart_win_local_alloc),
+    MPI_SUCCESS);
+
+  if (predecessor == -1) {
+    return DART_OK;
+  }
+
+  /* Register this unit as successor of the predecessor node */
+  int32_t  result;
+  MPI_Aint disp_list = dart_segment_disp(
+                         list_seginfo, DART_TEAM_UNIT_ID(predecessor));
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(
+      &unitid.id,
+      &result,
+      MPI_INT32_T,
+      predecessor,
+      disp_list,
+      MPI_REPLACE,
+      win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(predecessor, win),
+    MPI_SUCCESS);
+
+  DART_LOG_DEBUG("%s: waiting for notification from node %d in team %d",
+                 __func__, predecessor, lock->teamid);
+  int32_t flag;
+  do {
+    int probe_flag;
+    MPI_Iprobe(
+      MPI_ANY_SOURCE, MPI_ANY_TAG,
+      team_data->comm, &probe_flag, MPI_STATUS_IGNORE);
+    DART_ASSERT_RETURNS(
+      MPI_Fetch_and_op(
+        NULL,
+        &flag,
+        MPI_INT32_T,
+        unitid.id,
+        disp_flag,
+        MPI_NO_OP,
+        win),
+      MPI_SUCCESS);
+    DART_ASSERT_RETURNS(
+      MPI_Win_flush(unitid.id, win),
+      MPI_SUCCESS);
+  } while (flag == 0);
+
+  return DART_OK;
+}
+
+/**
+ * Release the global lock held on behalf of the node of the calling unit.
+ */
+static dart_ret_t release_global(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data)
+{
+  dart_gptr_t gptr_tail   = lock->gptr_tail;
+  dart_unit_t tail_unit   = gptr_tail.unitid;
+  uint64_t    tail_offset = gptr_tail.addr_or_offs.offset;
+  int32_t     leader      = lock->node_leader.id;
+
+  int32_t result;
+  int32_t reset = -1;
+  DART_ASSERT_RETURNS(
+    MPI_Compare_and_swap(
+      &reset,
+      &leader,
+      &result,
+      MPI_INT32_T,
+      tail_unit,
+      tail_offset,
+      dart_win_local_alloc),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(tail_unit, dart_win_local_alloc),
+    MPI_SUCCESS);
+
+  if (result == leader) {
+    /* No other node is waiting */
+    return DART_OK;
+  }
+
+  dart_segment_info_t *list_seginfo = dart_segment_get_info(
+                                    &(team_data->segdata),
+                                    lock->gptr_list.segid);
+  MPI_Win  win       = list_seginfo->win;
+  MPI_Aint disp_list = dart_segment_disp(list_seginfo, lock->node_leader);
+
+  /* Wait for the successor to register at the node leader */
+  int32_t next;
+  do {
+    int flag;
+    MPI_Iprobe(
+      MPI_ANY_SOURCE, MPI_ANY_TAG,
+      team_data->comm, &flag, MPI_STATUS_IGNORE);
+    DART_ASSERT_RETURNS(
+      MPI_Fetch_and_op(
+        NULL,
+        &next,
+        MPI_INT32_T,
+        leader,
+        disp_list,
+        MPI_NO_OP,
+        win),
+      MPI_SUCCESS);
+    DART_ASSERT_RETURNS(
+      MPI_Win_flush(leader, win),
+      MPI_SUCCESS);
+  } while (next == -1);
+
+  /* Reset the queue element of this node before notifying the successor */
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(
+      &reset,
+      &result,
+      MPI_INT32_T,
+      leader,
+      disp_list,
+      MPI_REPLACE,
+      win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(leader, win),
+    MPI_SUCCESS);
+
+  DART_LOG_DEBUG("%s: notifying %d in team %d",
+                 __func__, next, lock->teamid);
+  int32_t  notify    = 1;
+  MPI_Aint disp_flag = dart_segment_disp(
+                         list_seginfo, DART_TEAM_UNIT_ID(next)) +
+                       sizeof(int32_t);
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(
+      &notify,
+      &result,
+      MPI_INT32_T,
+      next,
+      disp_flag,
+      MPI_REPLACE,
+      win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(next, win),
+    MPI_SUCCESS);
+
+  return DART_OK;
+}
+
+/**
+ * Hand off the node-local lock to the next unit in the node-local queue
+ * or release it if no unit is waiting.
+ */
+static dart_ret_t release_node(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data,
+  bool                     global_held)
+{
+  dart_lock_node_header_t * header = lock->node_header;
+  dart_lock_node_slot_t   * slot   = node_slot(lock, lock->node_unitid);
+
+  int32_t succ = __atomic_load_n(&slot->next, __ATOMIC_ACQUIRE);
+  if (succ == -1) {
+    if (global_held) {
+      DART_ASSERT_RETURNS(release_global(lock, team_data), DART_OK);
+    }
+    int32_t expected = lock->node_unitid;
+    if (__atomic_compare_exchange_n(
+          &header->tail, &expected, -1, false,
+          __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+      return DART_OK;
+    }
+    /* A successor is enqueuing, wait for it to register */
+    int iteration = 0;
+    while ((succ = __atomic_load_n(&slot->next, __ATOMIC_ACQUIRE)) == -1) {
+      node_spin_progress(team_data, ++iteration);
+    }
+    __atomic_store_n(&node_slot(lock, succ)->state,
+                     DART_LOCK_NODE_PASS_LOCAL, __ATOMIC_RELEASE);
+    return DART_OK;
+  }
+
+  if (global_held &&
+      header->num_local_passes < DART_LOCK_MAX_LOCAL_PASSES) {
+    header->num_local_passes++;
+    __atomic_store_n(&node_slot(lock, succ)->state,
+                     DART_LOCK_NODE_PASS_GLOBAL, __ATOMIC_RELEASE);
+    return DART_OK;
+  }
+  if (global_held) {
+    DART_ASSERT_RETURNS(release_global(lock, team_data), DART_OK);
+  }
+  __atomic_store_n(&node_slot(lock, succ)->state,
+                   DART_LOCK_NODE_PASS_LOCAL, __ATOMIC_RELEASE);
+  return DART_OK;
+}
+
+static dart_ret_t acquire_hierarchical(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data)
+{
+  dart_lock_node_header_t * header = lock->node_header;
+  dart_lock_node_slot_t   * slot   = node_slot(lock, lock->node_unitid);
+
+  __atomic_store_n(&slot->next,  -1, __ATOMIC_RELAXED);
+  __atomic_store_n(&slot->state, DART_LOCK_NODE_WAIT, __ATOMIC_RELAXED);
+
+  int32_t predecessor = __atomic_exchange_n(
+                          &header->tail, lock->node_unitid,
+                          __ATOMIC_ACQ_REL);
+  int32_t state = DART_LOCK_NODE_PASS_LOCAL;
+  if (predecessor != -1) {
+    __atomic_store_n(&node_slot(lock, predecessor)->next,
+                     lock->node_unitid, __ATOMIC_RELEASE);
+    DART_LOG_TRACE("%s: waiting for node-local predecessor %d",
+                   __func__, predecessor);
+    int iteration = 0;
+    while ((state = __atomic_load_n(&slot->state, __ATOMIC_ACQUIRE))
+           == DART_LOCK_NODE_WAIT) {
+      node_spin_progress(team_data, ++iteration);
+    }
+  }
+
+  if (state == DART_LOCK_NODE_PASS_GLOBAL || !lock->is_multinode) {
+    return DART_OK;
+  }
+  DART_ASSERT_RETURNS(acquire_global(lock, team_data), DART_OK);
+  header->num_local_passes = 0;
+  return DART_OK;
+}
+
+static dart_ret_t try_acquire_hierarchical(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data,
+  int32_t                * is_acquired)
+{
+  dart_lock_node_header_t * header = lock->node_header;
+  dart_lock_node_slot_t   * slot   = node_slot(lock, lock->node_unitid);
+
+  *is_acquired = 0;
+
+  /* Fail early without modifying the queue if the lock is held on the
+   * node */
+  if (__atomic_load_n(&header->tail, __ATOMIC_RELAXED) != -1) {
+    return DART_OK;
+  }
+
+  __atomic_store_n(&slot->next,  -1, __ATOMIC_RELAXED);
+  __atomic_store_n(&slot->state, DART_LOCK_NODE_WAIT, __ATOMIC_RELAXED);
+
+  int32_t expected = -1;
+  if (!__atomic_compare_exchange_n(
+         &header->tail, &expected, lock->node_unitid, false,
+         __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+    return DART_OK;
+  }
+
+  /* The node-local lock has not been handed off, so the global lock is
+   * not held by this node */
+  if (lock->is_multinode) {
+    int32_t result;
+    int32_t compare   = -1;
+    dart_unit_t tail_unit   = lock->gptr_tail.unitid;
+    uint64_t    tail_offset = lock->gptr_tail.addr_or_offs.offset;
+    DART_ASSERT_RETURNS(
+      MPI_Compare_and_swap(
+        &lock->node_leader.id,
+        &compare,
+        &result,
+        MPI_INT32_T,
+        tail_unit,
+        tail_offset,
+        dart_win_local_alloc),
+      MPI_SUCCESS);
+    DART_ASSERT_RETURNS(
+      MPI_Win_flush(tail_unit, dart_win_local_alloc),
+      MPI_SUCCESS);
+    if (result != -1) {
+      /* Global lock held by another node, release the node-local lock */
+      return release_node(lock, team_data, false);
+    }
+    header->num_local_passes = 0;
+  }
+  *is_acquired = 1;
+  return DART_OK;
+}
+
+static dart_ret_t release_hierarchical(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data)
+{
+  return release_node(lock, team_data, lock->is_multinode);
+}
+
 
 static
 dart_ret_t destroy_lock_segments(dart_lock_t lock)
@@ -473,6 +1054,11 @@ dart_ret_t destroy_lock_segments(dart_lock_t lock)
     }
     lock->gptr_list = DART_GPTR_NULL;
   }
+  if (lock->node_win != MPI_WIN_NULL) {
+    MPI_Win_free(&lock->node_win);
+    lock->node_header = NULL;
+    lock->node_slots  = NULL;
+  }
 
   return DART_OK;
 }
@@ -19,6 +19,7 @@
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_group_priv.h>
 #include <dash/dart/mpi/dart_synchronization_priv.h>
+#include <dash/dart/mpi/dart_collective_hier_priv.h>
 
 #include <limits.h>
 
@@ -633,6 +634,10 @@ dart_ret_t dart_team_create(
     team_data->unitid = rank;
     MPI_Comm_size(team_data->comm, &team_data->size);
 
+    if (dart_team_unit_tables_init(team_data) != DART_OK) {
+      return DART_ERR_OTHER;
+    }
+
     team_data->allocated_locks = NULL;
 
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
@@ -669,6 +674,7 @@ dart_ret_t dart_team_destroy(
   // free(dart_unit_mapping[index]);
 
   // MPI_Win_free (&(sharedmem_win_list[index]));
+  dart__mpi__hier_fini(team_data);
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   free(team_data->sharedmem_tab);
 #endif
@@ -681,11 +687,13 @@ dart_ret_t dart_team_destroy(
 
   dart_segment_fini(&team_data->segdata);
 
-  dart_adapt_teamlist_dealloc(*teamid);
+  dart_team_unit_tables_fini(team_data);
 
   dart__mpi__destroylocks(team_data->allocated_locks);
   team_data->allocated_locks = NULL;
 
+  dart_adapt_teamlist_dealloc(*teamid);
+
   DART_LOG_DEBUG("dart_team_destroy > teamid:%d", *teamid);
 
   *teamid = DART_TEAM_NULL;
@@ -772,45 +780,19 @@ dart_ret_t dart_team_unit_l2g(
   dart_team_unit_t     localid,
   dart_global_unit_t * globalid)
 {
-#if 0
-  dart_unit_t *unitids;
-  int size;
-  int i = 0;
-  dart_group_t group;
-  dart_team_get_group (teamid, &group);
-  MPI_Group_size (group.mpi_group, &size);
-  if (localid >= size)
-  {
-    DART_LOG_ERROR ("Invalid localid input");
-    return DART_ERR_INVAL;
-  }
-  unitids = (dart_unit_t*)malloc (sizeof(dart_unit_t) * size);
-  dart_group_getmembers (&group, unitids);
-
-  /* The unitids array is arranged in ascending order. */
-  *globalid = unitids[localid];
-//  printf ("globalid is %d\n", *globalid);
-  return DART_OK;
-#endif
-
-  int size;
-  dart_group_t group;
-
   if (globalid == NULL) {
     return DART_ERR_INVAL;
   }
 
   *globalid = DART_UNDEFINED_GLOBAL_UNIT_ID;
 
-  dart_team_get_group (teamid, &group);
-  if (group == NULL) {
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
     DART_LOG_ERROR("Unknown teamid: %i", teamid);
     return DART_ERR_INVAL;
   }
-  MPI_Group_size (group->mpi_group, &size);
 
-  if (localid.id >= size) {
-    dart_group_destroy(&group);
+  if (localid.id < 0 || localid.id >= team_data->size) {
     DART_LOG_ERROR ("Invalid localid input: %d", localid.id);
     return DART_ERR_INVAL;
   }
@@ -818,16 +800,8 @@ dart_ret_t dart_team_unit_l2g(
     globalid->id = localid.id;
   }
   else {
-    MPI_Group group_all;
-    MPI_Comm_group(DART_COMM_WORLD, &group_all);
-    MPI_Group_translate_ranks(
-      group->mpi_group,
-      1,
-      &(localid.id),
-      group_all,
-      &(globalid->id));
+    *globalid = team_data->unit_l2g[localid.id];
   }
-  dart_group_destroy(&group);
 
   return DART_OK;
 }
@@ -837,51 +811,44 @@ dart_ret_t dart_team_unit_g2l(
   dart_global_unit_t   globalid,
   dart_team_unit_t   * localid)
 {
-#if 0
-  dart_unit_t *unitids;
-  int size;
-  int i;
-  dart_group_t group;
-  dart_team_get_group (teamid, &group);
-  MPI_Group_size (group.mpi_group, &size);
-  unitids = (dart_unit_t *)malloc (sizeof (dart_unit_t) * size);
-
-  dart_group_getmembers (&group, unitids);
-
-
-  for (i = 0; (i < size) && (unitids[i] < globalid); i++);
-
-  if ((i == size) || (unitids[i] > globalid))
-  {
-    *localid = -1;
-    return DART_OK;
-  }
-
-  *localid = i;
-  return DART_OK;
-#endif
   if (localid == NULL) {
     return DART_ERR_INVAL;
   }
   if(teamid == DART_TEAM_ALL) {
     localid->id = globalid.id;
+    return DART_OK;
   }
-  else {
-    dart_group_t group;
-    MPI_Group group_all;
-    dart_team_get_group(teamid, &group);
-    if (group == NULL) {
-      DART_LOG_ERROR("Invalid teamid: %i", teamid);
-      return DART_ERR_INVAL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("Invalid teamid: %i", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  // units not contained in the team are mapped to DART_UNDEFINED_UNIT_ID
+  *localid = DART_UNDEFINED_TEAM_UNIT_ID;
+  if (team_data->unit_g2l != NULL) {
+    size_t world_size;
+    dart_size(&world_size);
+    if (globalid.id >= 0 && (size_t)globalid.id < world_size) {
+      *localid = team_data->unit_g2l[globalid.id];
+    }
+  } else {
+    // binary search in the sparse table
+    const dart_team_unit_pair_t *tab = team_data->unit_g2l_sparse;
+    int lo = 0;
+    int hi = team_data->size;
+    while (lo < hi) {
+      int mid = lo + ((hi - lo) >> 1);
+      if (tab[mid].global.id < globalid.id) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    if (lo < team_data->size && tab[lo].global.id == globalid.id) {
+      *localid = tab[lo].local;
     }
-    MPI_Comm_group(DART_COMM_WORLD, &group_all);
-    MPI_Group_translate_ranks(
-      group_all,
-      1,
-      &(globalid.id),
-      group->mpi_group,
-      &(localid->id));
-    dart_group_destroy(&group);
   }
   return DART_OK;
 }
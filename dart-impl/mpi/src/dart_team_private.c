@@ -3,6 +3,8 @@
  *  @brief Implementations for the operations on teamlist.
  */
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_team_group.h>
 #include <dash/dart/mpi/dart_team_private.h>
@@ -13,6 +15,11 @@ dart_team_t dart_next_availteamid = (DART_TEAM_ALL + 1);
 
 MPI_Comm dart_comm_world;
 
+/* Direct-indexed team data of teams with IDs below DART_TEAM_TABLE_SIZE */
+dart_team_data_t *dart_team_table[DART_TEAM_TABLE_SIZE]
+  __attribute__((aligned(DART__ARCH__CACHE_LINE_SIZE)));
+
+/* Chained hash table of team data of teams with IDs exceeding the table */
 static dart_team_data_t *dart_team_data[DART_TEAM_HASH_SIZE];
 
 static int
@@ -181,14 +188,18 @@ int dart_adapt_teamlist_convert(
 dart_ret_t
 dart_adapt_teamlist_init()
 {
+  memset(dart_team_table, 0, sizeof(dart_team_data_t*) * DART_TEAM_TABLE_SIZE);
   memset(dart_team_data, 0, sizeof(dart_team_data_t*) * DART_TEAM_HASH_SIZE);
 
   return DART_OK;
 }
 
 dart_team_data_t *
-dart_adapt_teamlist_get(dart_team_t teamid)
+dart_adapt_teamlist_get_overflow(dart_team_t teamid)
 {
+  if (teamid < 0) {
+    return NULL;
+  }
   int slot = dart_adapt_teamlist_hash(teamid);
   dart_team_data_t *res = dart_team_data[slot];
   while (res != NULL && res->teamid != teamid) {
@@ -201,13 +212,23 @@ dart_adapt_teamlist_get(dart_team_t teamid)
 dart_ret_t
 dart_adapt_teamlist_dealloc(dart_team_t teamid)
 {
+  if (teamid >= 0 && teamid < DART_TEAM_TABLE_SIZE) {
+    dart_team_data_t *res = dart_team_table[teamid];
+    if (res == NULL) {
+      return DART_ERR_INVAL;
+    }
+    dart_team_table[teamid] = NULL;
+    free(res);
+    return DART_OK;
+  }
+
   int slot = dart_adapt_teamlist_hash(teamid);
-  dart_team_data_t *res = dart_team_data[slot];
-  dart_team_data_t **prev = NULL;
+  dart_team_data_t **prev = &dart_team_data[slot];
+  dart_team_data_t  *res  = dart_team_data[slot];
 
-  while (res != NULL && res->teamid == teamid) {
-    prev = &res;
-    res = res->next;
+  while (res != NULL && res->teamid != teamid) {
+    prev = &res->next;
+    res  = res->next;
   }
 
   // not found!
@@ -215,11 +236,7 @@ dart_adapt_teamlist_dealloc(dart_team_t teamid)
     return DART_ERR_INVAL;
   }
 
-  if (prev == NULL) {
-    dart_team_data[slot] = res->next;
-  } else {
-    (*prev)->next = res->next;
-  }
+  *prev = res->next;
 
   res->next = NULL;
   free(res);
@@ -229,12 +246,24 @@ dart_adapt_teamlist_dealloc(dart_team_t teamid)
 dart_ret_t
 dart_adapt_teamlist_alloc(dart_team_t teamid)
 {
-  int slot = dart_adapt_teamlist_hash(teamid);
-  dart_team_data_t *res = calloc(1, sizeof(dart_team_data_t));
+  dart_team_data_t *res;
+  // align the segment table in the team data to cache lines
+  if (posix_memalign((void**)&res, DART__ARCH__CACHE_LINE_SIZE,
+                     sizeof(dart_team_data_t)) != 0) {
+    DART_LOG_ERROR("dart_adapt_teamlist_alloc ! "
+                   "Failed to allocate team data for team %d", teamid);
+    return DART_ERR_OTHER;
+  }
+  memset(res, 0, sizeof(dart_team_data_t));
   res->teamid = teamid;
   res->unitid = DART_UNDEFINED_UNIT_ID;
-  res->next = dart_team_data[slot];
-  dart_team_data[slot] = res;
+  if (teamid >= 0 && teamid < DART_TEAM_TABLE_SIZE) {
+    dart_team_table[teamid] = res;
+  } else {
+    int slot = dart_adapt_teamlist_hash(teamid);
+    res->next = dart_team_data[slot];
+    dart_team_data[slot] = res;
+  }
   dart_segment_init(&(res->segdata), teamid);
   return DART_OK;
 }
@@ -242,12 +271,20 @@ dart_adapt_teamlist_alloc(dart_team_t teamid)
 
 dart_ret_t dart_adapt_teamlist_destroy()
 {
+  for (int i = 0; i < DART_TEAM_TABLE_SIZE; i++) {
+    if (dart_team_table[i] != NULL) {
+      dart_team_unit_tables_fini(dart_team_table[i]);
+      free(dart_team_table[i]);
+      dart_team_table[i] = NULL;
+    }
+  }
   for (int i = 0; i < DART_TEAM_HASH_SIZE; i++) {
     dart_team_data_t *elem = dart_team_data[i];
     while (elem != NULL) {
       dart_team_data_t *tmp = elem;
       elem = tmp->next;
       tmp->next = NULL;
+      dart_team_unit_tables_fini(tmp);
       free(tmp);
     }
     dart_team_data[i] = NULL;
@@ -255,6 +292,111 @@ dart_ret_t dart_adapt_teamlist_destroy()
   return DART_OK;
 }
 
+static int
+cmp_unit_pair(const void *lhs, const void *rhs)
+{
+  const dart_team_unit_pair_t *l = lhs;
+  const dart_team_unit_pair_t *r = rhs;
+  return (l->global.id > r->global.id) - (l->global.id < r->global.id);
+}
+
+dart_ret_t
+dart_team_unit_tables_init(dart_team_data_t *team_data)
+{
+  int size       = team_data->size;
+  int world_size;
+  MPI_Comm_size(DART_COMM_WORLD, &world_size);
+
+  MPI_Group group, group_all;
+  MPI_Comm_group(team_data->comm, &group);
+  MPI_Comm_group(DART_COMM_WORLD, &group_all);
+
+  int *ranks  = malloc(sizeof(int) * size);
+  int *granks = malloc(sizeof(int) * size);
+  if (ranks == NULL || granks == NULL) {
+    DART_LOG_ERROR("dart_team_unit_tables_init ! "
+                   "Failed to allocate rank tables of team %d",
+                   team_data->teamid);
+    free(ranks);
+    free(granks);
+    MPI_Group_free(&group);
+    MPI_Group_free(&group_all);
+    return DART_ERR_OTHER;
+  }
+  for (int i = 0; i < size; i++) {
+    ranks[i] = i;
+  }
+  // translate all ranks at once
+  MPI_Group_translate_ranks(group, size, ranks, group_all, granks);
+  MPI_Group_free(&group);
+  MPI_Group_free(&group_all);
+  free(ranks);
+
+  team_data->unit_g2l        = NULL;
+  team_data->unit_g2l_sparse = NULL;
+  team_data->unit_l2g = malloc(sizeof(dart_global_unit_t) * size);
+  if (team_data->unit_l2g == NULL) {
+    DART_LOG_ERROR("dart_team_unit_tables_init ! "
+                   "Failed to allocate unit table of team %d",
+                   team_data->teamid);
+    free(granks);
+    return DART_ERR_OTHER;
+  }
+  for (int i = 0; i < size; i++) {
+    team_data->unit_l2g[i].id = granks[i];
+  }
+  free(granks);
+
+  if (world_size <= DART_TEAM_G2L_DENSE_MIN ||
+      world_size <= DART_TEAM_G2L_DENSE_RATIO * size) {
+    team_data->unit_g2l = malloc(sizeof(dart_team_unit_t) * world_size);
+    if (team_data->unit_g2l == NULL) {
+      DART_LOG_ERROR("dart_team_unit_tables_init ! "
+                     "Failed to allocate unit table of team %d",
+                     team_data->teamid);
+      dart_team_unit_tables_fini(team_data);
+      return DART_ERR_OTHER;
+    }
+    for (int g = 0; g < world_size; g++) {
+      team_data->unit_g2l[g] = DART_UNDEFINED_TEAM_UNIT_ID;
+    }
+    for (int i = 0; i < size; i++) {
+      team_data->unit_g2l[team_data->unit_l2g[i].id] = DART_TEAM_UNIT_ID(i);
+    }
+  } else {
+    team_data->unit_g2l_sparse = malloc(sizeof(dart_team_unit_pair_t) * size);
+    if (team_data->unit_g2l_sparse == NULL) {
+      DART_LOG_ERROR("dart_team_unit_tables_init ! "
+                     "Failed to allocate unit table of team %d",
+                     team_data->teamid);
+      dart_team_unit_tables_fini(team_data);
+      return DART_ERR_OTHER;
+    }
+    for (int i = 0; i < size; i++) {
+      team_data->unit_g2l_sparse[i].global = team_data->unit_l2g[i];
+      team_data->unit_g2l_sparse[i].local  = DART_TEAM_UNIT_ID(i);
+    }
+    qsort(team_data->unit_g2l_sparse, size, sizeof(dart_team_unit_pair_t),
+          &cmp_unit_pair);
+  }
+  DART_LOG_DEBUG("dart_team_unit_tables_init: team %d size %d (%s g2l)",
+                 team_data->teamid, size,
+                 (team_data->unit_g2l != NULL) ? "dense" : "sparse");
+
+  return DART_OK;
+}
+
+void
+dart_team_unit_tables_fini(dart_team_data_t *team_data)
+{
+  free(team_data->unit_l2g);
+  team_data->unit_l2g        = NULL;
+  free(team_data->unit_g2l);
+  team_data->unit_g2l        = NULL;
+  free(team_data->unit_g2l_sparse);
+  team_data->unit_g2l_sparse = NULL;
+}
+
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 dart_ret_t dart_allocate_shared_comm(dart_team_data_t *team_data)
 {
@@ -135,6 +135,11 @@ std::pair<double, double> test_blas(
   unsigned                 repeat,
   const benchmark_params & params);
 
+std::pair<double, double> test_gemm(
+  extent_t                 sb,
+  unsigned                 repeat,
+  const benchmark_params & params);
+
 std::pair<double, double> test_plasma(
   extent_t                 sb,
   unsigned                 repeat,
@@ -213,6 +218,13 @@ int main(int argc, char* argv[])
 #else
       DASH_THROW(dash::exception::RuntimeError, "MKL not enabled");
 #endif
+    } else if (variant == "gemm" && dash::size() != 1) {
+      // Require single unit for built-in GEMM kernel variant:
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "GEMM variant of bench.10.summa called with " <<
+        "team size " << dash::size() << " " <<
+        "but must be run on a single unit.");
     } else {
 #ifdef DASH_ENABLE_MKL
       mkl_set_dynamic(false);
@@ -404,6 +416,8 @@ void perform_test(
   std::pair<double, double> t_mmult;
   if (variant == "mkl" || variant == "blas") {
     t_mmult = test_blas(n, num_repeats, params);
+  } else if (variant == "gemm") {
+    t_mmult = test_gemm(n, num_repeats, params);
   } else if (variant == "plasma") {
     t_mmult = test_plasma(n, num_repeats, params, tilesize);
   } else if (variant == "pblas") {
@@ -681,6 +695,64 @@ std::pair<double, double> test_blas(
 #endif
 }
 
+/**
+ * Returns pair of durations (init_secs, multiply_secs) of the built-in
+ * GEMM kernel used by dash::summa if no BLAS is available.
+ *
+ * Verification runs compare the result to BLAS, if available.
+ */
+std::pair<double, double> test_gemm(
+  extent_t sb,
+  unsigned repeat,
+  const benchmark_params & params)
+{
+  std::pair<double, double> time;
+
+  std::vector<value_t> l_matrix_a(sb * sb);
+  std::vector<value_t> l_matrix_b(sb * sb);
+  std::vector<value_t> l_matrix_c(sb * sb);
+
+  auto ts_init_start = Timer::Now();
+  init_values(l_matrix_a.data(), l_matrix_b.data(), l_matrix_c.data(),
+              sb, params);
+  time.first = Timer::ElapsedSince(ts_init_start);
+
+  auto ts_multiply_start = Timer::Now();
+  for (unsigned i = 0; i < repeat; ++i) {
+    dash::internal::gemm_blocked(
+      l_matrix_a.data(), l_matrix_b.data(), l_matrix_c.data(),
+      sb, sb, sb, dash::ROW_MAJOR);
+  }
+  time.second = Timer::ElapsedSince(ts_multiply_start);
+
+#if defined(DASH_ENABLE_MKL) || defined(DASH_ENABLE_BLAS)
+  if (params.verify) {
+    std::vector<value_t> l_matrix_r(sb * sb, 0);
+#ifdef DASH__BENCH_10_SUMMA__DOUBLE_PREC
+    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, sb, sb, sb,
+                repeat, l_matrix_a.data(), sb, l_matrix_b.data(), sb,
+                0.0, l_matrix_r.data(), sb);
+#else
+    cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, sb, sb, sb,
+                repeat, l_matrix_a.data(), sb, l_matrix_b.data(), sb,
+                0.0, l_matrix_r.data(), sb);
+#endif
+    for (extent_t p = 0; p < sb * sb; ++p) {
+      value_t expected = l_matrix_r[p];
+      value_t actual   = l_matrix_c[p];
+      if (std::abs(expected - actual) > 1.0e-3 * std::abs(expected)) {
+        DASH_THROW(
+          dash::exception::RuntimeError,
+          "Validation failed at offset " << p << ": " <<
+          "expected " << expected << ", got " << actual);
+      }
+    }
+  }
+#endif
+
+  return time;
+}
+
 /**
  * Returns pair of durations (init_secs, multiply_secs).
  *
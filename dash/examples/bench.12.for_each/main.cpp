@@ -1,12 +1,16 @@
 /**
  * Measures the performance of different
  * for_each implementations on dash containers
+ *
+ * Testcases using dash::execution::par are run for increasing numbers of
+ * threads per unit, throughput is also reported per node.
  */
 
 #include <libdash.h>
 #include <iostream>
 #include <iomanip>
 #include <string>
+#include <vector>
 
 using std::cout;
 using std::endl;
@@ -27,6 +31,7 @@ typedef struct benchmark_params_t {
 
 typedef struct measurement_t {
   std::string testcase;
+  int         threads;
   double      local_elems_s;
   double      local_size_mb;
   double      time_fill_s;
@@ -39,7 +44,8 @@ void print_measurement_header();
 void print_measurement_record(
   const bench_cfg_params & cfg_params,
   measurement              measurement,
-  const benchmark_params & params);
+  const benchmark_params & params,
+  long                     num_nodes);
 
 benchmark_params parse_args(int argc, char * argv[]);
 
@@ -51,6 +57,7 @@ void print_params(
 measurement evaluate(
               long size,
               std::string testcase,
+              int threads,
               benchmark_params params);
 
 int main(int argc, char** argv)
@@ -74,10 +81,20 @@ int main(int argc, char** argv)
 
   int     multiplier = 1;
   double  round_time = 0;
-  std::array<std::string, 3> testcases {{
+  std::array<std::string, 5> testcases {{
                             "std::for_each.l",
                             "dash::for_each.g",
-                            "dash::for_each_with_index.g" }};
+                            "dash::for_each_with_index.g",
+                            "dash::for_each.par.g",
+                            "dash::for_each_with_index.par.g" }};
+  // Thread counts for testcases using dash::execution::par, powers of two
+  // up to the thread capacity of the units' locality domains:
+  int max_threads = dash::execution::par.num_threads();
+  std::vector<int> par_threads;
+  for (int t = 1; t < max_threads; t *= 2) {
+    par_threads.push_back(t);
+  }
+  par_threads.push_back(max_threads);
   // Get locality information
   long num_nodes          = dash::util::Locality::NumNodes();
   long mb_per_node        = 8; // Intermediate, should be
@@ -93,8 +110,16 @@ int main(int argc, char** argv)
         (global_avail_bytes > global_req_bytes)) {
     auto time_start = Timer::Now();
     for(auto testcase : testcases){
-      res = evaluate(params.size_base*multiplier, testcase, params);
-      print_measurement_record(bench_cfg, res, params);
+      if (testcase.find(".par.") == std::string::npos) {
+        res = evaluate(params.size_base*multiplier, testcase, 1, params);
+        print_measurement_record(bench_cfg, res, params, num_nodes);
+        continue;
+      }
+      for (auto threads : par_threads) {
+        res = evaluate(params.size_base*multiplier, testcase, threads,
+                       params);
+        print_measurement_record(bench_cfg, res, params, num_nodes);
+      }
     }
     multiplier *= 2;
     round_time = Timer::ElapsedSince(time_start) / (1000 * 1000);
@@ -110,7 +135,8 @@ int main(int argc, char** argv)
   return 0;
 }
 
-measurement evaluate(long size, std::string testcase, benchmark_params params)
+measurement evaluate(
+  long size, std::string testcase, int threads, benchmark_params params)
 {
   measurement mes;
   long sum = 0;
@@ -130,6 +156,15 @@ measurement evaluate(long size, std::string testcase, benchmark_params params)
     [&sum](int el, long idx) {
       sum+=el;
     };
+  // thread-safe, modifies elements only
+  auto for_each_par =
+    [](int & el) {
+      el += 1;
+    };
+  auto for_each_index_par =
+    [](int & el, long idx) {
+      el += idx & 1;
+    };
 
   dash::barrier();
   auto ts_tot_start = Timer::Now();
@@ -144,6 +179,11 @@ measurement evaluate(long size, std::string testcase, benchmark_params params)
     dash::for_each_with_index(begin, end, for_each_index);
   } else if(testcase == "std::for_each.l") {
     std::for_each(lbegin, lend, for_each);
+  } else if(testcase == "dash::for_each.par.g") {
+    dash::for_each(dash::execution::par(threads), begin, end, for_each_par);
+  } else if(testcase == "dash::for_each_with_index.par.g") {
+    dash::for_each_with_index(dash::execution::par(threads), begin, end,
+                              for_each_index_par);
   }
 
   mes.time_foreach_s = Timer::ElapsedSince(ts_foreach_start) / (1000 * 1000);
@@ -151,6 +191,7 @@ measurement evaluate(long size, std::string testcase, benchmark_params params)
   mes.local_elems_s  = lsize / mes.time_foreach_s;
   mes.local_size_mb  = static_cast<double>((lsize * sizeof(int))/(1024*1024));
   mes.testcase       = testcase;
+  mes.threads        = threads;
   return mes;
 }
 
@@ -163,6 +204,8 @@ void print_measurement_header()
          << std::setw(12) << "l.size.mb"  << ","
          << std::setw(13) << "l.elems/s"  << ","
          << std::setw(30) << "impl"       << ","
+         << std::setw( 7) << "threads"    << ","
+         << std::setw(13) << "n.elems/s"  << ","
          << std::setw( 8) << "fill.s"     << ","
          << std::setw( 8) << "foreach.s"  << ","
          << std::setw( 8) << "total.s"
@@ -173,17 +216,24 @@ void print_measurement_header()
 void print_measurement_record(
   const bench_cfg_params & cfg_params,
   measurement              measurement,
-  const benchmark_params & params)
+  const benchmark_params & params,
+  long                     num_nodes)
 {
   if (dash::myid() == 0) {
     std::string mpi_impl = dash__toxstr(DASH_MPI_IMPL_ID);
     auto mes = measurement;
+    // Throughput per node, assuming units are distributed evenly
+    // to nodes:
+    double units_per_node = static_cast<double>(dash::size()) / num_nodes;
+    double node_elems_s   = mes.local_elems_s * units_per_node;
         cout << std::right
          << std::setw(5) << dash::size() << ","
          << std::setw(9) << mpi_impl     << ","
          << std::fixed << setprecision(2) << setw(12) << mes.local_size_mb  << ","
          << std::fixed << setprecision(2) << setw(12) << (mes.local_elems_s / 1000) << "k,"
          << std::fixed << setprecision(2) << setw(30) << mes.testcase       << ","
+         << std::setw(7) << mes.threads << ","
+         << std::fixed << setprecision(2) << setw(12) << (node_elems_s / 1000) << "k,"
          << std::fixed << setprecision(2) << setw(12) << mes.time_fill_s    << ","
          << std::fixed << setprecision(2) << setw(14) << mes.time_foreach_s << ","
          << std::fixed << setprecision(2) << setw(12) << mes.time_total_s
@@ -1,12 +1,17 @@
 /**
  * Measures the performance of different
  * for_each implementations on dash containers
+ *
+ * Reductions of global ranges using dash::execution::par are run for
+ * increasing numbers of threads per unit, throughput is also reported
+ * per node.
  */
 
 #include <libdash.h>
 #include <iostream>
 #include <iomanip>
 #include <string>
+#include <vector>
 #ifdef MPI_IMPL_ID
 #include <mpi.h>
 #endif
@@ -26,10 +31,13 @@ typedef typename dash::util::BenchmarkParams::config_params_type
 typedef struct benchmark_params_t {
   int    reps;
   int    rounds;
+  long   size_local;
 } benchmark_params;
 
 typedef struct measurement_t {
   std::string testcase;
+  int         threads;
+  long        local_elems;
   double      time_total_s;
 } measurement;
 
@@ -39,7 +47,9 @@ enum experiment_t{
   DARTSTRUCT,
   DARTDOUBLE,
   DARTLAMBDA,
-  MPIDOUBLE
+  MPIDOUBLE,
+  GLOBALSEQ,
+  GLOBALPAR
 };
 
 #ifdef HAVE_ASSERT
@@ -54,13 +64,15 @@ enum experiment_t{
 } while (0)
 #endif
 
-std::array<const char*, 6> testcase_str {{
+std::array<const char*, 8> testcase_str {{
                           "reduce.arraystruct",
                           "reduce.arraydouble",
                           "reduce.dartstruct",
                           "reduce.dartdouble",
                           "reduce.dartlambda",
-                          "reduce.mpidouble"
+                          "reduce.mpidouble",
+                          "reduce.global.seq",
+                          "reduce.global.par"
                           }};
 
 
@@ -68,7 +80,8 @@ void print_measurement_header();
 void print_measurement_record(
   const bench_cfg_params & cfg_params,
   measurement              measurement,
-  const benchmark_params & params);
+  const benchmark_params & params,
+  long                     num_nodes);
 
 benchmark_params parse_args(int argc, char * argv[]);
 
@@ -80,6 +93,7 @@ void print_params(
 measurement evaluate(
               int reps,
               experiment_t     testcase,
+              int              threads,
               benchmark_params params);
 
 template<typename ValueType, typename BinaryOperation>
@@ -180,28 +194,49 @@ int main(int argc, char** argv)
 
   int          round = 0;
 #ifdef MPI_IMPL_ID
-  std::array<experiment_t, 6> testcases{{
+  std::array<experiment_t, 8> testcases{{
     ARRAYSTRUCT,
     ARRAYDOUBLE,
     DARTSTRUCT,
     DARTDOUBLE,
     DARTLAMBDA,
-    MPIDOUBLE
+    MPIDOUBLE,
+    GLOBALSEQ,
+    GLOBALPAR
   }};
 #else
-  std::array<experiment_t, 5> testcases{{
+  std::array<experiment_t, 7> testcases{{
     ARRAYSTRUCT,
     ARRAYDOUBLE,
     DARTSTRUCT,
     DARTDOUBLE,
-    DARTLAMBDA
+    DARTLAMBDA,
+    GLOBALSEQ,
+    GLOBALPAR
   }};
 #endif
 
+  long num_nodes   = dash::util::Locality::NumNodes();
+  // Thread counts for reductions using dash::execution::par, powers of
+  // two up to the thread capacity of the units' locality domains:
+  int  max_threads = dash::execution::par.num_threads();
+  std::vector<int> par_threads;
+  for (int t = 1; t < max_threads; t *= 2) {
+    par_threads.push_back(t);
+  }
+  par_threads.push_back(max_threads);
+
   while(round < params.rounds) {
     for(auto testcase : testcases){
-      res = evaluate(params.reps, testcase, params);
-      print_measurement_record(bench_cfg, res, params);
+      if (testcase != GLOBALPAR) {
+        res = evaluate(params.reps, testcase, 1, params);
+        print_measurement_record(bench_cfg, res, params, num_nodes);
+        continue;
+      }
+      for (auto threads : par_threads) {
+        res = evaluate(params.reps, testcase, threads, params);
+        print_measurement_record(bench_cfg, res, params, num_nodes);
+      }
     }
     round++;
   }
@@ -214,12 +249,20 @@ int main(int argc, char** argv)
   return 0;
 }
 
-measurement evaluate(int reps, experiment_t testcase, benchmark_params params)
+measurement evaluate(
+  int reps, experiment_t testcase, int threads, benchmark_params params)
 {
   measurement mes;
+  mes.local_elems = 1;
 
   auto r = dash::myid();
 
+  dash::Array<double> array;
+  if (testcase == GLOBALSEQ || testcase == GLOBALPAR) {
+    array.allocate(params.size_local * dash::size(), dash::BLOCKED);
+    dash::fill(array.begin(), array.end(), 1.0);
+    mes.local_elems = array.lsize();
+  }
 
   float lmin = r;
   float lmax = 1000 - r;
@@ -270,10 +313,20 @@ measurement evaluate(int reps, experiment_t testcase, benchmark_params params)
       ASSERT_EQ((int)out, (dash::size()-1)*(dash::size())/2 + dash::size()*1000 - ((dash::size()-1)*(dash::size()))/2);
     }
 #endif
+    else if (testcase == GLOBALSEQ) {
+      double out = dash::reduce(dash::execution::seq,
+                                array.begin(), array.end(), 0.0);
+      ASSERT_EQ((long)out, (long)array.size());
+    } else if (testcase == GLOBALPAR) {
+      double out = dash::reduce(dash::execution::par(threads),
+                                array.begin(), array.end(), 0.0);
+      ASSERT_EQ((long)out, (long)array.size());
+    }
   }
 
   mes.time_total_s   = Timer::ElapsedSince(ts_tot_start) / (double)reps / 1E6;
   mes.testcase       = testcase_str[testcase];
+  mes.threads        = threads;
   return mes;
 }
 
@@ -284,6 +337,8 @@ void print_measurement_header()
          << std::setw( 5) << "units"      << ","
          << std::setw( 9) << "mpi.impl"   << ","
          << std::setw(30) << "impl"       << ","
+         << std::setw( 7) << "threads"    << ","
+         << std::setw(13) << "n.elems/s"  << ","
          << std::setw( 8) << "total.s"
          << endl;
   }
@@ -292,15 +347,23 @@ void print_measurement_header()
 void print_measurement_record(
   const bench_cfg_params & cfg_params,
   measurement              measurement,
-  const benchmark_params & params)
+  const benchmark_params & params,
+  long                     num_nodes)
 {
   if (dash::myid() == 0) {
     std::string mpi_impl = dash__toxstr(MPI_IMPL_ID);
     auto mes = measurement;
+    // Elements reduced per node and second, assuming units are
+    // distributed evenly to nodes:
+    double units_per_node = static_cast<double>(dash::size()) / num_nodes;
+    double node_elems_s   = mes.local_elems * units_per_node
+                            / mes.time_total_s;
         cout << std::right
          << std::setw(5) << dash::size() << ","
          << std::setw(9) << mpi_impl     << ","
          << std::fixed << setprecision(2) << setw(30) << mes.testcase       << ","
+         << std::setw(7) << mes.threads << ","
+         << std::fixed << setprecision(2) << setw(12) << (node_elems_s / 1000) << "k,"
          << std::fixed << setprecision(8) << setw(12) << mes.time_total_s
          << endl;
   }
@@ -311,6 +374,7 @@ benchmark_params parse_args(int argc, char * argv[])
   benchmark_params params;
   params.reps           = 100;
   params.rounds         = 10;
+  params.size_local     = 1 << 20;
 
   for (auto i = 1; i < argc; i += 2) {
     std::string flag = argv[i];
@@ -320,6 +384,9 @@ benchmark_params parse_args(int argc, char * argv[])
     if (flag == "-n") {
       params.rounds = atoi(argv[i+1]);
     }
+    if (flag == "-s") {
+      params.size_local = atol(argv[i+1]);
+    }
   }
   return params;
 }
@@ -335,5 +402,6 @@ void print_params(
   bench_cfg.print_section_start("Runtime arguments");
   bench_cfg.print_param("-r",    "repetitions per round", params.reps);
   bench_cfg.print_param("-n",    "rounds", params.rounds);
+  bench_cfg.print_param("-s",    "elements per unit", params.size_local);
   bench_cfg.print_section_end();
 }
@@ -0,0 +1,248 @@
+/**
+ * Measures the per-call overhead of fine-grained blocking reads of a
+ * single 8 byte element from the calling unit's and from a shared memory
+ * peer's global memory.
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <array>
+#include <iomanip>
+#include <string>
+#include <cstring>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef typename dash::util::BenchmarkParams::config_params_type
+  bench_cfg_params;
+
+typedef struct benchmark_params_t {
+  int    reps;
+  int    rounds;
+} benchmark_params;
+
+typedef struct measurement_t {
+  std::string testcase;
+  int         target;
+  double      time_per_call_ns;
+} measurement;
+
+void print_measurement_header();
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  measurement              measurement,
+  const benchmark_params & params);
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+dash::team_unit_t shared_mem_peer();
+
+measurement evaluate(
+              int                   reps,
+              std::string           testcase,
+              dash::team_unit_t     target,
+              dart_gptr_t           gptr,
+              dash::Array<int64_t>& array);
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  measurement res;
+
+  dash::util::BenchmarkParams bench_params("bench.16.get-latency");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+  auto bench_cfg = bench_params.config();
+
+  print_params(bench_params, params);
+
+  auto myid = dash::Team::All().myid();
+  auto peer = shared_mem_peer();
+  if (dash::myid() == 0 && peer == myid) {
+    cout << "No shared memory peer found, measuring local access only"
+         << endl;
+  }
+
+  dart_gptr_t gptr;
+  DASH_ASSERT_RETURNS(
+    dart_team_memalloc_aligned(
+      DART_TEAM_ALL, 1, DART_TYPE_LONGLONG, &gptr),
+    DART_OK);
+  dash::Array<int64_t> array(dash::size());
+  array.local[0] = dash::myid();
+  array.barrier();
+
+  print_measurement_header();
+
+  std::array<std::string, 2> testcases {{
+                            "dart_get_blocking",
+                            "dash::GlobRef"
+                            }};
+
+  for (int round = 0; round < params.rounds; ++round) {
+    for (auto testcase : testcases) {
+      res = evaluate(params.reps, testcase, myid, gptr, array);
+      print_measurement_record(bench_cfg, res, params);
+      if (peer != myid) {
+        res = evaluate(params.reps, testcase, peer, gptr, array);
+        print_measurement_record(bench_cfg, res, params);
+      }
+    }
+  }
+
+  array.barrier();
+  gptr.unitid = 0;
+  DASH_ASSERT_RETURNS(dart_team_memfree(gptr), DART_OK);
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+/**
+ * Returns the next unit located at the calling unit's host or the calling
+ * unit itself if no other unit shares its host.
+ */
+dash::team_unit_t shared_mem_peer()
+{
+  auto myid   = dash::Team::All().myid();
+  auto nunits = dash::size();
+  dart_unit_locality_t * my_loc;
+  DASH_ASSERT_RETURNS(
+    dart_unit_locality(DART_TEAM_ALL, myid, &my_loc),
+    DART_OK);
+  for (size_t u = 1; u < nunits; ++u) {
+    dash::team_unit_t unit((myid + u) % nunits);
+    dart_unit_locality_t * unit_loc;
+    DASH_ASSERT_RETURNS(
+      dart_unit_locality(DART_TEAM_ALL, unit, &unit_loc),
+      DART_OK);
+    if (strcmp(my_loc->hwinfo.host, unit_loc->hwinfo.host) == 0) {
+      return unit;
+    }
+  }
+  return myid;
+}
+
+measurement evaluate(
+  int                    reps,
+  std::string            testcase,
+  dash::team_unit_t      target,
+  dart_gptr_t            gptr,
+  dash::Array<int64_t> & array)
+{
+  measurement mes;
+  int64_t     value = 0;
+  int64_t     sum   = 0;
+
+  gptr.unitid = target;
+
+  dash::barrier();
+
+  auto ts_tot_start = Timer::Now();
+
+  if (testcase == "dart_get_blocking") {
+    for (int i = 0; i < reps; i++) {
+      dart_get_blocking(&value, gptr, 1, DART_TYPE_LONGLONG, DART_TYPE_LONGLONG);
+      sum += value;
+    }
+  } else if (testcase == "dash::GlobRef") {
+    auto gref = array[target];
+    for (int i = 0; i < reps; i++) {
+      value = gref;
+      sum  += value;
+    }
+  }
+
+  mes.time_per_call_ns = Timer::ElapsedSince(ts_tot_start) * 1E3 / reps;
+  mes.testcase         = testcase;
+  mes.target           = (target == dash::Team::All().myid())
+                         ? 0 : 1;
+  // prevent the reads from being optimized out
+  if (sum < 0) {
+    cout << sum << endl;
+  }
+  return mes;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw(20) << "impl"       << ","
+         << std::setw( 8) << "target"     << ","
+         << std::setw(12) << "call.ns"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  measurement              measurement,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(DASH_MPI_IMPL_ID);
+    auto mes = measurement;
+    cout << std::right
+         << std::setw(5) << dash::size() << ","
+         << std::setw(9) << mpi_impl     << ","
+         << setw(20) << mes.testcase     << ","
+         << setw(8)  << (mes.target == 0 ? "local" : "shmem") << ","
+         << std::fixed << setprecision(2) << setw(12) << mes.time_per_call_ns
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.reps           = 100000;
+  params.rounds         = 5;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-r") {
+      params.reps = atoi(argv[i+1]);
+    }
+    if (flag == "-n") {
+      params.rounds = atoi(argv[i+1]);
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-r",    "reads per round", params.reps);
+  bench_cfg.print_param("-n",    "rounds", params.rounds);
+  bench_cfg.print_section_end();
+}
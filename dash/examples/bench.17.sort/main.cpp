@@ -0,0 +1,212 @@
+/**
+ * Measures the throughput of dash::sort in sorted keys per second and node
+ * with single-threaded local sorting and merging and with the thread
+ * capacity of every unit's locality domain.
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <string>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef struct benchmark_params_t {
+  size_t size_per_unit;
+  int    rounds;
+  int    max_threads;
+} benchmark_params;
+
+typedef struct measurement_t {
+  std::string testcase;
+  std::string key_type;
+  int         threads;
+  double      time_s;
+  double      mkeys_per_node_s;
+} measurement;
+
+void print_measurement_header();
+void print_measurement_record(
+  measurement              measurement,
+  const benchmark_params & params);
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+template <typename KeyT>
+measurement evaluate(
+  const std::string      & testcase,
+  const std::string      & key_type,
+  int                      threads,
+  const benchmark_params & params);
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.17.sort");
+  bench_params.print_header();
+  bench_params.print_pinning();
+  bench_params.print_locality_init();
+
+  benchmark_params params = parse_args(argc, argv);
+
+  print_params(bench_params, params);
+
+  // Number of threads used by dash::sort is bounded by the thread capacity
+  // of the unit's locality domain:
+  int domain_threads = dash::util::UnitLocality().num_domain_threads();
+  if (params.max_threads > 0) {
+    domain_threads = std::min(domain_threads, params.max_threads);
+  }
+
+  print_measurement_header();
+
+  for (int round = 0; round < params.rounds; ++round) {
+    for (auto threads : { 1, domain_threads }) {
+      std::string testcase = (threads == 1) ? "sequential" : "parallel";
+      dash::util::Config::set("DASH_MAX_UNIT_THREADS", threads);
+      print_measurement_record(
+        evaluate<int64_t>(testcase, "int64", threads, params), params);
+      print_measurement_record(
+        evaluate<double>(testcase, "double", threads, params), params);
+      if (domain_threads == 1) {
+        break;
+      }
+    }
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+template <typename KeyT>
+measurement evaluate(
+  const std::string      & testcase,
+  const std::string      & key_type,
+  int                      threads,
+  const benchmark_params & params)
+{
+  measurement mes;
+
+  dash::Array<KeyT> array(params.size_per_unit * dash::size());
+
+  std::mt19937 generator(dash::myid() + 1);
+  std::uniform_real_distribution<double> distribution(
+    -1.0e9, 1.0e9);
+  for (auto it = array.lbegin(); it != array.lend(); ++it) {
+    *it = static_cast<KeyT>(distribution(generator));
+  }
+  array.barrier();
+
+  auto ts_start = Timer::Now();
+  dash::sort(array.begin(), array.end());
+  double time_us = Timer::ElapsedSince(ts_start);
+
+  // Slowest unit determines the throughput:
+  double time_us_max = 0;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &time_us, &time_us_max, 1, DART_TYPE_DOUBLE, DART_OP_MAX,
+      DART_TEAM_ALL),
+    DART_OK);
+
+  auto num_nodes = std::max(dash::util::Locality::NumNodes(), 1);
+
+  mes.testcase         = testcase;
+  mes.key_type         = key_type;
+  mes.threads          = threads;
+  mes.time_s           = time_us_max * 1.0e-6;
+  mes.mkeys_per_node_s = static_cast<double>(array.size()) /
+                         num_nodes / time_us_max;
+  return mes;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"      << ","
+         << std::setw(12) << "impl"       << ","
+         << std::setw( 8) << "keys"       << ","
+         << std::setw( 8) << "threads"    << ","
+         << std::setw(12) << "size.unit"  << ","
+         << std::setw(10) << "time.s"     << ","
+         << std::setw(14) << "mkeys/node.s"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  measurement              measurement,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    auto mes = measurement;
+    cout << std::right
+         << std::setw(5) << dash::size()       << ","
+         << setw(12)     << mes.testcase       << ","
+         << setw(8)      << mes.key_type       << ","
+         << setw(8)      << mes.threads        << ","
+         << setw(12)     << params.size_per_unit << ","
+         << std::fixed << setprecision(4) << setw(10) << mes.time_s << ","
+         << std::fixed << setprecision(2) << setw(14)
+         << mes.mkeys_per_node_s
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.size_per_unit  = 10000000;
+  params.rounds         = 3;
+  params.max_threads    = 0;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-s") {
+      params.size_per_unit = atol(argv[i+1]);
+    }
+    if (flag == "-n") {
+      params.rounds = atoi(argv[i+1]);
+    }
+    if (flag == "-t") {
+      params.max_threads = atoi(argv[i+1]);
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-s", "elements per unit", params.size_per_unit);
+  bench_cfg.print_param("-n", "rounds", params.rounds);
+  bench_cfg.print_param("-t", "max. threads per unit", params.max_threads);
+  bench_cfg.print_section_end();
+}
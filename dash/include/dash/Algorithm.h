@@ -11,8 +11,11 @@
  *
  */
 
+#include <dash/ExecutionPolicy.h>
+
 #include <dash/algorithm/Operation.h>
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Segments.h>
 #include <dash/algorithm/ForEach.h>
 #include <dash/algorithm/MinMax.h>
 #include <dash/algorithm/Transform.h>
@@ -0,0 +1,173 @@
+#ifndef DASH__EXECUTION_POLICY_H__INCLUDED
+#define DASH__EXECUTION_POLICY_H__INCLUDED
+
+#include <dash/util/UnitLocality.h>
+
+#include <algorithm>
+#include <type_traits>
+
+/**
+ * \defgroup  DashExecutionPolicies  Execution Policies
+ *
+ * Execution policies specify how the local phase of an algorithm, i.e.
+ * the part operating on the calling unit's elements, is executed within
+ * the unit.
+ *
+ * \code
+ *   // Use all threads available to the unit's locality domain:
+ *   dash::for_each(dash::execution::par, array.begin(), array.end(), f);
+ *   // Use 4 threads:
+ *   dash::for_each(dash::execution::par(4), array.begin(), array.end(), f);
+ * \endcode
+ *
+ * Multi-threaded execution requires builds with \c DASH_ENABLE_OPENMP,
+ * otherwise parallel policies fall back to sequential execution.
+ */
+
+namespace dash {
+namespace execution {
+
+/**
+ * Execution policy for sequential execution of local algorithm phases in
+ * the calling thread.
+ *
+ * \ingroup  DashExecutionPolicies
+ */
+class sequenced_policy {
+public:
+  constexpr sequenced_policy() = default;
+
+  /**
+   * Number of threads executing the local phase.
+   */
+  constexpr int num_threads() const noexcept {
+    return 1;
+  }
+};
+
+/**
+ * Execution policy for multi-threaded execution of local algorithm
+ * phases.
+ * Function objects passed to the algorithm may be invoked concurrently
+ * and must not introduce data races.
+ *
+ * Unless specified, the number of threads is the thread capacity of the
+ * unit's locality domain as reported by
+ * \c dash::util::UnitLocality::num_domain_threads, which respects the
+ * configuration keys \c DASH_DISABLE_THREADS, \c DASH_MAX_SMT and
+ * \c DASH_MAX_UNIT_THREADS.
+ *
+ * \ingroup  DashExecutionPolicies
+ */
+class parallel_policy {
+public:
+  constexpr parallel_policy() = default;
+
+  constexpr explicit parallel_policy(int nthreads)
+  : _num_threads(nthreads)
+  { }
+
+  /**
+   * Policy using the given number of threads.
+   */
+  constexpr parallel_policy operator()(int nthreads) const noexcept {
+    return parallel_policy(nthreads);
+  }
+
+  /**
+   * Number of threads executing the local phase.
+   */
+  int num_threads() const {
+#ifdef DASH_ENABLE_OPENMP
+    if (_num_threads > 0) {
+      return _num_threads;
+    }
+    dash::util::UnitLocality uloc;
+    return std::max(uloc.num_domain_threads(), 1);
+#else
+    return 1;
+#endif
+  }
+
+private:
+  int _num_threads = 0;
+};
+
+/**
+ * Execution policy for multi-threaded execution of local algorithm
+ * phases where invocations of function objects may additionally be
+ * interleaved within a thread, e.g. by vectorization.
+ *
+ * \see  parallel_policy
+ *
+ * \ingroup  DashExecutionPolicies
+ */
+class parallel_unsequenced_policy {
+public:
+  constexpr parallel_unsequenced_policy() = default;
+
+  constexpr explicit parallel_unsequenced_policy(int nthreads)
+  : _par(nthreads)
+  { }
+
+  /**
+   * Policy using the given number of threads.
+   */
+  constexpr parallel_unsequenced_policy operator()(int nthreads)
+    const noexcept {
+    return parallel_unsequenced_policy(nthreads);
+  }
+
+  /**
+   * Number of threads executing the local phase.
+   */
+  int num_threads() const {
+    return _par.num_threads();
+  }
+
+private:
+  parallel_policy _par;
+};
+
+/// Sequential execution of local algorithm phases.
+constexpr sequenced_policy            seq{};
+/// Multi-threaded execution of local algorithm phases.
+constexpr parallel_policy             par{};
+/// Multi-threaded and vectorized execution of local algorithm phases.
+constexpr parallel_unsequenced_policy par_unseq{};
+
+/**
+ * Type trait to test whether a type is an execution policy.
+ *
+ * \ingroup  DashExecutionPolicies
+ */
+template <class T>
+struct is_execution_policy : std::false_type { };
+
+template <>
+struct is_execution_policy<sequenced_policy> : std::true_type { };
+
+template <>
+struct is_execution_policy<parallel_policy> : std::true_type { };
+
+template <>
+struct is_execution_policy<parallel_unsequenced_policy> : std::true_type { };
+
+} // namespace execution
+
+namespace internal {
+
+/**
+ * Enables overloads of algorithms for execution policy arguments.
+ */
+template <class ExecutionPolicy, class T = void>
+using enable_if_execution_policy_t = typename std::enable_if<
+  dash::execution::is_execution_policy<
+    typename std::decay<ExecutionPolicy>::type>::value,
+  T>::type;
+
+} // namespace internal
+
+} // namespace dash
+
+#endif // DASH__EXECUTION_POLICY_H__INCLUDED
@@ -51,16 +51,6 @@ class GlobAsyncRef
     typename ElementT >
   friend class GlobAsyncRef;
 
-  struct ReleaseHandle {
-    void operator()(dart_handle_t handle)
-    {
-      DASH_ASSERT_RETURNS(
-        dart_wait_local(&handle),
-        DART_OK
-      );
-    }
-  };
-
 public:
   using value_type          = T;
   using const_value_type    = typename std::add_const<T>::type;
@@ -72,12 +62,6 @@ public:
 private:
   /// Pointer to referenced element in global memory
   dart_gptr_t  _gptr{};
-  /// Temporary value required for non-blocking put
-  mutable nonconst_value_type _value;
-  /// DART handle for asynchronous transfers
-  mutable std::
-      unique_ptr<std::remove_pointer<dart_handle_t>::type, ReleaseHandle>
-          _handle{DART_HANDLE_NULL};
 
 private:
 
@@ -269,19 +253,16 @@ public:
    * to the value pointed to by \c new_value.
    * This operation is guaranteed to be complete after a call to \ref flush,
    * but the value referenced by \c new_value can be re-used immediately.
+   *
+   * Values written to a remote unit are collected in a write-combining
+   * buffer and transferred in bulk, see \c dart_put_combining.
    */
   void set(const_value_type& new_value) const {
     static_assert(std::is_same<value_type, nonconst_value_type>::value,
                   "Cannot modify value through GlobAsyncRef<const T>!");
     DASH_LOG_TRACE_VAR("GlobAsyncRef.set()", new_value);
     DASH_LOG_TRACE_VAR("GlobAsyncRef.set()", _gptr);
-
-    _value = new_value;
-
-    dart_handle_t new_handle;
-    dash::internal::put_handle(_gptr, &_value, 1, &new_handle);
-
-    _handle.reset(new_handle);
+    dash::internal::put_combining(_gptr, &new_value, 1);
   }
 
   /**
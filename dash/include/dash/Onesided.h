@@ -30,6 +30,27 @@ namespace internal {
       DART_OK);
   }
 
+  /**
+   * Non-blocking write of \c nelem values from \c src to the global memory
+   * location referenced by \c gptr, collected in the write-combining
+   * buffer of the target unit. The values in \c src can be reused
+   * immediately.
+   *
+   * \sa dart_put_combining
+   */
+  template<typename T>
+  inline
+  void
+  put_combining(const dart_gptr_t& gptr, const T *src, size_t nelem) {
+    dash::dart_storage<T> ds(nelem);
+    DASH_ASSERT_RETURNS(
+      dart_put_combining(gptr,
+                         src,
+                         ds.nelem,
+                         ds.dtype),
+      DART_OK);
+  }
+
   /**
    * Non-blocking read of \c nelem values the global memory
    * location referenced by \c gptr into memory referenced by \c src.
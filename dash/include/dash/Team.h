@@ -6,6 +6,7 @@
 #include <dash/Init.h>
 #include <dash/Types.h>
 #include <dash/Exception.h>
+#include <dash/Future.h>
 
 #include <dash/util/Locality.h>
 
@@ -485,6 +486,46 @@ public:
     }
   }
 
+  /**
+   * Non-blocking variant of \c barrier.
+   * The barrier is complete once the returned future is ready.
+   *
+   * Collective operation.
+   */
+  dash::Future<void> barrier_async() const
+  {
+    if (is_null()) {
+      return dash::Future<void>([]() { });
+    }
+    auto handle = std::make_shared<dart_handle_t>(DART_HANDLE_NULL);
+    DASH_ASSERT_RETURNS(
+      dart_ibarrier(_dartid, handle.get()),
+      DART_OK);
+    return dash::Future<void>(
+      // wait
+      [handle]() {
+        DASH_ASSERT_RETURNS(
+          dart_wait_local(handle.get()),
+          DART_OK);
+      },
+      // test
+      [handle]() {
+        int32_t flag;
+        DASH_ASSERT_RETURNS(
+          dart_test_local(handle.get(), &flag),
+          DART_OK);
+        return (flag != 0);
+      },
+      // destroy
+      [handle]() {
+        // the barrier cannot be cancelled, complete it before releasing
+        // the handle
+        DASH_ASSERT_RETURNS(
+          dart_wait_local(handle.get()),
+          DART_OK);
+      });
+  }
+
   inline team_unit_t myid() const
   {
     return _myid;
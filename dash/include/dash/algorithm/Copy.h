@@ -5,6 +5,7 @@
 #include <dash/Iterator.h>
 #include <dash/internal/Config.h>
 #include <dash/iterator/internal/ContiguousRange.h>
+#include <dash/algorithm/Segments.h>
 
 #include <dash/dart/if/dart_communication.h>
 
@@ -321,6 +322,82 @@ GlobOutputIt copy_impl(
   return out_last;
 }
 
+// =========================================================================
+// Global to Global
+// =========================================================================
+
+/**
+ * Blocking implementation of \c dash::copy (global to global).
+ *
+ * The input range is split into segments and every unit only transfers
+ * the segments of the input range that are local to it.
+ * Every local input segment is matched with the contiguous chunks of the
+ * corresponding output range by the local-to-global \c copy_impl, which
+ * copies chunks with local destination directly and issues a put for every
+ * remote destination chunk.
+ */
+template <
+  typename GlobInputIt,
+  typename GlobOutputIt,
+  typename = typename std::enable_if<
+               dash::detail::is_global_iterator<GlobInputIt>::value
+             >::type >
+GlobOutputIt copy_impl(
+  GlobInputIt                  begin,
+  GlobInputIt                  end,
+  GlobOutputIt                 out_first,
+  std::vector<dart_handle_t> * handles)
+{
+  DASH_LOG_TRACE("dash::copy_impl() global -> global",
+                 "in_first:",  begin.pos(),
+                 "in_last:",   end.pos(),
+                 "out_first:", out_first.pos());
+  typedef typename GlobInputIt::size_type   size_type;
+  typedef typename GlobInputIt::value_type  input_value_type;
+  typedef typename GlobOutputIt::value_type output_value_type;
+
+  static_assert(is_dash_copyable<input_value_type, output_value_type>::value,
+                "dash::copy can only be used on same-size arithmetic types or "
+                "same non-arithmetic types");
+
+  const size_type num_elem_total = dash::distance(begin, end);
+  if (num_elem_total <= 0) {
+    DASH_LOG_TRACE("dash::internal::copy_impl", "input range empty");
+    return out_first;
+  }
+
+  auto out_last = out_first + num_elem_total;
+
+  DASH_LOG_TRACE("dash::copy_impl",
+                 "total elements:",    num_elem_total,
+                 "expected out_last:", out_last.pos());
+
+  size_type num_elem_copied = 0;
+
+  //
+  // Copy local input segments to their destination:
+  //
+
+  for (const auto & seg : dash::local_segments(begin, end)) {
+
+    auto num_copy_elem = seg.size;
+
+    DASH_ASSERT_GT(num_copy_elem, 0, "Number of elements to copy is 0");
+
+    DASH_LOG_TRACE("dash::copy_impl", "src_ptr", seg.lbegin,
+                   "out_offset", seg.pos,
+                   "num_copy_elem", num_copy_elem);
+    copy_impl(seg.lbegin, seg.lbegin + num_copy_elem,
+              out_first + seg.pos,
+              handles);
+    num_elem_copied += num_copy_elem;
+  }
+
+  DASH_LOG_TRACE("dash::copy_impl >",
+                 "local elements copied:", num_elem_copied);
+  return out_last;
+}
+
 } // namespace internal
 
 
@@ -629,25 +706,170 @@ copy_async(
 }
 #endif
 
+// =========================================================================
+// Global to Global, Distributed Range
+// =========================================================================
+
+/**
+ * Variant of \c dash::copy as asynchronous global-to-global copy operation.
+ *
+ * Collective operation on the units owning elements of the input range,
+ * every unit transfers the elements of the input range that are local to
+ * it.
+ * Completion of the returned future only implies completion of the
+ * transfers started by the calling unit, units must synchronize before
+ * reading copied elements from remote units.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  typename = typename std::enable_if<
+               dash::detail::is_global_iterator<GlobInputIt>::value
+             >::type >
+dash::Future<GlobOutputIt> copy_async(
+  GlobInputIt    in_first,
+  GlobInputIt    in_last,
+  GlobOutputIt   out_first)
+{
+  DASH_LOG_TRACE("dash::copy_async()", "async, global to global");
+  if (in_first == in_last) {
+    DASH_LOG_TRACE("dash::copy_async", "input range empty");
+    return dash::Future<GlobOutputIt>(out_first);
+  }
+
+  auto handles  = std::make_shared<std::vector<dart_handle_t>>();
+  auto out_last = dash::internal::copy_impl(in_first,
+                                            in_last,
+                                            out_first,
+                                            handles.get());
+
+  if (handles->empty()) {
+    DASH_LOG_TRACE("dash::copy_async", "all transfers completed");
+    return dash::Future<GlobOutputIt>(out_last);
+  }
+  dash::Future<GlobOutputIt> fut_result(
+    // get
+    [=]() mutable {
+      // Wait for all put requests to complete:
+      GlobOutputIt _out = out_last;
+      DASH_LOG_TRACE("dash::copy_async [Future]()",
+                    "  wait for", handles->size(), "async put request");
+      if (!handles->empty()) {
+        if (dart_waitall(handles->data(), handles->size())
+            != DART_OK) {
+          DASH_LOG_ERROR("dash::copy_async [Future]",
+                        "  dart_waitall failed");
+          DASH_THROW(
+            dash::exception::RuntimeError,
+            "dash::copy_async [Future]: dart_waitall failed");
+        }
+      } else {
+        DASH_LOG_TRACE("dash::copy_async [Future]", "  No pending handles");
+      }
+      handles->clear();
+      DASH_LOG_TRACE("dash::copy_async [Future] >",
+                    "  async requests completed");
+      return _out;
+    },
+    // test
+    [=](GlobOutputIt *out) mutable {
+      int32_t flag;
+      DASH_ASSERT_RETURNS(
+        dart_testall(handles->data(), handles->size(), &flag), DART_OK);
+      if (flag) {
+        handles->clear();
+        *out = out_last;
+      }
+      return (flag != 0);
+    },
+    // destroy
+    [=]() mutable {
+      for (auto& handle : *handles) {
+        DASH_ASSERT_RETURNS(
+          dart_handle_free(&handle), DART_OK);
+      }
+    }
+  );
+  return fut_result;
+}
+
 /**
  * Specialization of \c dash::copy as global-to-global blocking copy
  * operation.
  *
+ * Collective operation on the units owning elements of the input range,
+ * every unit transfers the elements of the input range that are local to
+ * it.
+ * Returns when the transfers started by the calling unit are completed,
+ * units must synchronize before reading copied elements from remote units.
+ *
  * \ingroup  DashAlgorithms
  */
-template <typename ValueType, class GlobInputIt, class GlobOutputIt>
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  bool  UseHandles = false,
+  typename = typename std::enable_if<
+               dash::detail::is_global_iterator<GlobInputIt>::value
+             >::type >
 GlobOutputIt copy(
-    GlobInputIt /*in_first*/,
-    GlobInputIt /*in_last*/,
-    GlobOutputIt /*out_first*/)
+  GlobInputIt    in_first,
+  GlobInputIt    in_last,
+  GlobOutputIt   out_first)
 {
   DASH_LOG_TRACE("dash::copy()", "blocking, global to global");
+  if (in_first == in_last) {
+    DASH_LOG_TRACE("dash::copy", "input range empty");
+    return out_first;
+  }
+  GlobOutputIt out_last;
+  if (UseHandles) {
+    std::vector<dart_handle_t> handles;
+    out_last = dash::internal::copy_impl(in_first,
+                                         in_last,
+                                         out_first,
+                                         &handles);
+    if (!handles.empty()) {
+      DASH_LOG_TRACE("dash::copy", "Waiting for remote transfers to complete,",
+                    "num_handles: ", handles.size());
+      dart_waitall(handles.data(), handles.size());
+    }
+  } else {
+    out_last = dash::internal::copy_impl(in_first,
+                                         in_last,
+                                         out_first,
+                                         nullptr);
+    DASH_LOG_TRACE("dash::copy", "Waiting for remote transfers to complete");
+    dart_flush_all(out_first.dart_gptr());
+  }
+  DASH_LOG_TRACE("dash::copy >", "finished");
+  return out_last;
+}
 
-  // TODO:
-  // - Implement adapter for local-to-global dash::copy here
-  // - Return if global input range has no local sub-range
-
-  return GlobOutputIt();
+/**
+ * Specialization of \c dash::copy as global-to-global blocking copy
+ * operation with explicit value type.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  typename ValueType,
+  class    GlobInputIt,
+  class    GlobOutputIt,
+  bool     UseHandles = false,
+  typename = typename std::enable_if<
+               dash::detail::is_global_iterator<GlobInputIt>::value &&
+               dash::detail::is_global_iterator<GlobOutputIt>::value
+             >::type >
+GlobOutputIt copy(
+  GlobInputIt    in_first,
+  GlobInputIt    in_last,
+  GlobOutputIt   out_first)
+{
+  return dash::copy<GlobInputIt, GlobOutputIt, UseHandles>(
+           in_first, in_last, out_first);
 }
 
 #endif // DOXYGEN
@@ -3,27 +3,64 @@
 
 #include <dash/internal/Config.h>
 
+#include <dash/ExecutionPolicy.h>
+
 #include <dash/iterator/GlobIter.h>
 
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Segments.h>
 #include <dash/algorithm/Operation.h>
-
-#include <dash/util/UnitLocality.h>
+#include <dash/algorithm/internal/Parallel.h>
 
 #include <dash/dart/if/dart_communication.h>
 
-#ifdef DASH_ENABLE_OPENMP
-#include <omp.h>
-#endif
-
 
 namespace dash {
 
+/**
+ * Assigns the given value to the elements in the range [first, last),
+ * executing the local phase according to the given execution policy.
+ *
+ * The local segments of the range, e.g. the rows of a matrix view, are
+ * split into balanced parts that are processed in a single parallel
+ * region, see \c dash::internal::for_each_part.
+ *
+ * \see  dash::execution
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <class ExecutionPolicy, typename GlobIterType>
+dash::internal::enable_if_execution_policy_t<ExecutionPolicy>
+fill(
+  /// Execution policy of the local phase
+  ExecutionPolicy  && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIterType        first,
+  /// Iterator to the final position in the sequence
+  GlobIterType        last,
+  /// Value which will be assigned to the elements in range [first, last)
+  const typename GlobIterType::value_type & value)
+{
+  auto n_threads = policy.num_threads();
+  DASH_LOG_DEBUG("dash::fill", "threads:", n_threads);
+  // Assign value to native pointer ranges of local elements:
+  dash::internal::for_each_part(
+    n_threads,
+    dash::internal::local_chunks(first, last),
+    [&value](int, const typename dash::internal::local_chunk_type<
+                   GlobIterType>::type & chunk,
+             std::size_t from, std::size_t to) {
+      std::fill(chunk.begin + from, chunk.begin + to, value);
+    });
+}
+
 /**
  * Assigns the given value to the elements in the range [first, last)
  *
  * Being a collaborative operation, each unit will assign the value to
  * its local elements only.
+ * The local elements are assigned by all threads available to the unit,
+ * see \c dash::execution::par.
  *
  * \tparam      ElementType  Type of the elements in the sequence
  * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
@@ -40,27 +77,7 @@ void fill(
   /// Value which will be assigned to the elements in range [first, last)
   const typename GlobIterType::value_type & value)
 {
-  typedef typename GlobIterType::index_type index_t;
-  typedef typename GlobIterType::value_type value_t;
-
-  // Global iterators to local range:
-  auto      index_range = dash::local_range(first, last);
-  value_t * lfirst      = index_range.begin;
-  value_t * llast       = index_range.end;
-
-#ifdef DASH_ENABLE_OPENMP
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
-  auto nlocal    = llast - lfirst;
-  DASH_LOG_DEBUG("dash::fill", "thread capacity:",  n_threads);
-  #pragma omp parallel for num_threads(n_threads)
-  for (index_t lt = 0; lt < nlocal; ++lt) {
-    lfirst[lt] = value;
-  }
-
-#else
-  std::fill(lfirst, llast, value);
-#endif
+  dash::fill(dash::execution::par, first, last, value);
 }
 
 } // namespace dash
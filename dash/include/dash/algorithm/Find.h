@@ -2,13 +2,85 @@
 #define DASH__ALGORITHM__FIND_H__
 
 #include <dash/Array.h>
+#include <dash/ExecutionPolicy.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Segments.h>
+#include <dash/algorithm/internal/Parallel.h>
 #include <dash/dart/if/dart_communication.h>
 #include <dash/iterator/GlobIter.h>
 
 namespace dash {
 
+namespace internal {
+
+/**
+ * Position of the first element in the range \c [first,last) relative to
+ * \c first that satisfies the predicate, searching all units' local
+ * segments of the range in tight loops on native pointers by up to
+ * \c n_threads threads per unit.
+ * Collective operation, returns \c last if no element has been found.
+ */
+template <typename GlobIter, typename UnaryPredicate>
+GlobIter find_if_segments(
+    int            n_threads,
+    GlobIter       first,
+    GlobIter       last,
+    UnaryPredicate predicate)
+{
+  using iterator_traits = dash::iterator_traits<GlobIter>;
+  using p_index_t       = typename iterator_traits::index_type;
+
+  auto & team = first.pattern().team();
+
+  // Local segments are ordered by their position in the range and so are
+  // the parts they are split into. The first hit in a part is the part's
+  // result, the first part's result the local result:
+  static constexpr p_index_t no_hit = std::numeric_limits<p_index_t>::max();
+  std::vector<p_index_t> part_hit_pos(std::max(n_threads, 1), no_hit);
+  dash::internal::for_each_part(
+    n_threads,
+    dash::local_segments(first, last),
+    [&](int part, const typename dash::internal::segment_type<
+                    GlobIter>::type & seg,
+        std::size_t from, std::size_t to) {
+      if (part_hit_pos[part] != no_hit) {
+        return;
+      }
+      auto seg_end  = seg.lbegin + to;
+      auto l_result = std::find_if(seg.lbegin + from, seg_end, predicate);
+      if (l_result != seg_end) {
+        part_hit_pos[part] = seg.pos
+                             + static_cast<p_index_t>(l_result - seg.lbegin);
+      }
+    });
+  p_index_t l_hit_pos = *std::min_element(part_hit_pos.begin(),
+                                          part_hit_pos.end());
+  DASH_LOG_DEBUG("dash::find_if", "local hit position:", l_hit_pos);
+  team.barrier();
+
+  // receive buffer for global minimal position
+  p_index_t g_hit_pos;
+
+  DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        &l_hit_pos,
+        &g_hit_pos,
+        1,
+        dart_datatype<p_index_t>::value,
+        DART_OP_MIN,
+        team.dart_id()),
+      DART_OK);
+
+  if (g_hit_pos == std::numeric_limits<p_index_t>::max()) {
+    DASH_LOG_DEBUG("element not found");
+    return last;
+  }
+  return first + g_hit_pos;
+}
+
+} // namespace internal
+
 /**
  * Returns an iterator to the first element in the range \c [first,last) that
  * compares equal to \c val.
@@ -27,67 +99,51 @@ GlobIter find(
   /// Value which is searched for using operator==
   const ElementType & value)
 {
-
-  //use iterator traits
-  using iterator_traits = dash::iterator_traits<GlobIter>;
-
-  using p_index_t = typename iterator_traits::index_type;
+  using value_t = typename dash::iterator_traits<GlobIter>::value_type;
 
   if(first >= last) {
     return last;
   }
 
-  p_index_t g_index;
-  auto & pattern     = first.pattern();
-  auto & team        = pattern.team();
-  auto index_range   = dash::local_index_range(first, last);
-  auto l_begin_index = index_range.begin;
-  auto l_end_index   = index_range.end;
-  auto first_offset  = first.pos();
-  if(l_begin_index == l_end_index){
-    g_index = std::numeric_limits<p_index_t>::max();
-  } else {
-   auto g_begin_index = pattern.global(l_begin_index);
-
-    // Pointer to first element in local memory:
-   auto const* lbegin = dash::local_begin(
-       static_cast<typename GlobIter::pointer>(first), team.myid());
-   // Pointers to first / final element in local range:
-   const auto l_range_begin = lbegin + l_begin_index;
-   const auto l_range_end   = lbegin + l_end_index;
-
-   DASH_LOG_DEBUG("local index range", l_begin_index, l_end_index);
-
-   auto l_result = std::find(l_range_begin, l_range_end, value);
-   if (l_result == l_range_end) {
-     DASH_LOG_DEBUG("Not found in local range");
-     g_index = std::numeric_limits<p_index_t>::max();
-    } else {
-      auto l_hit_index = l_result - lbegin;
-      g_index = pattern.global(l_hit_index);
-    }
-  }
-  team.barrier();
-
-  // receive buffer for global maximal index
-  p_index_t g_hit_idx;
+  return dash::internal::find_if_segments(
+           1, first, last,
+           [&value](const value_t & v) { return v == value; });
+}
 
-  DASH_ASSERT_RETURNS(
-      dart_allreduce(
-        &g_index,
-        &g_hit_idx,
-        1,
-        dart_datatype<p_index_t>::value,
-        DART_OP_MIN,
-        team.dart_id()),
-      DART_OK);
+/**
+ * Returns an iterator to the first element in the range \c [first,last) that
+ * compares equal to \c val, executing the local phase according to the
+ * given execution policy.
+ * If no such element is found, the function returns \c last.
+ *
+ * \see  dash::execution
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename GlobIter,
+  typename ElementType>
+dash::internal::enable_if_execution_policy_t<ExecutionPolicy, GlobIter>
+find(
+  /// Execution policy of the local phase
+  ExecutionPolicy  && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter   first,
+  /// Iterator to the final position in the sequence
+  GlobIter   last,
+  /// Value which is searched for using operator==
+  const ElementType & value)
+{
+  using value_t = typename dash::iterator_traits<GlobIter>::value_type;
 
-  if (g_hit_idx == std::numeric_limits<p_index_t>::max()) {
-    DASH_LOG_DEBUG("element not found");
-  } else {
-    return first + g_hit_idx;
+  if(first >= last) {
+    return last;
   }
-  return last;
+
+  return dash::internal::find_if_segments(
+           policy.num_threads(), first, last,
+           [&value](const value_t & v) { return v == value; });
 }
 
 /**
@@ -109,39 +165,47 @@ GlobIter find_if(
     /// Predicate which will be applied to the elements in range [first, last)
     UnaryPredicate predicate)
 {
-  using iterator_traits = dash::iterator_traits<GlobIter>;
-
-  using index_t = typename iterator_traits::index_type;
-
-  auto& team = first.pattern().team();
-  auto  myid = team.myid();
-  /// Global iterators to local range:
-  auto index_range = dash::local_range(first, last);
-  auto l_first     = index_range.begin;
-  auto l_last      = index_range.end;
-
-  auto l_result = std::find_if(l_first, l_last, predicate);
-  auto l_offset = l_result == l_last ? -1 : std::distance(l_first, l_result);
-
-  dash::Array<index_t> l_results(team.size(), team);
-
-  l_results.local[0] = l_offset;
-
-  team.barrier();
+  if (first >= last) {
+    return last;
+  }
 
-  // All local offsets stored in l_results
-  auto result = last;
+  return dash::internal::find_if_segments(1, first, last, predicate);
+}
 
-  for (auto u = 0; u < team.size(); u++) {
-    if (l_results[u] >= 0) {
-      auto g_offset = first.pattern().global_index(u, {l_results[u]});
-      result        = first + g_offset - first.pos();
-      break;
-    }
+/**
+ * Returns an iterator to the first element in the range \c [first,last) that
+ * satisfies the predicate \c p, executing the local phase according to
+ * the given execution policy.
+ * If no such element is found, the function returns \c last.
+ *
+ * With a parallel policy, the predicate is invoked concurrently by
+ * multiple threads and must be safe to do so.
+ *
+ * \see  dash::execution
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+    class    ExecutionPolicy,
+    typename GlobIter,
+    typename UnaryPredicate>
+dash::internal::enable_if_execution_policy_t<ExecutionPolicy, GlobIter>
+find_if(
+    /// Execution policy of the local phase
+    ExecutionPolicy && policy,
+    /// Iterator to the initial position in the sequence
+    GlobIter first,
+    /// Iterator to the final position in the sequence
+    GlobIter last,
+    /// Predicate which will be applied to the elements in range [first, last)
+    UnaryPredicate predicate)
+{
+  if (first >= last) {
+    return last;
   }
 
-  team.barrier();
-  return result;
+  return dash::internal::find_if_segments(
+           policy.num_threads(), first, last, predicate);
 }
 
 /**
@@ -168,6 +232,35 @@ GlobIter find_if_not(
   return find_if(first, last, std::not1(predicate));
 }
 
+/**
+ * Returns an iterator to the first element in the range \c [first,last) that
+ * does not satisfy the predicate \c p, executing the local phase according
+ * to the given execution policy.
+ * If no such element is found, the function returns \c last.
+ *
+ * \see dash::find_if
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+    class    ExecutionPolicy,
+    typename GlobIter,
+    class    UnaryPredicate>
+dash::internal::enable_if_execution_policy_t<ExecutionPolicy, GlobIter>
+find_if_not(
+    /// Execution policy of the local phase
+    ExecutionPolicy && policy,
+    /// Iterator to the initial position in the sequence
+    GlobIter first,
+    /// Iterator to the final position in the sequence
+    GlobIter last,
+    /// Predicate which will be applied to the elements in range [first, last)
+    UnaryPredicate predicate)
+{
+  return find_if(std::forward<ExecutionPolicy>(policy),
+                 first, last, std::not1(predicate));
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__FIND_H__
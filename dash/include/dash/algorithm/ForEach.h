@@ -1,7 +1,11 @@
 #ifndef DASH__ALGORITHM__FOR_EACH_H__
 #define DASH__ALGORITHM__FOR_EACH_H__
 
+#include <dash/ExecutionPolicy.h>
+
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Segments.h>
+#include <dash/algorithm/internal/Parallel.h>
 #include <dash/iterator/GlobIter.h>
 
 #include <algorithm>
@@ -9,6 +13,50 @@
 
 namespace dash {
 
+/**
+ * Invoke a function on every element in a range distributed by a pattern,
+ * executing the local phase according to the given execution policy.
+ *
+ * With a parallel policy, the unit's local elements are split into parts
+ * of balanced size which are processed by concurrent threads, so \c func
+ * must be safe to invoke concurrently on distinct elements.
+ *
+ * \see  dash::execution
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  typename GlobInputIt,
+  class UnaryFunction>
+dash::internal::enable_if_execution_policy_t<ExecutionPolicy>
+for_each(
+    /// Execution policy of the local phase
+    ExecutionPolicy && policy,
+    /// Iterator to the initial position in the sequence
+    const GlobInputIt& first,
+    /// Iterator to the final position in the sequence
+    const GlobInputIt& last,
+    /// Function to invoke on every index in the range
+    UnaryFunction func)
+{
+  using iterator_traits = dash::iterator_traits<GlobInputIt>;
+  static_assert(
+      iterator_traits::is_global_iterator::value,
+      "must be a global iterator");
+  auto & team = first.pattern().team();
+  // Invoke function on native pointer ranges of local elements:
+  dash::internal::for_each_part(
+    policy.num_threads(),
+    dash::internal::local_chunks(first, last),
+    [&func](int, const typename dash::internal::local_chunk_type<
+                  GlobInputIt>::type & chunk,
+            std::size_t from, std::size_t to) {
+      std::for_each(chunk.begin + from, chunk.begin + to, func);
+    });
+  team.barrier();
+}
+
 /**
  * Invoke a function on every element in a range distributed by a pattern.
  * This function has the same signature as \c std::for_each but
@@ -23,6 +71,9 @@ namespace dash {
  *                            Signature does not need to have \c (const &)
  *                            but must be compatible to \c std::for_each.
  *
+ * Local elements are visited in tight loops on native pointers, for
+ * ranges of view iterators once for every local segment of the view.
+ *
  * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
  *              pattern and \c nl local elements within the global range
  *
@@ -36,24 +87,54 @@ void for_each(
     const GlobInputIt& last,
     /// Function to invoke on every index in the range
     UnaryFunction func)
+{
+  dash::for_each(dash::execution::seq, first, last, func);
+}
+
+/**
+ * Invoke a function on every element in a range distributed by a pattern,
+ * passing the element's global index and executing the local phase
+ * according to the given execution policy.
+ *
+ * \see  dash::for_each(ExecutionPolicy, GlobInputIt, GlobInputIt, UnaryFunction)
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  typename GlobInputIt,
+  class UnaryFunctionWithIndex>
+dash::internal::enable_if_execution_policy_t<ExecutionPolicy>
+for_each_with_index(
+    /// Execution policy of the local phase
+    ExecutionPolicy && policy,
+    /// Iterator to the initial position in the sequence
+    const GlobInputIt& first,
+    /// Iterator to the final position in the sequence
+    const GlobInputIt& last,
+    /// Function to invoke on every index in the range
+    UnaryFunctionWithIndex func)
 {
   using iterator_traits = dash::iterator_traits<GlobInputIt>;
   static_assert(
       iterator_traits::is_global_iterator::value,
       "must be a global iterator");
-  /// Global iterators to local index range:
-  auto index_range  = dash::local_index_range(first, last);
-  auto lbegin_index = index_range.begin;
-  auto lend_index   = index_range.end;
-  auto & team       = first.pattern().team();
-  if (lbegin_index != lend_index) {
-    // Pattern from global begin iterator:
-    auto & pattern    = first.pattern();
-    // Local range to native pointers:
-    auto lrange_begin = (first + pattern.global(lbegin_index)).local();
-    auto lrange_end   = lrange_begin + lend_index;
-    std::for_each(lrange_begin, lrange_end, func);
-  }
+
+  auto & team = first.pattern().team();
+  // Iterate local segments, global indices are consecutive in a segment:
+  dash::internal::for_each_part(
+    policy.num_threads(),
+    dash::local_segments(first, last),
+    [&func](int, const typename dash::internal::segment_type<
+                  GlobInputIt>::type & seg,
+            std::size_t from, std::size_t to) {
+      typedef typename GlobInputIt::index_type index_t;
+      index_t gindex = seg.gindex + static_cast<index_t>(from);
+      for (auto lptr = seg.lbegin + from; lptr != seg.lbegin + to;
+           ++lptr, ++gindex) {
+        func(*lptr, gindex);
+      }
+    });
   team.barrier();
 }
 
@@ -85,30 +166,7 @@ void for_each_with_index(
     /// Function to invoke on every index in the range
     UnaryFunctionWithIndex func)
 {
-  using iterator_traits = dash::iterator_traits<GlobInputIt>;
-  static_assert(
-      iterator_traits::is_global_iterator::value,
-      "must be a global iterator");
-
-  /// Global iterators to local index range:
-  auto index_range  = dash::local_index_range(first, last);
-  auto lbegin_index = index_range.begin;
-  auto lend_index   = index_range.end;
-  auto & team       = first.pattern().team();
-  if (lbegin_index != lend_index) {
-    // Pattern from global begin iterator:
-    auto & pattern    = first.pattern();
-    auto first_offset = first.pos();
-    // Iterate local index range:
-    for (auto lindex = lbegin_index;
-         lindex != lend_index;
-         ++lindex) {
-      auto gindex       = pattern.global(lindex);
-      auto element_it   = first + (gindex - first_offset);
-      func(*(element_it.local()), gindex);
-    }
-  }
-  team.barrier();
+  dash::for_each_with_index(dash::execution::seq, first, last, func);
 }
 
 } // namespace dash
@@ -1,8 +1,12 @@
 #ifndef DASH__ALGORITHM__GENERATE_H__
 #define DASH__ALGORITHM__GENERATE_H__
 
+#include <dash/ExecutionPolicy.h>
+
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Segments.h>
+#include <dash/algorithm/internal/Parallel.h>
 #include <dash/iterator/GlobIter.h>
 
 #include <dash/dart/if/dart_communication.h>
@@ -11,6 +15,45 @@
 
 namespace dash {
 
+/**
+ * Assigns each element in range [first, last) a value generated by the
+ * given function object g, executing the local phase according to the
+ * given execution policy.
+ *
+ * With a parallel policy, the generator is invoked concurrently by
+ * multiple threads and must be safe to do so.
+ *
+ * \see  dash::execution
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <class ExecutionPolicy, typename GlobInputIt, class UnaryFunction>
+dash::internal::enable_if_execution_policy_t<ExecutionPolicy>
+generate(
+    /// Execution policy of the local phase
+    ExecutionPolicy && policy,
+    /// Iterator to the initial position in the sequence
+    GlobInputIt first,
+    /// Iterator to the final position in the sequence
+    GlobInputIt last,
+    /// Generator function
+    UnaryFunction gen)
+{
+  using iterator_traits = dash::iterator_traits<GlobInputIt>;
+  static_assert(
+      iterator_traits::is_global_iterator::value,
+      "must be a global iterator");
+  // Generate values in native pointer ranges of local elements:
+  dash::internal::for_each_part(
+    policy.num_threads(),
+    dash::internal::local_chunks(first, last),
+    [&gen](int, const typename dash::internal::local_chunk_type<
+                 GlobInputIt>::type & chunk,
+           std::size_t from, std::size_t to) {
+      std::generate(chunk.begin + from, chunk.begin + to, gen);
+    });
+}
+
 /**
  * Assigns each element in range [first, last) a value generated by the
  * given function object g.
@@ -36,17 +79,49 @@ void generate(
     GlobInputIt last,
     /// Generator function
     UnaryFunction gen)
+{
+  dash::generate(dash::execution::seq, first, last, gen);
+}
+
+/**
+ * Assigns each element in range [first, last) a value generated by the
+ * given function object g from the element's global index, executing
+ * the local phase according to the given execution policy.
+ *
+ * \see  dash::generate(ExecutionPolicy, GlobInputIt, GlobInputIt, UnaryFunction)
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <class ExecutionPolicy, typename GlobInputIt, class UnaryFunction>
+dash::internal::enable_if_execution_policy_t<ExecutionPolicy>
+generate_with_index(
+    /// Execution policy of the local phase
+    ExecutionPolicy && policy,
+    /// Iterator to the initial position in the sequence
+    GlobInputIt first,
+    /// Iterator to the final position in the sequence
+    GlobInputIt last,
+    /// Generator function
+    UnaryFunction gen)
 {
   using iterator_traits = dash::iterator_traits<GlobInputIt>;
   static_assert(
       iterator_traits::is_global_iterator::value,
       "must be a global iterator");
-  /// Global iterators to local range:
-  auto lrange = dash::local_range(first, last);
-  auto lfirst = lrange.begin;
-  auto llast  = lrange.end;
-
-  std::generate(lfirst, llast, gen);
+  // Iterate local segments, global indices are consecutive in a segment:
+  dash::internal::for_each_part(
+    policy.num_threads(),
+    dash::local_segments(first, last),
+    [&gen](int, const typename dash::internal::segment_type<
+                 GlobInputIt>::type & seg,
+           std::size_t from, std::size_t to) {
+      typedef typename GlobInputIt::index_type index_t;
+      index_t gindex = seg.gindex + static_cast<index_t>(from);
+      for (auto lptr = seg.lbegin + from; lptr != seg.lbegin + to;
+           ++lptr, ++gindex) {
+        *lptr = gen(gindex);
+      }
+    });
 }
 
 /**
@@ -76,26 +151,7 @@ void generate_with_index(
     /// Generator function
     UnaryFunction gen)
 {
-  using iterator_traits = dash::iterator_traits<GlobInputIt>;
-  static_assert(
-      iterator_traits::is_global_iterator::value,
-      "must be a global iterator");
-  /// Global iterators to local index range:
-  auto index_range  = dash::local_index_range(first, last);
-  auto lbegin_index = index_range.begin;
-  auto lend_index   = index_range.end;
-
-  if (lbegin_index != lend_index) {
-    // Pattern from global begin iterator:
-    auto& pattern      = first.pattern();
-    auto  first_offset = first.pos();
-    // Iterate local index range:
-    for (auto lindex = lbegin_index; lindex != lend_index; ++lindex) {
-      auto gindex     = pattern.global(lindex);
-      auto element_it = first + (gindex - first_offset);
-      *element_it     = gen(gindex);
-    }
-  }
+  dash::generate_with_index(dash::execution::seq, first, last, gen);
 }
 
 }  // namespace dash
@@ -1,11 +1,24 @@
 #ifndef DASH__ALGORITHM__REDUCE_H__
 #define DASH__ALGORITHM__REDUCE_H__
 
+#include <dash/ExecutionPolicy.h>
+
 #include <dash/iterator/GlobIter.h>
 #include <dash/iterator/IteratorTraits.h>
 
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/Parallel.h>
+
+#include <dash/Future.h>
+#include <dash/Team.h>
+
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 
 namespace dash {
@@ -38,6 +51,262 @@ namespace internal {
       }
     }
   }
+
+  /**
+   * Variant of \c reduce_custom_fn for operations referencing the binary
+   * operation indirectly, \c userdata points to a pointer to the binary
+   * operation.
+   */
+  template<typename ValueType, typename F>
+  void reduce_custom_fn_indirect(
+    const void *invec,
+          void *inoutvec,
+          size_t len,
+          void *userdata)
+  {
+    reduce_custom_fn<ValueType, F>(
+      invec, inoutvec, len, *static_cast<F**>(userdata));
+  }
+
+  /**
+   * Identity element of a predefined DART reduction operation on
+   * arithmetic values, i.e. the value an empty unit contributes to the
+   * reduction.
+   *
+   * \return  \c false if the operation has no identity element
+   */
+  template<typename ValueType>
+  typename std::enable_if<std::is_arithmetic<ValueType>::value, bool>::type
+  reduce_identity(dart_operation_t dop, ValueType & identity)
+  {
+    using limits = std::numeric_limits<ValueType>;
+    switch (dop) {
+      case DART_OP_SUM:
+      case DART_OP_BOR:
+      case DART_OP_BXOR:
+      case DART_OP_LOR:
+      case DART_OP_LXOR:
+        identity = ValueType(0);
+        return true;
+      case DART_OP_PROD:
+      case DART_OP_LAND:
+        identity = ValueType(1);
+        return true;
+      case DART_OP_MIN:
+        identity = limits::has_infinity ? limits::infinity() : limits::max();
+        return true;
+      case DART_OP_MAX:
+        identity = limits::has_infinity ? -limits::infinity()
+                                        : limits::lowest();
+        return true;
+      case DART_OP_BAND:
+        if (std::is_integral<ValueType>::value) {
+          identity = static_cast<ValueType>(~0ull);
+          return true;
+        }
+        return false;
+      default:
+        return false;
+    }
+  }
+
+  template<typename ValueType>
+  typename std::enable_if<!std::is_arithmetic<ValueType>::value, bool>::type
+  reduce_identity(dart_operation_t, ValueType &)
+  {
+    return false;
+  }
+
+  /**
+   * Prepares a unit's local result of a reduction for a predefined DART
+   * reduction operation.
+   * Local results of empty units are replaced by the operation's identity
+   * element if \c non_empty is \c false.
+   *
+   * \return  \c false if a custom reduction operation is required
+   */
+  template<typename ValueType>
+  bool reduce_use_predefined(
+    local_result<ValueType> & l_result,
+    dart_operation_t          dop,
+    dart_datatype_t           dtype,
+    bool                      non_empty)
+  {
+    if (dop == DART_OP_UNDEFINED || dtype == DART_TYPE_UNDEFINED) {
+      return false;
+    }
+    if (non_empty) {
+      return true;
+    }
+    // Every unit has to decide equally without communication, so the
+    // predefined operation is only used if it has an identity element,
+    // regardless of the local result:
+    ValueType identity;
+    if (!reduce_identity(dop, identity)) {
+      return false;
+    }
+    if (!l_result.valid) {
+      l_result.value = identity;
+      l_result.valid = true;
+    }
+    return true;
+  }
+
+  /**
+   * DART data type and reduction operation for \c local_result<ValueType>
+   * and a custom binary operation.
+   *
+   * Creating the type and operation is expensive compared to reductions of
+   * small ranges, so they are created once per team on first use and
+   * released with the team.
+   * The operation calls the binary operation referenced in \c binary_op
+   * which has to be set for every reduction.
+   */
+  template<typename ValueType, typename BinaryOperation>
+  class reduce_custom_op {
+    using self_t         = reduce_custom_op<ValueType, BinaryOperation>;
+    using local_result_t = struct local_result<ValueType>;
+    using registry_t     = std::unordered_map<
+                             dart_team_t, std::unique_ptr<self_t> >;
+
+  public:
+    dart_datatype_t   dtype     = DART_TYPE_UNDEFINED;
+    dart_operation_t  dop       = DART_OP_UNDEFINED;
+    /// Binary operation of the reduction in progress
+    BinaryOperation * binary_op = nullptr;
+
+  public:
+    /**
+     * The team's instance, created on first use.
+     * Collective operation on first use in a team.
+     */
+    static self_t & get(dash::Team & team) {
+      auto & ops     = registry();
+      auto   team_id = team.dart_id();
+      auto   op_it   = ops.find(team_id);
+      if (op_it != ops.end()) {
+        return *(op_it->second);
+      }
+      DASH_LOG_DEBUG("dash::reduce", "create custom reduction operation",
+                     "team:", team_id);
+      auto * op = new self_t();
+      ops[team_id].reset(op);
+      // The operation and data type are process-local, they are released
+      // with the team as their first use in the team is collective:
+      team.register_deallocator(
+        op, [team_id]() { registry().erase(team_id); });
+      return *op;
+    }
+
+    reduce_custom_op(const self_t &)            = delete;
+    reduce_custom_op & operator=(const self_t &) = delete;
+
+    ~reduce_custom_op() {
+      dart_op_destroy(&dop);
+      dart_type_destroy(&dtype);
+    }
+
+  private:
+    reduce_custom_op() {
+      DASH_ASSERT_RETURNS(
+        dart_type_create_custom(sizeof(local_result_t), &dtype),
+        DART_OK);
+      // we need a custom reduction operation because not every unit
+      // may have valid values
+      DASH_ASSERT_RETURNS(
+        dart_op_create(
+          &dash::internal::reduce_custom_fn_indirect<
+            ValueType, BinaryOperation>,
+          &binary_op, true, dtype, true, &dop),
+        DART_OK);
+    }
+
+    static registry_t & registry() {
+      static registry_t ops;
+      return ops;
+    }
+  };
+
+  /**
+   * State of a non-blocking reduction, kept alive until the reduction
+   * completed and released with the last future referencing it.
+   */
+  template<typename ValueType, typename BinaryOperation>
+  struct reduce_async_state {
+    using local_result_t = struct local_result<ValueType>;
+
+    local_result_t   l_result;
+    local_result_t   g_result;
+    ValueType        init;
+    BinaryOperation  binary_op;
+    dart_datatype_t  dtype     = DART_TYPE_UNDEFINED;
+    dart_operation_t dop       = DART_OP_UNDEFINED;
+    bool             is_custom = false;
+    dart_handle_t    handle    = DART_HANDLE_NULL;
+
+    reduce_async_state(ValueType init_, BinaryOperation binary_op_)
+    : init(std::move(init_)),
+      binary_op(std::move(binary_op_))
+    { }
+
+    ~reduce_async_state() {
+      // buffers, type and operation must not be released before the
+      // reduction completed
+      dart_wait_local(&handle);
+      if (is_custom) {
+        dart_op_destroy(&dop);
+        dart_type_destroy(&dtype);
+      }
+    }
+
+    ValueType result() {
+      if (!g_result.valid) {
+        DASH_LOG_ERROR("dash::reduce_async()",
+                       "Found invalid reduction value!");
+      }
+      return binary_op(init, g_result.value);
+    }
+  };
+
+  /**
+   * Combines the units' local results of a reduction, collective
+   * operation.
+   * Units' local results may only be invalid if \c non_empty is
+   * \c false.
+   */
+  template<typename ValueType, typename BinaryOperation>
+  local_result<ValueType> reduce_local_results(
+    local_result<ValueType>   l_result,
+    BinaryOperation         & binary_op,
+    bool                      non_empty,
+    dash::Team              & team)
+  {
+    using local_result_t = struct local_result<ValueType>;
+
+    local_result_t   g_result;
+    dart_operation_t dop =
+                  dash::internal::dart_reduce_operation<BinaryOperation>::value;
+    dart_datatype_t  dtype = dash::dart_storage<ValueType>::dtype;
+
+    if (reduce_use_predefined(l_result, dop, dtype, non_empty)) {
+      // ideal case: we can use DART predefined reductions
+      DASH_ASSERT_RETURNS(
+        dart_allreduce(&l_result.value, &g_result.value, 1, dtype, dop,
+                       team.dart_id()),
+        DART_OK);
+      g_result.valid = true;
+    } else {
+      auto & custom_op = reduce_custom_op<ValueType, BinaryOperation>::get(
+                           team);
+      custom_op.binary_op = &binary_op;
+      DASH_ASSERT_RETURNS(
+        dart_allreduce(&l_result, &g_result, 1, custom_op.dtype,
+                       custom_op.dop, team.dart_id()),
+        DART_OK);
+      custom_op.binary_op = nullptr;
+    }
+    return g_result;
+  }
 } // namespace internal
 
 
@@ -91,34 +360,14 @@ reduce(
   auto l_last      = in_last;
 
   local_result_t l_result;
-  local_result_t g_result;
   if (l_first != l_last) {
     l_result.value = std::accumulate(std::next(l_first),
                                      l_last, *l_first,
                                      binary_op);
     l_result.valid = true;
   }
-  dart_operation_t dop =
-                  dash::internal::dart_reduce_operation<BinaryOperation>::value;
-  dart_datatype_t  dtype = dash::dart_storage<value_t>::dtype;
-
-  if (!non_empty || dop == DART_OP_UNDEFINED || dtype == DART_TYPE_UNDEFINED)
-  {
-    dart_type_create_custom(sizeof(local_result_t), &dtype);
-
-    // we need a custom reduction operation because not every unit
-    // may have valid values
-    dart_op_create(
-      &dash::internal::reduce_custom_fn<value_t, BinaryOperation>,
-      &binary_op, true, dtype, true, &dop);
-    dart_allreduce(&l_result, &g_result, 1, dtype, dop, team.dart_id());
-    dart_op_destroy(&dop);
-    dart_type_destroy(&dtype);
-  } else {
-    // ideal case: we can use DART predefined reductions
-    dart_allreduce(&l_result.value, &g_result.value, 1, dtype, dop, team.dart_id());
-    g_result.valid = true;
-  }
+  local_result_t g_result = dash::internal::reduce_local_results(
+                              l_result, binary_op, non_empty, team);
   if (!g_result.valid) {
     DASH_LOG_ERROR("dash::reduce()", "Found invalid reduction value!");
   }
@@ -129,6 +378,105 @@ reduce(
   return result;
 }
 
+/**
+ * Non-blocking variant of \c dash::reduce for local ranges.
+ * The reduction is started immediately and its result is available from
+ * the returned future, allowing to overlap the reduction with local work.
+ *
+ * The local range is accumulated before this function returns and may be
+ * modified afterwards.
+ *
+ * Collective operation.
+ *
+ * \param in_first  Local iterator describing the beginning of the range to
+ *                  reduce.
+ * \param in_last   Local iterator describing the end of the range to accumualte
+ * \param init      The initial element to use in the accumulation.
+ * \param binary_op The binary operation to apply to reduce two elements
+ *                  (default: using \ref dash::plus)
+ * \param non_empty Whether all units are guaranteed to provide a non-empty local
+ *                  range (default \c false).
+ * \param team      The team to use for the collective operation.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class LocalInputIter,
+  class InitType,
+  class BinaryOperation
+        = dash::plus<typename std::iterator_traits<LocalInputIter>::value_type>,
+  typename = typename std::enable_if<
+                        !dash::detail::is_global_iterator<LocalInputIter>::value
+                      >::type>
+dash::Future<typename std::iterator_traits<LocalInputIter>::value_type>
+reduce_async(
+  LocalInputIter    in_first,
+  LocalInputIter    in_last,
+  InitType          init,
+  BinaryOperation   binary_op = BinaryOperation(),
+  bool              non_empty = true,
+  dash::Team      & team = dash::Team::All())
+{
+  using value_t  = typename std::iterator_traits<LocalInputIter>::value_type;
+  using state_t  = dash::internal::reduce_async_state<value_t, BinaryOperation>;
+
+  auto state = std::make_shared<state_t>(
+                 static_cast<value_t>(init), binary_op);
+  if (in_first != in_last) {
+    state->l_result.value = std::accumulate(std::next(in_first),
+                                            in_last, *in_first,
+                                            binary_op);
+    state->l_result.valid = true;
+  }
+  state->dop   = dash::internal::dart_reduce_operation<BinaryOperation>::value;
+  state->dtype = dash::dart_storage<value_t>::dtype;
+
+  if (!dash::internal::reduce_use_predefined(
+         state->l_result, state->dop, state->dtype, non_empty))
+  {
+    dart_type_create_custom(sizeof(typename state_t::local_result_t),
+                            &state->dtype);
+    // the reduction operation refers to the binary operation kept in the
+    // shared state, so it is not shared with other reductions
+    dart_op_create(
+      &dash::internal::reduce_custom_fn<value_t, BinaryOperation>,
+      &state->binary_op, true, state->dtype, true, &state->dop);
+    state->is_custom = true;
+    DASH_ASSERT_RETURNS(
+      dart_iallreduce(&state->l_result, &state->g_result, 1,
+                      state->dtype, state->dop, team.dart_id(),
+                      &state->handle),
+      DART_OK);
+  } else {
+    DASH_ASSERT_RETURNS(
+      dart_iallreduce(&state->l_result.value, &state->g_result.value, 1,
+                      state->dtype, state->dop, team.dart_id(),
+                      &state->handle),
+      DART_OK);
+    state->g_result.valid = true;
+  }
+
+  return dash::Future<value_t>(
+    // wait
+    [state]() {
+      DASH_ASSERT_RETURNS(
+        dart_wait_local(&state->handle),
+        DART_OK);
+      return state->result();
+    },
+    // test
+    [state](value_t * out) {
+      int32_t flag;
+      DASH_ASSERT_RETURNS(
+        dart_test_local(&state->handle, &flag),
+        DART_OK);
+      if (flag) {
+        *out = state->result();
+      }
+      return (flag != 0);
+    });
+}
+
 /**
  * Accumulate values across the local ranges \c[in_first,in_last) of each
  * process as the sum of all values in the range.
@@ -176,6 +524,91 @@ reduce(
             team);
 }
 
+/**
+ * Accumulate values in the global range [\ref in_first, \ref in_last) using
+ * the provided binary reduce function \c binary_op, executing the local
+ * phase according to the given execution policy.
+ *
+ * With a parallel policy, the unit's local elements are split into parts
+ * which are accumulated by concurrent threads before the partial results
+ * are combined, so \c binary_op must be safe to invoke concurrently.
+ *
+ * Collective operation.
+ *
+ * \param policy    Execution policy of the local phase, see
+ *                  \c dash::execution.
+ * \param in_first  Global iterator describing the beginning of the range to
+ *                  reduce.
+ * \param in_last   Global iterator describing the end of the range to accumualte
+ * \param init      The initial element to use in the accumulation.
+ * \param binary_op The associative, commutative binary operation to apply.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class InitType = typename dash::iterator_traits<GlobInputIt>::value_type,
+  class BinaryOperation
+          = dash::plus<typename dash::iterator_traits<GlobInputIt>::value_type>,
+  typename = typename std::enable_if<
+                        dash::detail::is_global_iterator<GlobInputIt>::value
+                      >::type>
+dash::internal::enable_if_execution_policy_t<
+  ExecutionPolicy,
+  typename dash::iterator_traits<GlobInputIt>::value_type>
+reduce(
+  ExecutionPolicy && policy,
+  GlobInputIt        in_first,
+  GlobInputIt        in_last,
+  InitType           init,
+  BinaryOperation    binary_op = BinaryOperation())
+{
+  using value_t        = typename dash::iterator_traits<GlobInputIt>::value_type;
+  using local_result_t = struct dash::internal::local_result<value_t>;
+  using chunk_t        = typename dash::internal::local_chunk_type<
+                                    GlobInputIt>::type;
+
+  auto & team      = in_first.team();
+  auto   n_threads = policy.num_threads();
+
+  // Accumulate the parts of the local range:
+  std::vector<local_result_t> part_results(std::max(n_threads, 1));
+  dash::internal::for_each_part(
+    n_threads,
+    dash::internal::local_chunks(in_first, in_last),
+    [&](int part, const chunk_t & chunk, std::size_t from, std::size_t to) {
+      auto & p_result = part_results[part];
+      auto   l_first  = chunk.begin + from;
+      if (!p_result.valid) {
+        p_result.value = *l_first++;
+        p_result.valid = true;
+      }
+      p_result.value = std::accumulate(l_first, chunk.begin + to,
+                                       p_result.value, binary_op);
+    });
+  local_result_t l_result;
+  for (const auto & p_result : part_results) {
+    if (!p_result.valid) {
+      continue;
+    }
+    l_result.value = l_result.valid
+                     ? binary_op(l_result.value, p_result.value)
+                     : p_result.value;
+    l_result.valid = true;
+  }
+
+  // Units may be empty, predefined reductions are still used for
+  // operations with an identity element:
+  static constexpr bool units_non_empty = false;
+  local_result_t g_result = dash::internal::reduce_local_results(
+                              l_result, binary_op, units_non_empty, team);
+  if (!g_result.valid) {
+    DASH_LOG_ERROR("dash::reduce()", "Found invalid reduction value!");
+  }
+  return binary_op(init, g_result.value);
+}
+
 /**
  * Accumulate values in the global range [\ref in_first, \ref in_last) using
  * the provided binary reduce function \c binary_op, which must be commutative
@@ -214,20 +647,52 @@ reduce(
   GlobInputIt     in_last,
   InitType        init,
   BinaryOperation binary_op = BinaryOperation())
+{
+  return dash::reduce(dash::execution::seq,
+                      in_first,
+                      in_last,
+                      init,
+                      binary_op);
+}
+
+/**
+ * Non-blocking variant of \c dash::reduce for global ranges.
+ *
+ * Collective operation.
+ *
+ * \param in_first  Global iterator describing the beginning of the range to
+ *                  reduce.
+ * \param in_last   Global iterator describing the end of the range to accumualte
+ * \param init      The initial element to use in the accumulation.
+ * \param binary_op The associative, commutative binary operation to apply.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class InitType = typename dash::iterator_traits<GlobInputIt>::value_type,
+  class BinaryOperation
+          = dash::plus<typename dash::iterator_traits<GlobInputIt>::value_type>,
+  typename = typename std::enable_if<
+                        dash::detail::is_global_iterator<GlobInputIt>::value
+                      >::type>
+dash::Future<typename dash::iterator_traits<GlobInputIt>::value_type>
+reduce_async(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  InitType        init,
+  BinaryOperation binary_op = BinaryOperation())
 {
   auto & team      = in_first.team();
   auto index_range = dash::local_range(in_first, in_last);
-  auto l_first     = index_range.begin;
-  auto l_last      = index_range.end;
 
-  // TODO: can we figure out whether or not units are empty?
   static constexpr bool units_non_empty = false;
-  return dash::reduce(l_first,
-                      l_last,
-                      init,
-                      binary_op,
-                      units_non_empty,
-                      team);
+  return dash::reduce_async(index_range.begin,
+                            index_range.end,
+                            init,
+                            binary_op,
+                            units_non_empty,
+                            team);
 }
 
 } // namespace dash
@@ -6,9 +6,12 @@
 #include <dash/Pattern.h>
 #include <dash/Types.h>
 #include <dash/algorithm/Copy.h>
+#include <dash/algorithm/internal/GEMM.h>
 #include <dash/util/Trace.h>
 
+#include <algorithm>
 #include <utility>
+#include <vector>
 
 // Prefer MKL if available:
 #ifdef DASH_ENABLE_MKL
@@ -31,9 +34,11 @@ namespace dash {
 
 namespace internal {
 
-#if defined(DASH_ENABLE_MKL) || defined(DASH_ENABLE_BLAS)
 /**
- * Matrix multiplication for local multiplication of matrix blocks via MKL.
+ * Matrix multiplication for local multiplication of matrix blocks.
+ *
+ * Uses the built-in cache-blocked kernel \c dash::internal::gemm_blocked,
+ * specialized for \c float and \c double to use MKL or BLAS if available.
  */
 template<typename  ValueType>
 void mmult_local(
@@ -46,47 +51,50 @@ void mmult_local(
   long long         m,
   long long         n,
   long long         k,
-  MemArrange        storage);
-#else
-/**
- * Naive matrix multiplication for local multiplication of matrix blocks,
- * used only for tests and where MKL is not available.
- */
-template <typename ValueType>
-void mmult_local(
-    /// Matrix to multiply, extents n x m
-    const ValueType *A,
-    /// Matrix to multiply, extents m x p
-    const ValueType *B,
-    /// Matrix to contain the multiplication result, extents n x p
-    ValueType *C,
-    long long  m,
-    long long  n,
-    long long  p,
-    MemArrange /*storage*/)
+  /// Leading dimension of A, the number of elements between successive
+  /// rows (for row major storage) or columns (for column major storage).
+  long long         lda,
+  /// Leading dimension of B.
+  long long         ldb,
+  /// Leading dimension of C.
+  long long         ldc,
+  MemArrange        storage)
 {
-#ifndef DEBUG
-  DASH_THROW(
-    dash::exception::RuntimeError,
-    "Called fallback implementation of DGEMM (only enabled in Debug)");
-#endif
-  ValueType c_sum = 0;
-  for (auto i = 0; i < n; ++i) {
-    // row i = 0...n
-    for (auto j = 0; j < p; ++j) {
-      // column j = 0...p
-      c_sum = C[i * p + j]; // = C[j][i]
-      for (auto k = 0; k < m; ++k) {
-        // k = 0...m
-        auto ik     = i * m + k;
-        auto kj     = k * m + j;
-        auto value  = A[ik] * B[kj];
-        c_sum      += value;
-      }
-      C[i * p + j] = c_sum; // C[j][i] = c_sum
-    }
-  }
+  dash::internal::gemm_blocked(A, B, C, m, n, k, lda, ldb, ldc, storage);
 }
+
+#if defined(DASH_ENABLE_MKL) || defined(DASH_ENABLE_BLAS)
+/**
+ * Matrix multiplication for local multiplication of matrix blocks via MKL.
+ */
+template<>
+void mmult_local<float>(
+  const float * A,
+  const float * B,
+  float       * C,
+  long long     m,
+  long long     n,
+  long long     k,
+  long long     lda,
+  long long     ldb,
+  long long     ldc,
+  MemArrange    storage);
+
+/**
+ * Matrix multiplication for local multiplication of matrix blocks via MKL.
+ */
+template<>
+void mmult_local<double>(
+  const double * A,
+  const double * B,
+  double       * C,
+  long long      m,
+  long long      n,
+  long long      k,
+  long long      lda,
+  long long      ldb,
+  long long      ldc,
+  MemArrange     storage);
 #endif // defined(DASH_ENABLE_MKL) || defined(DASH_ENABLE_BLAS)
 
 } // namespace internal
@@ -240,10 +248,10 @@ void summa(
   auto pattern_a    = A.pattern();
   auto pattern_b    = B.pattern();
   auto pattern_c    = C.pattern();
-  auto m = pattern_a.extent(0); // number of columns in A, rows in B
+  auto m = pattern_a.extent(1); // number of columns in A, rows in B
 #if DASH_ENABLE_TRACE_LOGGING
-  auto n = pattern_a.extent(1); // number of rows in A and C
-  auto p = pattern_b.extent(0); // number of columns in B and C
+  auto n = pattern_a.extent(0); // number of rows in A and C
+  auto p = pattern_b.extent(1); // number of columns in B and C
 #endif
   const dash::MemArrange memory_order = pattern_a.memory_order();
 
@@ -269,29 +277,53 @@ void summa(
   DASH_LOG_TRACE("dash::summa", "matrix pattern extents valid");
 
   // Patterns are balanced, all blocks have identical size:
-  auto block_size_m   = pattern_a.block(0).extent(0);
-  auto block_size_n   = pattern_b.block(0).extent(1);
-  auto block_size_p   = pattern_b.block(0).extent(0);
-  auto num_blocks_m   = m / block_size_m;
+  auto block_a_rows   = pattern_a.block(0).extent(0);
+  auto block_a_cols   = pattern_a.block(0).extent(1);
+  auto block_b_rows   = pattern_b.block(0).extent(0);
+  auto block_b_cols   = pattern_b.block(0).extent(1);
+  auto block_c_rows   = pattern_c.block(0).extent(0);
+  auto block_c_cols   = pattern_c.block(0).extent(1);
+  if (block_c_rows != block_a_rows || block_c_cols != block_b_cols) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::summa(): "
+      "block extents of result matrix do not match block rows of first "
+      "operand and block columns of second operand");
+  }
+  // Block columns of A and block rows of B differ for non-square blocks.
+  // The shared dimension is split at the block boundaries of both operands
+  // so every segment is contained in a single block of A and of B:
+  std::vector<extent_t> k_offsets;
+  for (extent_t k = 0; k < m; ) {
+    k_offsets.push_back(k);
+    k = std::min<extent_t>({ (k / block_a_cols + 1) * block_a_cols,
+                             (k / block_b_rows + 1) * block_b_rows,
+                             m });
+  }
+  k_offsets.push_back(m);
+  extent_t num_segments_k = k_offsets.size() - 1;
 #if DASH_ENABLE_TRACE_LOGGING
-  auto num_blocks_n   = n / block_size_n;
-  auto num_blocks_p   = p / block_size_p;
+  auto num_blocks_n   = n / block_c_rows;
+  auto num_blocks_p   = p / block_c_cols;
 #endif
   // Size of temporary local blocks
-  auto block_a_size   = block_size_n * block_size_m;
-  auto block_b_size   = block_size_m * block_size_p;
+  auto block_a_size   = block_a_rows * block_a_cols;
+  auto block_b_size   = block_b_rows * block_b_cols;
   // Number of units in rows and columns:
   auto teamspec       = C.pattern().teamspec();
   auto unit_ts_coords = teamspec.coords(unit_id);
+  // Segment of the shared dimension multiplied first, differs between
+  // units to distribute communication:
+  extent_t first_segment_k = unit_ts_coords[0] % num_segments_k;
 
   DASH_LOG_TRACE("dash::summa", "blocks:",
-                 "m:", num_blocks_m, "*", block_size_m,
-                 "n:", num_blocks_n, "*", block_size_n,
-                 "p:", num_blocks_p, "*", block_size_p);
+                 "m:", num_segments_k, "segments",
+                 "n:", num_blocks_n, "*", block_c_rows,
+                 "p:", num_blocks_p, "*", block_c_cols);
   DASH_LOG_TRACE("dash::summa",
                  "number of units:",
-                 "cols:", teamspec.extent(0),
-                 "rows:", teamspec.extent(1),
+                 "rows:", teamspec.extent(0),
+                 "cols:", teamspec.extent(1),
                  "unit team coords:", unit_ts_coords);
   DASH_LOG_TRACE("dash::summa", "allocating local temporary blocks, sizes:",
                  "A:", block_a_size,
@@ -330,19 +362,27 @@ void summa(
   // blocks to be prefetched:
   auto     l_block_c_get       = C.local.block(0);
   auto     l_block_c_get_view  = l_block_c_get.begin().viewspec();
-  index_t  l_block_c_get_row   = l_block_c_get_view.offset(1) / block_size_n;
-  index_t  l_block_c_get_col   = l_block_c_get_view.offset(0) / block_size_p;
+  index_t  l_block_c_get_row   = l_block_c_get_view.offset(0) / block_c_rows;
+  index_t  l_block_c_get_col   = l_block_c_get_view.offset(1) / block_c_cols;
+  // Segment of the shared dimension of the blocks to prefetch:
+  extent_t segment_k_get       = first_segment_k;
   // Block coordinates of blocks in A and B to prefetch:
-  coords_t block_a_get_coords = coords_t {{ static_cast<index_t>(unit_ts_coords[0]),
-				   l_block_c_get_row }};
-  coords_t block_b_get_coords = coords_t {{ l_block_c_get_col,
-				   static_cast<index_t>(unit_ts_coords[0]) }};
+  coords_t block_a_get_coords  = coords_t {{
+                                   l_block_c_get_row,
+                                   static_cast<index_t>(
+                                     k_offsets[segment_k_get] /
+                                     block_a_cols) }};
+  coords_t block_b_get_coords  = coords_t {{
+                                   static_cast<index_t>(
+                                     k_offsets[segment_k_get] /
+                                     block_b_rows),
+                                   l_block_c_get_col }};
   // Local block index of local submatrix of C for multiplication result of
   // currently prefetched blocks:
   auto     l_block_c_comp      = l_block_c_get;
   auto     l_block_c_comp_view = l_block_c_comp.begin().viewspec();
-  index_t  l_block_c_comp_row  = l_block_c_comp_view.offset(1) / block_size_n;
-  index_t  l_block_c_comp_col  = l_block_c_comp_view.offset(0) / block_size_p;
+  // Segment of the shared dimension of the currently prefetched blocks:
+  extent_t segment_k_comp      = segment_k_get;
   // Prefetch blocks from A and B for computation in next iteration:
   dash::Future<value_type *> get_a;
   dash::Future<value_type *> get_b;
@@ -418,29 +458,20 @@ void summa(
 
   DASH_LOG_TRACE("dash::summa", "summa.block.C",
                  "C.num.local.blocks:",  num_local_blocks_c,
-                 "C.num.column.blocks:", num_blocks_m);
+                 "num.segments.k:",      num_segments_k);
 
   for (extent_t lb = 0; lb < num_local_blocks_c; ++lb) {
     // Block coordinates for current block multiplication result:
     l_block_c_comp      = C.local.block(lb);
     l_block_c_comp_view = l_block_c_comp.begin().viewspec();
-    l_block_c_comp_row  = l_block_c_comp_view.offset(1) / block_size_n;
-    l_block_c_comp_col  = l_block_c_comp_view.offset(0) / block_size_p;
-    // Block coordinates for next block multiplication result:
-    l_block_c_get       = l_block_c_comp;
-    l_block_c_get_view  = l_block_c_comp_view;
-    l_block_c_get_row   = l_block_c_get_row;
-    l_block_c_get_col   = l_block_c_get_col;
     DASH_LOG_TRACE("dash::summa", "summa.block.comp", "C.local.block",
                    "l_block_idx:", lb,
-                   "row:",         l_block_c_comp_row,
-                   "col:",         l_block_c_comp_col,
                    "view:",        l_block_c_comp_view);
     // -----------------------------------------------------------------------
-    // Iterate blocks in columns of A / rows of B:
+    // Iterate segments of columns of A / rows of B:
     // -----------------------------------------------------------------------
-    for (extent_t block_k = 0; block_k < num_blocks_m; ++block_k) {
-      DASH_LOG_TRACE("dash::summa", "summa.block.k", block_k,
+    for (extent_t seg_k = 0; seg_k < num_segments_k; ++seg_k) {
+      DASH_LOG_TRACE("dash::summa", "summa.block.k", segment_k_comp,
                      "active local block in C:", lb);
 
       // ---------------------------------------------------------------------
@@ -448,23 +479,28 @@ void summa(
       // next iteration.
       // ---------------------------------------------------------------------
       bool last = (lb == num_local_blocks_c - 1) &&
-                  (block_k == num_blocks_m - 1);
+                  (seg_k == num_segments_k - 1);
       // Do not prefetch blocks in last iteration:
       if (!last) {
-        auto block_get_k = static_cast<index_t>(block_k + 1);
-        block_get_k = (block_get_k + unit_ts_coords[0]) % num_blocks_m;
+        segment_k_get = (segment_k_comp + 1) % num_segments_k;
         // Block coordinate of local block in matrix C to prefetch:
-        if (block_k == num_blocks_m - 1) {
+        if (seg_k == num_segments_k - 1) {
           // Prefetch for next local block in matrix C:
-          block_get_k        = unit_ts_coords[0];
+          segment_k_get      = first_segment_k;
           l_block_c_get      = C.local.block(lb + 1);
           l_block_c_get_view = l_block_c_get.begin().viewspec();
-          l_block_c_get_row  = l_block_c_get_view.offset(1) / block_size_n;
-          l_block_c_get_col  = l_block_c_get_view.offset(0) / block_size_p;
+          l_block_c_get_row  = l_block_c_get_view.offset(0) / block_c_rows;
+          l_block_c_get_col  = l_block_c_get_view.offset(1) / block_c_cols;
         }
         // Block coordinates of blocks in A and B to prefetch:
-        block_a_get_coords = coords_t {{ block_get_k, l_block_c_get_row }};
-        block_b_get_coords = coords_t {{ l_block_c_get_col, block_get_k }};
+        block_a_get_coords = coords_t {{
+                               l_block_c_get_row,
+                               static_cast<index_t>(
+                                 k_offsets[segment_k_get] / block_a_cols) }};
+        block_b_get_coords = coords_t {{
+                               static_cast<index_t>(
+                                 k_offsets[segment_k_get] / block_b_rows),
+                               l_block_c_get_col }};
 
         block_a      = A.block(block_a_get_coords);
         block_a_lptr = block_a.begin().local();
@@ -511,14 +547,29 @@ void summa(
                      "C.local.block.comp:", lb,
                      "view:", l_block_c_comp.begin().viewspec());
 
+      // Offsets of the segment in the shared dimension within the blocks
+      // of A and B:
+      auto seg_begin   = k_offsets[segment_k_comp];
+      auto seg_size    = k_offsets[segment_k_comp + 1] - seg_begin;
+      auto seg_a_begin = seg_begin % block_a_cols;
+      auto seg_b_begin = seg_begin % block_b_rows;
+      bool row_major   = (memory_order == dash::ROW_MAJOR);
+
       trace.enter_state("multiply");
       dash::internal::mmult_local<value_type>(
-          local_block_a_comp,
-          local_block_b_comp,
+          local_block_a_comp + (row_major
+                                ? seg_a_begin
+                                : seg_a_begin * block_a_rows),
+          local_block_b_comp + (row_major
+                                ? seg_b_begin * block_b_cols
+                                : seg_b_begin),
           l_block_c_comp.begin().local(),
-          block_size_m,
-          block_size_n,
-          block_size_p,
+          block_c_rows,
+          block_c_cols,
+          seg_size,
+          row_major ? block_a_cols : block_a_rows,
+          row_major ? block_b_cols : block_b_rows,
+          row_major ? block_c_cols : block_c_rows,
           memory_order);
       trace.exit_state("multiply");
 
@@ -556,6 +607,7 @@ void summa(
         // -----------------------------------------------------------------
         std::swap(local_block_a_get, local_block_a_comp);
         std::swap(local_block_b_get, local_block_b_comp);
+        segment_k_comp = segment_k_get;
         if (local_block_a_get_bac != nullptr) {
           local_block_a_comp_bac = local_block_a_get_bac;
           local_block_a_get_bac  = nullptr;
@@ -0,0 +1,381 @@
+#ifndef DASH__ALGORITHM__SEGMENTS_H__
+#define DASH__ALGORITHM__SEGMENTS_H__
+
+#include <dash/Types.h>
+#include <dash/Range.h>
+#include <dash/Iterator.h>
+
+#include <dash/algorithm/LocalRange.h>
+
+#include <dash/iterator/internal/ContiguousRange.h>
+
+#include <dash/internal/Logging.h>
+
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * A segment of a global range: a maximal sequence of consecutive elements
+ * in the range that are stored consecutively in the local memory of a
+ * single unit.
+ *
+ * Global ranges and views are decomposed into segments by
+ * \c dash::segments, so algorithms can process every segment in a tight
+ * loop on native pointers instead of resolving every element's position
+ * from global iterators.
+ *
+ * \see dash::segments
+ * \see dash::local_segments
+ */
+template<typename ValueType, typename IndexType>
+struct Segment {
+  /// Unit owning the elements in the segment
+  team_unit_t  unit;
+  /// Offset of the segment's first element from the range's begin
+  IndexType    pos;
+  /// Global index of the segment's first element in the pattern
+  IndexType    gindex;
+  /// Offset of the segment's first element in the owner's local memory
+  IndexType    lindex;
+  /// Native pointer to the segment's first element, \c nullptr if the
+  /// segment is not local to the calling unit
+  ValueType  * lbegin;
+  /// Number of elements in the segment
+  IndexType    size;
+};
+
+namespace internal {
+
+template<class GlobIterType>
+struct segment_type {
+  typedef Segment<
+            typename std::remove_pointer<
+              typename GlobIterType::local_type>::type,
+            typename GlobIterType::index_type >
+    type;
+};
+
+/**
+ * Native pointer to the calling unit's local memory of the global memory
+ * referenced by a global iterator.
+ */
+template<class GlobIterType>
+typename GlobIterType::local_type
+segment_lbegin(GlobIterType first)
+{
+  return dash::local_begin(
+           static_cast<typename GlobIterType::pointer>(
+             first.globmem().begin()),
+           first.team().myid());
+}
+
+} // namespace internal
+
+/**
+ * Forward iterator on the segments of a global range.
+ *
+ * Segments are resolved lazily, advancing the iterator resolves the
+ * extent of the next segment in O(d) for every block row it spans.
+ */
+template<class GlobIterType>
+class SegmentIterator {
+private:
+  typedef SegmentIterator<GlobIterType>                    self_t;
+  typedef internal::ContiguousRangeIterator<GlobIterType>  range_iterator;
+  typedef typename GlobIterType::local_type                local_pointer;
+
+public:
+  typedef std::forward_iterator_tag                        iterator_category;
+  typedef typename internal::segment_type<GlobIterType>::type
+                                                           value_type;
+  typedef typename GlobIterType::index_type                difference_type;
+  typedef const value_type *                               pointer;
+  typedef const value_type &                               reference;
+
+public:
+  SegmentIterator(
+    range_iterator  range_it,
+    local_pointer   lbegin,
+    team_unit_t     myid)
+  : _range_it(range_it),
+    _lbegin(lbegin),
+    _myid(myid)
+  {
+    _segment.pos = 0;
+    resolve();
+  }
+
+  reference operator*() const noexcept {
+    return _segment;
+  }
+
+  pointer operator->() const noexcept {
+    return &_segment;
+  }
+
+  self_t & operator++() {
+    _segment.pos += _segment.size;
+    ++_range_it;
+    resolve();
+    return *this;
+  }
+
+  self_t operator++(int) {
+    self_t result = *this;
+    ++(*this);
+    return result;
+  }
+
+  bool operator==(const self_t & other) const {
+    return _range_it == other._range_it;
+  }
+
+  bool operator!=(const self_t & other) const {
+    return _range_it != other._range_it;
+  }
+
+private:
+  void resolve() {
+    auto range     = *_range_it;
+    _segment.size  = range.second;
+    if (_segment.size == 0) {
+      return;
+    }
+    auto lpos        = range.first.lpos();
+    _segment.unit    = lpos.unit;
+    _segment.lindex  = lpos.index;
+    _segment.gindex  = range.first.gpos();
+    _segment.lbegin  = (lpos.unit == _myid && _lbegin != nullptr)
+                       ? _lbegin + lpos.index
+                       : nullptr;
+    DASH_LOG_TRACE("SegmentIterator.resolve >",
+                   "unit:",   _segment.unit,
+                   "pos:",    _segment.pos,
+                   "lindex:", _segment.lindex,
+                   "size:",   _segment.size);
+  }
+
+private:
+  range_iterator  _range_it;
+  local_pointer   _lbegin;
+  team_unit_t     _myid;
+  value_type      _segment;
+};
+
+/**
+ * Range of the segments of a global range, as returned by
+ * \c dash::segments.
+ */
+template<class GlobIterType>
+class SegmentRange {
+public:
+  typedef SegmentIterator<GlobIterType>  iterator;
+  typedef SegmentIterator<GlobIterType>  const_iterator;
+  typedef typename iterator::value_type  value_type;
+
+public:
+  SegmentRange(GlobIterType first, GlobIterType last)
+  : _first(first),
+    _last(last),
+    _lbegin(internal::segment_lbegin(first)),
+    _myid(first.team().myid())
+  { }
+
+  iterator begin() const {
+    return iterator(
+             internal::ContiguousRangeIterator<GlobIterType>(_first, _last),
+             _lbegin, _myid);
+  }
+
+  iterator end() const {
+    return iterator(
+             internal::ContiguousRangeIterator<GlobIterType>(_last, _last),
+             _lbegin, _myid);
+  }
+
+private:
+  GlobIterType                        _first;
+  GlobIterType                        _last;
+  typename GlobIterType::local_type   _lbegin;
+  team_unit_t                         _myid;
+};
+
+/**
+ * Decomposes the global range \c [first, last) into segments, i.e.
+ * sequences of elements that are contiguous in the local memory of a
+ * single unit.
+ *
+ * Segments are visited in the iteration order of the range. For ranges
+ * of global view iterators like blocks or sub-matrices, every segment
+ * is limited to a row of the view.
+ *
+ * \b Example:
+ *
+ * \code
+ *   dash::Matrix<double, 2> matrix(rows, cols);
+ *   for (const auto & seg : dash::segments(matrix.sub<0>(2, 5))) {
+ *     if (seg.lbegin != nullptr) {
+ *       std::fill(seg.lbegin, seg.lbegin + seg.size, 0.0);
+ *     }
+ *   }
+ * \endcode
+ *
+ * \complexity  O(d) for every block row in the range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<class GlobIterType>
+SegmentRange<GlobIterType>
+segments(
+  /// Iterator to the initial position in the global sequence
+  const GlobIterType & first,
+  /// Iterator to the final position in the global sequence
+  const GlobIterType & last)
+{
+  return SegmentRange<GlobIterType>(first, last);
+}
+
+/**
+ * Decomposes a global range or view into segments.
+ *
+ * \see  dash::segments(first, last)
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<class RangeType>
+auto
+segments(
+  /// Global range or view
+  RangeType && range)
+  -> SegmentRange<typename std::decay<
+                    decltype(dash::begin(std::forward<RangeType>(range)))
+                  >::type>
+{
+  return dash::segments(dash::begin(std::forward<RangeType>(range)),
+                        dash::end(std::forward<RangeType>(range)));
+}
+
+/**
+ * Segments of the global range \c [first, last) in the local memory of
+ * the calling unit, ordered by their position in the range.
+ *
+ * Without view projection, all local elements in the range are contained
+ * in their local index range so only local segments are resolved.
+ *
+ * \complexity  O(d) for every local block row in the range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<class GlobIterType>
+typename std::enable_if<
+  !GlobIterType::has_view::value,
+  std::vector<typename internal::segment_type<GlobIterType>::type>
+>::type
+local_segments(
+  /// Iterator to the initial position in the global sequence
+  const GlobIterType & first,
+  /// Iterator to the final position in the global sequence
+  const GlobIterType & last)
+{
+  typedef typename GlobIterType::index_type                   index_t;
+  typedef typename internal::segment_type<GlobIterType>::type segment_t;
+
+  std::vector<segment_t> lsegments;
+  auto index_range = dash::local_index_range(first, last);
+  if (index_range.begin == index_range.end) {
+    return lsegments;
+  }
+  const auto & pattern = first.pattern();
+  auto         myid    = first.team().myid();
+  auto         lbegin  = internal::segment_lbegin(first);
+  // Walk the local index range segment by segment:
+  for (index_t lindex = index_range.begin; lindex < index_range.end; ) {
+    index_t gindex   = pattern.global(lindex);
+    auto    seg_it   = first + (gindex - first.pos());
+    index_t seg_size = std::min<index_t>(
+                         internal::contiguous_range_size(seg_it, last),
+                         index_range.end - lindex);
+    DASH_ASSERT_GT(seg_size, 0, "empty local segment");
+    lsegments.push_back(
+      segment_t { myid, gindex - static_cast<index_t>(first.pos()), gindex,
+                  lindex, lbegin + lindex, seg_size });
+    lindex += seg_size;
+  }
+  return lsegments;
+}
+
+/**
+ * Segments of the global view range \c [first, last) in the local memory
+ * of the calling unit, ordered by their position in the range.
+ *
+ * \complexity  O(d) for every block row in the view
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<class GlobIterType>
+typename std::enable_if<
+  GlobIterType::has_view::value,
+  std::vector<typename internal::segment_type<GlobIterType>::type>
+>::type
+local_segments(
+  /// Iterator to the initial position in the global sequence
+  const GlobIterType & first,
+  /// Iterator to the final position in the global sequence
+  const GlobIterType & last)
+{
+  typedef typename internal::segment_type<GlobIterType>::type segment_t;
+
+  std::vector<segment_t> lsegments;
+  for (const auto & seg : dash::segments(first, last)) {
+    if (seg.lbegin != nullptr) {
+      lsegments.push_back(seg);
+    }
+  }
+  return lsegments;
+}
+
+namespace internal {
+
+/**
+ * Invokes \c func on every native pointer range \c [lbegin, lend) of the
+ * calling unit's elements in the global range \c [first, last), for
+ * algorithms that do not depend on the global positions of elements.
+ *
+ * Without view projection, local elements in the range are contiguous in
+ * local memory and \c func is invoked once on the local range. Otherwise
+ * \c func is invoked on every local segment.
+ */
+template<class GlobIterType, class LocalRangeFunction>
+typename std::enable_if<!GlobIterType::has_view::value>::type
+for_each_local_chunk(
+  GlobIterType       first,
+  GlobIterType       last,
+  LocalRangeFunction func)
+{
+  auto lrange = dash::local_range(first, last);
+  if (lrange.begin != lrange.end) {
+    func(lrange.begin, lrange.end);
+  }
+}
+
+template<class GlobIterType, class LocalRangeFunction>
+typename std::enable_if<GlobIterType::has_view::value>::type
+for_each_local_chunk(
+  GlobIterType       first,
+  GlobIterType       last,
+  LocalRangeFunction func)
+{
+  for (const auto & seg : dash::local_segments(first, last)) {
+    func(seg.lbegin, seg.lbegin + seg.size);
+  }
+}
+
+} // namespace internal
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SEGMENTS_H__
@@ -2,6 +2,8 @@
 #define DASH__ALGORITHM__SORT_H
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <iterator>
 #include <type_traits>
@@ -15,8 +17,14 @@
 #include <dash/algorithm/Copy.h>
 #include <dash/algorithm/LocalRange.h>
 
+#include <dash/internal/Config.h>
 #include <dash/internal/Logging.h>
 #include <dash/util/Trace.h>
+#include <dash/util/UnitLocality.h>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
 
 namespace dash {
 
@@ -85,6 +93,8 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash hash);
 #define __DASH_SORT__FINAL_STEP_BY_MERGE (0)
 #define __DASH_SORT__FINAL_STEP_BY_SORT (1)
 #define __DASH_SORT__FINAL_STEP_STRATEGY (__DASH_SORT__FINAL_STEP_BY_MERGE)
+// Minimum number of local elements to sort and merge with multiple threads
+#define __DASH_SORT__PARALLEL_MIN_ELEMENTS (1 << 15)
 
 #include <dash/algorithm/internal/Sort-inl.h>
 
@@ -117,7 +127,14 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   if (pattern.team().size() == 1) {
     DASH_LOG_TRACE("dash::sort", "Sorting on a team with only 1 unit");
     trace.enter_state("final_local_sort");
-    std::sort(begin.local(), end.local(), sort_comp);
+    auto* const lfirst = begin.local();
+    auto* const llast  = end.local();
+    detail::psort__local_sort(
+        lfirst,
+        llast,
+        sortable_hash,
+        sort_comp,
+        detail::psort__num_threads(std::distance(lfirst, llast)));
     trace.exit_state("final_local_sort");
     return;
   }
@@ -147,33 +164,24 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   auto * lbegin = l_mem_begin + l_range.begin;
   auto * lend   = l_mem_begin + l_range.end;
 
+  // threads used for local sorting and merging
+  auto const nthreads = detail::psort__num_threads(n_l_elem);
+
   // initial local_sort
   trace.enter_state("1:initial_local_sort");
-  std::sort(lbegin, lend, sort_comp);
+  detail::psort__local_sort(lbegin, lend, sortable_hash, sort_comp, nthreads);
   trace.exit_state("1:initial_local_sort");
 
-  trace.enter_state("2:init_temporary_global_data");
-
-  using array_t = dash::Array<std::size_t>;
-
-  std::size_t gsize = nunits * NLT_NLE_BLOCK * 2;
-
-  // implicit barrier...
-  array_t g_partition_data(nunits * nunits * 3, dash::BLOCKED, team);
-  std::uninitialized_fill(
-      g_partition_data.lbegin(), g_partition_data.lend(), 0);
-
-  trace.exit_state("2:init_temporary_global_data");
+  trace.enter_state("2:find_global_min_max");
 
-  trace.enter_state("3:find_global_min_max");
-
-  // Temporary local buffer (sorted);
-  std::vector<value_type> const lcopy(lbegin, lend);
+  // Temporary local buffer (sorted), reused as receive buffer in the data
+  // exchange
+  std::vector<value_type> lcopy(lbegin, lend);
 
   auto const min_max = detail::find_global_min_max(
       std::begin(lcopy), std::end(lcopy), team.dart_id(), sortable_hash);
 
-  trace.exit_state("3:find_global_min_max");
+  trace.exit_state("2:find_global_min_max");
 
   DASH_LOG_TRACE_VAR("global minimum in range", min_max.first);
   DASH_LOG_TRACE_VAR("global maximum in range", min_max.second);
@@ -184,7 +192,7 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
     return;
   }
 
-  trace.enter_state("4:init_temporary_local_data");
+  trace.enter_state("3:init_temporary_local_data");
 
   auto const p_unit_info =
       detail::psort__find_partition_borders(pattern, begin, end);
@@ -238,9 +246,9 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
     return;
   }
 
-  trace.exit_state("4:init_temporary_local_data");
+  trace.exit_state("3:init_temporary_local_data");
 
-  trace.enter_state("5:find_global_partition_borders");
+  trace.enter_state("4:find_global_partition_borders");
 
   size_t iter = 0;
 
@@ -286,11 +294,11 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
         p_unit_info, splitters, valid_partitions, p_borders, global_histo);
   } while (!done);
 
-  trace.exit_state("5:find_global_partition_borders");
+  trace.exit_state("4:find_global_partition_borders");
 
   DASH_LOG_TRACE_VAR("partition borders found after N iterations", iter);
 
-  trace.enter_state("6:final_local_histogram");
+  trace.enter_state("5:final_local_histogram");
 
   /* How many elements are less than P
    * or less than equals P */
@@ -301,153 +309,104 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
       std::begin(lcopy),
       std::end(lcopy),
       sortable_hash);
-  trace.exit_state("6:final_local_histogram");
+  trace.exit_state("5:final_local_histogram");
 
   DASH_LOG_TRACE_RANGE("final splitters", splitters.begin(), splitters.end());
 
   detail::trace_local_histo("final histograms", histograms);
 
-  trace.enter_state("7:transpose_local_histograms (all-to-all)");
-
-  if (n_l_elem > 0) {
-    // TODO(kowalewski): minimize communication to copy only until the last
-    // valid border
-    /*
-     * Transpose (Shuffle) the final histograms to communicate
-     * the partition distribution
-     */
-
-    dash::team_unit_t transposed_unit{0};
-    for (auto it = std::begin(histograms); it != std::end(histograms);
-         it += NLT_NLE_BLOCK, ++transposed_unit) {
-      auto const& nlt_val = *it;
-      auto const& nle_val = *std::next(it);
-      if (transposed_unit != myid) {
-        auto const offset = transposed_unit * g_partition_data.lsize() + myid;
-        // We communicate only non-zero values
-        if (nlt_val > 0) {
-          g_partition_data.async[offset + IDX_DIST(nunits)].set(&(nlt_val));
-        }
-
-        if (nle_val > 0) {
-          g_partition_data.async[offset + IDX_SUPP(nunits)].set(&(nle_val));
-        }
-      }
-      else {
-        g_partition_data.local[myid + IDX_DIST(nunits)] = nlt_val;
-        g_partition_data.local[myid + IDX_SUPP(nunits)] = nle_val;
-      }
-    }
-    // complete outstanding requests...
-    g_partition_data.async.flush();
-  }
-  trace.exit_state("7:transpose_local_histograms (all-to-all)");
+  trace.enter_state("6:transpose_local_histograms (all-to-all)");
 
-  trace.enter_state("8:barrier");
-  team.barrier();
-  trace.exit_state("8:barrier");
+  // Partition data is exchanged in O(nunits) buffers per unit:
+  // Every unit receives the number of elements less than / less than or
+  // equal its partition border from all units
+  std::vector<size_t> l_nlt_nle(nunits * NLT_NLE_BLOCK, 0);
 
-  DASH_LOG_TRACE_RANGE(
-      "initial partition distribution:",
-      std::next(g_partition_data.lbegin(), IDX_DIST(nunits)),
-      std::next(g_partition_data.lbegin(), IDX_DIST(nunits) + nunits));
+  DASH_ASSERT_RETURNS(
+      dart_alltoall(
+          histograms.data(),
+          l_nlt_nle.data(),
+          NLT_NLE_BLOCK,
+          dash::dart_datatype<size_t>::value,
+          team.dart_id()),
+      DART_OK);
 
-  DASH_LOG_TRACE_RANGE(
-      "initial partition supply:",
-      std::next(g_partition_data.lbegin(), IDX_SUPP(nunits)),
-      std::next(g_partition_data.lbegin(), IDX_SUPP(nunits) + nunits));
+  trace.exit_state("6:transpose_local_histograms (all-to-all)");
 
   /* Calculate final distribution per partition. Each unit calculates their
    * local distribution independently.
-   * All accesses are only to local memory
    */
 
-  trace.enter_state("9:calc_final_partition_dist");
+  trace.enter_state("7:calc_final_partition_dist");
 
-  detail::psort__calc_final_partition_dist(
-      acc_partition_count, g_partition_data.local);
+  std::vector<size_t> l_partition_dist(nunits);
+  std::vector<size_t> l_partition_supp(nunits);
+  for (std::size_t unit = 0; unit < nunits; ++unit) {
+    l_partition_dist[unit] = l_nlt_nle[unit * NLT_NLE_BLOCK];
+    l_partition_supp[unit] = l_nlt_nle[unit * NLT_NLE_BLOCK + 1];
+  }
 
   DASH_LOG_TRACE_RANGE(
-      "final partition distribution",
-      std::next(g_partition_data.lbegin(), IDX_DIST(nunits)),
-      std::next(g_partition_data.lbegin(), IDX_DIST(nunits) + nunits));
+      "initial partition distribution:",
+      std::begin(l_partition_dist),
+      std::end(l_partition_dist));
+
+  DASH_LOG_TRACE_RANGE(
+      "initial partition supply:",
+      std::begin(l_partition_supp),
+      std::end(l_partition_supp));
 
-  // Reset local elements to 0 since the following matrix transpose
-  // communicates only non-zero values and writes to exactly these offsets.
-  std::fill(
-      &(g_partition_data.local[IDX_TARGET_COUNT(nunits)]),
-      &(g_partition_data.local[IDX_TARGET_COUNT(nunits) + nunits]),
-      0);
+  detail::psort__calc_final_partition_dist(
+      acc_partition_count, myid, l_partition_dist, l_partition_supp);
 
-  trace.exit_state("9:calc_final_partition_dist");
+  DASH_LOG_TRACE_RANGE(
+      "final partition distribution",
+      std::begin(l_partition_dist),
+      std::end(l_partition_dist));
 
-  trace.enter_state("10:barrier");
-  team.barrier();
-  trace.exit_state("10:barrier");
+  trace.exit_state("7:calc_final_partition_dist");
 
-  trace.enter_state("11:transpose_final_partition_dist (all-to-all)");
+  trace.enter_state("8:transpose_final_partition_dist (all-to-all)");
   /*
    * Transpose the final distribution again to obtain the end offsets
    */
-  dash::team_unit_t unit{0};
-  auto const        last = static_cast<dash::team_unit_t>(nunits);
-
-  for (; unit < last; ++unit) {
-    if (g_partition_data.local[IDX_DIST(nunits) + unit] == 0) {
-      continue;
-    }
-
-    if (unit != myid) {
-      // We communicate only non-zero values
-      auto const offset = unit * g_partition_data.lsize() + myid;
-      g_partition_data.async[offset + IDX_TARGET_COUNT(nunits)].set(
-          &(g_partition_data.local[IDX_DIST(nunits) + unit]));
-    }
-    else {
-      g_partition_data.local[IDX_TARGET_COUNT(nunits) + myid] =
-          g_partition_data.local[IDX_DIST(nunits) + unit];
-    }
-  }
-
-  g_partition_data.async.flush();
-
-  trace.exit_state("11:transpose_final_partition_dist (all-to-all)");
+  std::vector<size_t> l_target_count(nunits, 0);
 
-  trace.enter_state("12:barrier");
-  team.barrier();
-  trace.exit_state("12:barrier");
+  DASH_ASSERT_RETURNS(
+      dart_alltoall(
+          l_partition_dist.data(),
+          l_target_count.data(),
+          1,
+          dash::dart_datatype<size_t>::value,
+          team.dart_id()),
+      DART_OK);
 
   DASH_LOG_TRACE_RANGE(
       "final target count",
-      std::next(g_partition_data.lbegin(), IDX_TARGET_COUNT(nunits)),
-      std::next(
-          g_partition_data.lbegin(), IDX_TARGET_COUNT(nunits) + nunits));
+      std::begin(l_target_count),
+      std::end(l_target_count));
 
-  trace.enter_state("13:calc_final_send_count");
+  trace.exit_state("8:transpose_final_partition_dist (all-to-all)");
 
-  std::vector<std::size_t> l_send_displs(nunits, 0);
+  trace.enter_state("9:calc_final_send_count");
 
-  if (n_l_elem > 0) {
-    auto const* l_target_count =
-        &(g_partition_data.local[IDX_TARGET_COUNT(nunits)]);
-    auto* l_send_count = &(g_partition_data.local[IDX_SEND_COUNT(nunits)]);
+  std::vector<size_t> l_send_count(nunits, 0);
+  std::vector<size_t> l_send_displs(nunits, 0);
 
+  if (n_l_elem > 0) {
     detail::psort__calc_send_count(
-        p_borders, valid_partitions, l_target_count, l_send_count);
+        p_borders,
+        valid_partitions,
+        l_target_count.cbegin(),
+        l_send_count.begin());
 
     // exclusive scan using partial sum
     std::partial_sum(
-        l_send_count,
-        std::next(l_send_count, nunits - 1),
+        std::begin(l_send_count),
+        std::prev(std::end(l_send_count)),
         std::next(std::begin(l_send_displs)),
         std::plus<size_t>());
   }
-  else {
-    std::fill(
-        std::next(g_partition_data.lbegin(), IDX_SEND_COUNT(nunits)),
-        std::next(g_partition_data.lbegin(), IDX_SEND_COUNT(nunits) + nunits),
-        0);
-  }
 
 #if defined(DASH_ENABLE_ASSERTIONS) && defined(DASH_ENABLE_TRACE_LOGGING)
   {
@@ -455,7 +414,7 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
     DASH_ASSERT_RETURNS(
         dart_allreduce(
-            std::next(g_partition_data.lbegin(), IDX_SEND_COUNT(nunits)),
+            l_send_count.data(),
             chksum.data(),
             nunits,
             dart_datatype<size_t>::value,
@@ -471,63 +430,74 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 #endif
 
   DASH_LOG_TRACE_RANGE(
-      "send count",
-      std::next(g_partition_data.lbegin(), IDX_SEND_COUNT(nunits)),
-      std::next(g_partition_data.lbegin(), IDX_SEND_COUNT(nunits) + nunits));
+      "send count", std::begin(l_send_count), std::end(l_send_count));
 
   DASH_LOG_TRACE_RANGE(
       "send displs", l_send_displs.begin(), l_send_displs.end());
 
-  trace.exit_state("13:calc_final_send_count");
-
-  trace.enter_state("14:barrier");
-  team.barrier();
-  trace.exit_state("14:barrier");
-
+  trace.exit_state("9:calc_final_send_count");
 
-  trace.enter_state("15:calc_final_target_displs");
+  trace.enter_state("10:exchange_send_info (all-to-all)");
 
-  if (n_l_elem > 0) {
-    detail::psort__calc_target_displs(
-        p_borders, valid_partitions, g_partition_data);
+  // Every unit receives offset and size of the partition to fetch from
+  // all units
+  std::vector<size_t> l_send_info(nunits * 2);
+  std::vector<size_t> l_recv_info(nunits * 2);
+  for (std::size_t unit = 0; unit < nunits; ++unit) {
+    l_send_info[unit * 2]     = l_send_displs[unit];
+    l_send_info[unit * 2 + 1] = l_send_count[unit];
   }
 
-  trace.exit_state("15:calc_final_target_displs");
-
-  trace.enter_state("16:barrier");
-  team.barrier();
-  trace.exit_state("16:barrier");
+  DASH_ASSERT_RETURNS(
+      dart_alltoall(
+          l_send_info.data(),
+          l_recv_info.data(),
+          2,
+          dash::dart_datatype<size_t>::value,
+          team.dart_id()),
+      DART_OK);
+
+  // Received partitions are stored in the order of source units
+  std::vector<size_t> recv_count_psum(nunits + 1, 0);
+  for (std::size_t unit = 0; unit < nunits; ++unit) {
+    recv_count_psum[unit + 1] = recv_count_psum[unit] + l_recv_info[unit * 2 + 1];
+  }
 
   DASH_LOG_TRACE_RANGE(
-      "target displs",
-      &(g_partition_data.local[IDX_TARGET_DISP(nunits)]),
-      &(g_partition_data.local[IDX_TARGET_DISP(nunits) + nunits]));
+      "recv count prefix sum",
+      std::begin(recv_count_psum),
+      std::end(recv_count_psum));
 
-  trace.enter_state("17:exchange_data (all-to-all)");
+  trace.exit_state("10:exchange_send_info (all-to-all)");
 
-  std::vector<dash::Future<iter_type> > async_copies{};
-  async_copies.reserve(p_unit_info.valid_remote_partitions.size());
+  trace.enter_state("11:exchange_data (all-to-all)");
 
-  auto const l_partition_data = g_partition_data.local;
+  /* Partitions are fetched from the locally sorted ranges of their source
+   * units into the local copy of the sorted range which is not needed
+   * anymore. Sequences are merged as soon as they are received.
+   */
+  std::vector<dart_handle_t> handles(nunits, DART_HANDLE_NULL);
 
-  auto const get_send_info = [l_partition_data, &l_send_displs, nunits](
-                                 dash::default_index_t const p_idx) {
-    auto const send_count = l_partition_data[p_idx + IDX_SEND_COUNT(nunits)];
-    auto const target_disp =
-        l_partition_data[p_idx + IDX_TARGET_DISP(nunits)];
-    auto const send_disp = l_send_displs[p_idx];
-    return std::make_tuple(send_count, send_disp, target_disp);
-  };
+  for (dash::team_unit_t unit{0}; unit < static_cast<dash::team_unit_t>(nunits);
+       ++unit) {
+    auto const src_disp   = l_recv_info[unit * 2];
+    auto const recv_count = l_recv_info[unit * 2 + 1];
 
-  std::size_t send_count, send_disp, target_disp;
+    if (recv_count == 0) {
+      continue;
+    }
 
-  for (auto const& unit : p_unit_info.valid_remote_partitions) {
-    std::tie(send_count, send_disp, target_disp) = get_send_info(unit);
+    auto* const recv_buf = lcopy.data() + recv_count_psum[unit];
+
+    if (unit == myid) {
+      std::copy(lbegin + src_disp, lbegin + src_disp + recv_count, recv_buf);
+      continue;
+    }
 
     // Get a global iterator to the first local element of a unit within the
     // range to be sorted [begin, end)
     //
-    iter_type it_copy =
+    iter_type it_src =
         (unit == unit_at_begin)
             ?
             /* If we are the unit at the beginning of the global range simply
@@ -538,32 +508,38 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
                element from the correspoding unit */
             iter_type{&(begin.globmem()),
                       pattern,
-                      pattern.global_index(
-                          static_cast<dash::team_unit_t>(unit), {})};
-
-    auto&& fut = dash::copy_async(
-        &(*(lcopy.begin() + send_disp)),
-        &(*(lcopy.begin() + send_disp + send_count)),
-        it_copy + target_disp);
+                      pattern.global_index(unit, {})};
 
-    async_copies.emplace_back(std::move(fut));
+    dash::dart_storage<value_type> ds(recv_count);
+    DASH_ASSERT_RETURNS(
+        dart_get_handle(
+            recv_buf,
+            (it_src + src_disp).dart_gptr(),
+            ds.nelem,
+            ds.dtype,
+            ds.dtype,
+            &handles[unit]),
+        DART_OK);
   }
 
-  std::tie(send_count, send_disp, target_disp) = get_send_info(myid);
+#if (__DASH_SORT__FINAL_STEP_STRATEGY == __DASH_SORT__FINAL_STEP_BY_SORT)
+  DASH_ASSERT_RETURNS(
+      dart_waitall_local(handles.data(), handles.size()), DART_OK);
+#else
+  auto const merged_psum = detail::psort__merge_incoming(
+      lcopy.data(), recv_count_psum, handles, sort_comp);
 
-  if (send_count) {
-    std::copy(
-        std::next(std::begin(lcopy), send_disp),
-        std::next(std::begin(lcopy), send_disp + send_count),
-        std::next(lbegin, target_disp));
-  }
+  DASH_LOG_TRACE_RANGE(
+      "merged sequences", std::begin(merged_psum), std::end(merged_psum));
+#endif
 
-  std::for_each(
-      std::begin(async_copies),
-      std::end(async_copies),
-      [](dash::Future<iter_type>& fut) { fut.wait(); });
+  trace.exit_state("11:exchange_data (all-to-all)");
 
-  trace.exit_state("17:exchange_data (all-to-all)");
+  // All units have to complete reading from the local range before it is
+  // overwritten with the final result
+  trace.enter_state("12:barrier");
+  team.barrier();
+  trace.exit_state("12:barrier");
 
   /* NOTE: While merging locally sorted sequences is faster than another
    * heavy-weight sort it comes at a cost. std::inplace_merge allocates a
@@ -582,93 +558,23 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
    */
 
 #if (__DASH_SORT__FINAL_STEP_STRATEGY == __DASH_SORT__FINAL_STEP_BY_SORT)
-  trace.enter_state("18:barrier");
-  team.barrier();
-  trace.exit_state("18:barrier");
-
-  trace.enter_state("19:final_local_sort");
-  std::sort(lbegin, lend);
-  trace.exit_state("19:final_local_sort");
+  trace.enter_state("13:final_local_sort");
+  std::copy(std::begin(lcopy), std::end(lcopy), lbegin);
+  detail::psort__local_sort(lbegin, lend, sortable_hash, sort_comp, nthreads);
+  trace.exit_state("13:final_local_sort");
 #else
-  trace.enter_state("18:calc_recv_count (all-to-all)");
-
-  std::vector<size_t> recv_count(nunits, 0);
-
-  DASH_ASSERT_RETURNS(
-  dart_alltoall(
-      // send buffer
-      std::next(g_partition_data.lbegin(), IDX_SEND_COUNT(nunits)),
-      // receive buffer
-      recv_count.data(),
-      // we send / receive 1 element to / from each process
-      1,
-      // dtype
-      dash::dart_datatype<size_t>::value,
-      // teamid
-      team.dart_id()), DART_OK);
-
-  DASH_LOG_TRACE_RANGE(
-      "recv count", std::begin(recv_count), std::end(recv_count));
-
-  trace.exit_state("18:calc_recv_count (all-to-all)");
-
-  trace.enter_state("19:merge_local_sequences");
-
-  // merging sorted sequences
-  auto nsequences = nunits;
-  // number of merge steps in the tree
-  auto const depth = static_cast<size_t>(std::ceil(std::log2(nsequences)));
-
-  // calculate the prefix sum among all receive counts to find the offsets for
-  // merging
-  std::vector<size_t> recv_count_psum;
-  recv_count_psum.reserve(nsequences + 1);
-  recv_count_psum.emplace_back(0);
-
-  std::partial_sum(
-      std::begin(recv_count),
-      std::end(recv_count),
-      std::back_inserter(recv_count_psum));
-
-  DASH_LOG_TRACE_RANGE(
-      "recv count prefix sum",
-      std::begin(recv_count_psum),
-      std::end(recv_count_psum));
-
-  for (std::size_t d = 0; d < depth; ++d) {
-    // distance between first and mid iterator while merging
-    auto const step = std::size_t(0x1) << d;
-    // distance between first and last iterator while merging
-    auto const dist = step << 1;
-    // number of merges
-    auto const nmerges = nsequences >> 1;
-
-    // These merges are independent from each other and are candidates for
-    // shared memory parallelism
-    for (std::size_t m = 0; m < nmerges; ++m) {
-      auto first = std::next(lbegin, recv_count_psum[m * dist]);
-      auto mid   = std::next(lbegin, recv_count_psum[m * dist + step]);
-      // sometimes we have a lonely merge in the end, so we have to guarantee
-      // that we do not access out of bounds
-      auto last = std::next(
-          lbegin,
-          recv_count_psum[std::min(
-              m * dist + dist, recv_count_psum.size() - 1)]);
-
-      std::inplace_merge(first, mid, last);
-    }
-
-    nsequences -= nmerges;
-  }
-
-  trace.exit_state("19:merge_local_sequences");
+  trace.enter_state("13:merge_local_sequences");
+  // Final k-way merge of the remaining sequences into the local range
+  detail::psort__merge_sequences(
+      lcopy.data(), merged_psum, lbegin, sort_comp, nthreads);
+  trace.exit_state("13:merge_local_sequences");
 #endif
 
   DASH_LOG_TRACE_RANGE("finally sorted range", lbegin, lend);
 
-  trace.enter_state("20:final_barrier");
+  trace.enter_state("14:final_barrier");
   team.barrier();
-  trace.exit_state("20:final_barrier");
+  trace.exit_state("14:final_barrier");
 }
 
 namespace detail {
@@ -6,8 +6,10 @@
 
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Segments.h>
 
 #include <dash/Iterator.h>
+#include <dash/iterator/internal/ContiguousRange.h>
 
 #include <dash/internal/Config.h>
 #include <dash/util/Trace.h>
@@ -332,32 +334,27 @@ GlobOutputIt transform(
   DASH_ASSERT_MSG(
     team_in_a == pattern_out.team(),
     "dash::transform: Different teams in input- and output ranges");
-  // Resolve local range from global range:
-  auto l_index_range_in_a       = local_index_range(in_a_first, in_a_last);
-  DASH_LOG_TRACE_VAR("dash::transform", l_index_range_in_a.begin);
-  DASH_LOG_TRACE_VAR("dash::transform", l_index_range_in_a.end);
-  // Local range to global offset:
-  auto global_offset            = pattern_in_a.global(
-                                    l_index_range_in_a.begin);
-  DASH_LOG_TRACE_VAR("dash::transform", global_offset);
-  // Number of elements in local range:
-  size_t num_local_elements     = l_index_range_in_a.end -
-                                  l_index_range_in_a.begin;
-  DASH_LOG_TRACE_VAR("dash::transform", num_local_elements);
-  // Global iterator to dart_gptr_t:
-  dart_gptr_t dest_gptr         = (out_first + global_offset).dart_gptr();
-  // Native pointer to local sub-range:
-  auto l_values          = (in_a_first + global_offset).local();
-  // Send accumulate message:
+  // Accumulate every local segment of the input range to the corresponding
+  // contiguous ranges of the output range:
   trace.enter_state("transform_blocking");
-  dash::internal::transform_blocking_impl(
-      dest_gptr,
-      l_values,
-      num_local_elements,
-      binary_op.dart_operation());
+  for (const auto & seg : dash::local_segments(in_a_first, in_a_last)) {
+    DASH_LOG_TRACE("dash::transform", "local segment",
+                   "pos:", seg.pos, "size:", seg.size);
+    auto l_values  = seg.lbegin;
+    auto out_begin = out_first + seg.pos;
+    for (auto out_range : dash::internal::ContiguousRangeSet<GlobOutputIt>(
+                            out_begin, out_begin + seg.size)) {
+      dash::internal::transform_blocking_impl(
+          out_range.first.dart_gptr(),
+          l_values,
+          out_range.second,
+          binary_op.dart_operation());
+      l_values += out_range.second;
+    }
+  }
   trace.exit_state("transform_blocking");
 
-  return out_first + global_offset + num_local_elements;
+  return out_first + dash::distance(in_a_first, in_a_last);
 
 }
 
@@ -0,0 +1,388 @@
+#ifndef DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/internal/Config.h>
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * Width in bytes of the vector registers used by the built-in GEMM
+ * micro-kernel, selected from the instruction set targeted at compile time.
+ * A width of 0 selects the scalar kernel.
+ */
+#ifndef DASH__GEMM__VECTOR_BYTES
+#  if !defined(__GNUC__) && !defined(__clang__)
+#    define DASH__GEMM__VECTOR_BYTES 0
+#  elif defined(__AVX512F__)
+#    define DASH__GEMM__VECTOR_BYTES 64
+#  elif defined(__AVX__)
+#    define DASH__GEMM__VECTOR_BYTES 32
+#  elif defined(__SSE2__) || defined(__ARM_NEON) || defined(__ARM_NEON__) \
+        || defined(__ALTIVEC__)
+#    define DASH__GEMM__VECTOR_BYTES 16
+#  else
+#    define DASH__GEMM__VECTOR_BYTES 0
+#  endif
+#endif
+
+/**
+ * Full unrolling of the micro-kernel loops, required to keep the tile of C
+ * in registers at optimization levels below -O3.
+ */
+#if defined(__clang__)
+#  define DASH__GEMM__UNROLL _Pragma("unroll")
+#elif defined(__GNUC__) && (__GNUC__ >= 8)
+#  define DASH__GEMM__UNROLL _Pragma("GCC unroll 16")
+#else
+#  define DASH__GEMM__UNROLL
+#endif
+
+/**
+ * Minimum number of multiply-add operations of a local matrix product
+ * for which the OpenMP split over tiles of C is used.
+ */
+#ifndef DASH__GEMM__OPENMP_MIN_OPS
+#  define DASH__GEMM__OPENMP_MIN_OPS (64LL * 64LL * 64LL)
+#endif
+
+namespace dash {
+namespace internal {
+namespace gemm {
+
+/**
+ * Vector type used by the micro-kernel for element type \c T, scalar
+ * fallback for types without vector register support.
+ */
+template <
+  typename T,
+  bool     Simd = ( DASH__GEMM__VECTOR_BYTES > 0 &&
+                    ( std::is_floating_point<T>::value ||
+                      std::is_integral<T>::value ) &&
+                    !std::is_same<T, bool>::value &&
+                    !std::is_same<T, long double>::value &&
+                    sizeof(T) <= 8 ) >
+struct vector_traits
+{
+  typedef T type;
+  static constexpr int width = 1;
+};
+
+#if DASH__GEMM__VECTOR_BYTES > 0
+template <typename T>
+struct vector_traits<T, true>
+{
+  typedef T type __attribute__((vector_size(DASH__GEMM__VECTOR_BYTES)));
+  static constexpr int width = DASH__GEMM__VECTOR_BYTES / sizeof(T);
+};
+#endif
+
+/**
+ * Register and cache blocking parameters for element type \c T.
+ *
+ * The micro-kernel keeps an \c mr x \c nr tile of C in registers, as
+ * \c mr x \c nv vectors. Packed panels of A (\c mc x \c kc) are sized to
+ * stay in L2 cache, micro-panels of B (\c kc x \c nr) in L1 cache.
+ */
+template <typename T>
+struct block_traits
+{
+  typedef vector_traits<T> vector;
+
+  static constexpr int       nv = (vector::width == 1) ? 4 : 2;
+  static constexpr int       mr = (DASH__GEMM__VECTOR_BYTES >= 64) ? 12
+                                  : (vector::width == 1) ? 4 : 6;
+  static constexpr int       nr = nv * vector::width;
+  static constexpr long long kc = 256;
+  static constexpr long long mc = mr * 16;
+  static constexpr long long nc = nr * 256;
+};
+
+/**
+ * Packs an \c mc x \c kc block of row-major matrix A into row panels of
+ * height \c mr, stored column by column. Panels are padded with zeros.
+ */
+template <typename T>
+void pack_a(
+  const T   * A,
+  long long   lda,
+  long long   mc,
+  long long   kc,
+  T         * packed)
+{
+  constexpr int mr = block_traits<T>::mr;
+  for (long long i0 = 0; i0 < mc; i0 += mr) {
+    const long long rows = std::min<long long>(mr, mc - i0);
+    for (long long p = 0; p < kc; ++p) {
+      for (long long i = 0; i < rows; ++i) {
+        packed[i] = A[(i0 + i) * lda + p];
+      }
+      for (long long i = rows; i < mr; ++i) {
+        packed[i] = T();
+      }
+      packed += mr;
+    }
+  }
+}
+
+/**
+ * Packs the \c nr columns starting at \c B of a \c kc x \c nc block of
+ * row-major matrix B into a micro-panel stored row by row. Panels are
+ * padded with zeros.
+ */
+template <typename T>
+void pack_b_panel(
+  const T   * B,
+  long long   ldb,
+  long long   kc,
+  long long   cols,
+  T         * packed)
+{
+  constexpr int nr = block_traits<T>::nr;
+  for (long long p = 0; p < kc; ++p) {
+    const T * b_row = B + p * ldb;
+    for (long long j = 0; j < cols; ++j) {
+      packed[j] = b_row[j];
+    }
+    for (long long j = cols; j < nr; ++j) {
+      packed[j] = T();
+    }
+    packed += nr;
+  }
+}
+
+/**
+ * Micro-kernel, computes C += A * B for an \c mr x \c nr tile of C from a
+ * packed row panel of A and a packed micro-panel of B.
+ * Tiles at the matrix edges (\c rows < mr or \c cols < nr) are accumulated
+ * in registers like full tiles and only the valid elements are written
+ * back.
+ */
+template <typename T>
+inline void micro_kernel(
+  long long   kc,
+  const T   * a,
+  const T   * b,
+  T         * C,
+  long long   ldc,
+  long long   rows,
+  long long   cols)
+{
+  typedef block_traits<T>                 block;
+  typedef typename block::vector::type    vec_t;
+  constexpr int mr = block::mr;
+  constexpr int nr = block::nr;
+  constexpr int nv = block::nv;
+  constexpr int vw = block::vector::width;
+
+  vec_t acc[mr][nv];
+  for (int i = 0; i < mr; ++i) {
+    for (int j = 0; j < nv; ++j) {
+      acc[i][j] = vec_t();
+    }
+  }
+  for (long long p = 0; p < kc; ++p) {
+    vec_t b_vec[nv];
+    DASH__GEMM__UNROLL
+    for (int j = 0; j < nv; ++j) {
+      std::memcpy(&b_vec[j], b + j * vw, sizeof(vec_t));
+    }
+    DASH__GEMM__UNROLL
+    for (int i = 0; i < mr; ++i) {
+      const T a_ip = a[i];
+      DASH__GEMM__UNROLL
+      for (int j = 0; j < nv; ++j) {
+        acc[i][j] += a_ip * b_vec[j];
+      }
+    }
+    a += mr;
+    b += nr;
+  }
+
+  if (rows == mr && cols == nr) {
+    for (int i = 0; i < mr; ++i) {
+      T * c_row = C + i * ldc;
+      for (int j = 0; j < nv; ++j) {
+        vec_t c_vec;
+        std::memcpy(&c_vec, c_row + j * vw, sizeof(vec_t));
+        c_vec += acc[i][j];
+        std::memcpy(c_row + j * vw, &c_vec, sizeof(vec_t));
+      }
+    }
+  } else {
+    T tile[mr * nr];
+    for (int i = 0; i < mr; ++i) {
+      for (int j = 0; j < nv; ++j) {
+        std::memcpy(tile + i * nr + j * vw, &acc[i][j], sizeof(vec_t));
+      }
+    }
+    for (long long i = 0; i < rows; ++i) {
+      for (long long j = 0; j < cols; ++j) {
+        C[i * ldc + j] += tile[i * nr + j];
+      }
+    }
+  }
+}
+
+/**
+ * Cache-blocked matrix product C += A * B of row-major matrices with
+ * arbitrary leading dimensions.
+ *
+ * A is \c m x \c k, B is \c k x \c n and C is \c m x \c n.
+ */
+template <typename T>
+void gemm_row_major(
+  long long   m,
+  long long   n,
+  long long   k,
+  const T   * A,
+  long long   lda,
+  const T   * B,
+  long long   ldb,
+  T         * C,
+  long long   ldc)
+{
+  typedef block_traits<T> block;
+  constexpr int       mr = block::mr;
+  constexpr int       nr = block::nr;
+  constexpr long long kc = block::kc;
+  constexpr long long mc = block::mc;
+  constexpr long long nc = block::nc;
+
+  if (m <= 0 || n <= 0 || k <= 0) {
+    return;
+  }
+
+  const long long nc_max  = std::min<long long>(nc, (n + nr - 1) / nr * nr);
+  const long long kc_max  = std::min<long long>(kc, k);
+  const long long mc_max  = std::min<long long>(mc, (m + mr - 1) / mr * mr);
+  std::vector<T>  b_packed(kc_max * nc_max);
+
+#ifdef DASH_ENABLE_OPENMP
+  const bool use_threads = m * n * k >= DASH__GEMM__OPENMP_MIN_OPS &&
+                           m > mc &&
+                           !omp_in_parallel();
+  #pragma omp parallel if (use_threads)
+#endif
+  {
+    std::vector<T> a_packed(mc_max * kc_max);
+
+    for (long long jc = 0; jc < n; jc += nc) {
+      const long long nc_cur = std::min<long long>(nc, n - jc);
+      for (long long pc = 0; pc < k; pc += kc) {
+        const long long kc_cur = std::min<long long>(kc, k - pc);
+
+        const long long nb_panels = (nc_cur + nr - 1) / nr;
+#ifdef DASH_ENABLE_OPENMP
+        #pragma omp for schedule(static)
+#endif
+        for (long long jp = 0; jp < nb_panels; ++jp) {
+          const long long jr = jp * nr;
+          pack_b_panel(B + pc * ldb + jc + jr, ldb, kc_cur,
+                       std::min<long long>(nr, nc_cur - jr),
+                       b_packed.data() + jp * kc_cur * nr);
+        }
+
+        // Row blocks of C are distributed to threads, every thread packs
+        // its own panel of A:
+        const long long na_blocks = (m + mc - 1) / mc;
+#ifdef DASH_ENABLE_OPENMP
+        #pragma omp for schedule(dynamic, 1)
+#endif
+        for (long long ib = 0; ib < na_blocks; ++ib) {
+          const long long ic     = ib * mc;
+          const long long mc_cur = std::min<long long>(mc, m - ic);
+          pack_a(A + ic * lda + pc, lda, mc_cur, kc_cur, a_packed.data());
+
+          for (long long jr = 0; jr < nc_cur; jr += nr) {
+            const T * b_panel = b_packed.data() + (jr / nr) * kc_cur * nr;
+            const long long cols = std::min<long long>(nr, nc_cur - jr);
+            for (long long ir = 0; ir < mc_cur; ir += mr) {
+              const T * a_panel = a_packed.data() + (ir / mr) * kc_cur * mr;
+              micro_kernel(
+                kc_cur, a_panel, b_panel,
+                C + (ic + ir) * ldc + jc + jr, ldc,
+                std::min<long long>(mr, mc_cur - ir), cols);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+} // namespace gemm
+
+/**
+ * Built-in matrix multiplication C += A * B for local matrix blocks, used
+ * where no BLAS implementation is available.
+ *
+ * Operands are packed into cache-sized panels and multiplied by a
+ * register-blocked micro-kernel using the vector instruction set selected
+ * at compile time (SSE, AVX, AVX-512, NEON). Row blocks of C are
+ * distributed to OpenMP threads if OpenMP is enabled.
+ */
+template <typename ValueType>
+void gemm_blocked(
+  /// Matrix to multiply, m rows by k columns.
+  const ValueType * A,
+  /// Matrix to multiply, k rows by n columns.
+  const ValueType * B,
+  /// Matrix to contain the multiplication result, m rows by n columns.
+  ValueType       * C,
+  long long         m,
+  long long         n,
+  long long         k,
+  /// Leading dimension of A, the number of elements between successive
+  /// rows (for row major storage) or columns (for column major storage).
+  long long         lda,
+  /// Leading dimension of B.
+  long long         ldb,
+  /// Leading dimension of C.
+  long long         ldc,
+  MemArrange        storage)
+{
+  if (storage == dash::COL_MAJOR) {
+    // C^T = B^T * A^T, and the transposed column-major matrices are
+    // row-major:
+    gemm::gemm_row_major(n, m, k, B, ldb, A, lda, C, ldc);
+  } else {
+    gemm::gemm_row_major(m, n, k, A, lda, B, ldb, C, ldc);
+  }
+}
+
+/**
+ * Built-in matrix multiplication C += A * B for contiguous local matrix
+ * blocks.
+ */
+template <typename ValueType>
+void gemm_blocked(
+  /// Matrix to multiply, m rows by k columns.
+  const ValueType * A,
+  /// Matrix to multiply, k rows by n columns.
+  const ValueType * B,
+  /// Matrix to contain the multiplication result, m rows by n columns.
+  ValueType       * C,
+  long long         m,
+  long long         n,
+  long long         k,
+  MemArrange        storage)
+{
+  if (storage == dash::COL_MAJOR) {
+    gemm_blocked(A, B, C, m, n, k, m, k, m, storage);
+  } else {
+    gemm_blocked(A, B, C, m, n, k, k, n, n, storage);
+  }
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
@@ -0,0 +1,163 @@
+#ifndef DASH__ALGORITHM__INTERNAL__PARALLEL_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__PARALLEL_H__INCLUDED
+
+#include <dash/ExecutionPolicy.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Segments.h>
+
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Minimum number of local elements per thread in local algorithm phases,
+ * smaller ranges are processed by fewer threads.
+ */
+#ifndef DASH__ALGORITHM__PARALLEL_MIN_ELEMENTS
+#define DASH__ALGORITHM__PARALLEL_MIN_ELEMENTS 1024
+#endif
+
+template<typename ElementType>
+std::size_t chunk_size(const dash::LocalRange<ElementType> & chunk)
+{
+  return static_cast<std::size_t>(chunk.end - chunk.begin);
+}
+
+template<typename ElementType, typename IndexType>
+std::size_t chunk_size(const dash::Segment<ElementType, IndexType> & seg)
+{
+  return static_cast<std::size_t>(seg.size);
+}
+
+template<class GlobIterType>
+struct local_chunk_type {
+  typedef dash::LocalRange<
+            typename std::remove_pointer<
+              typename GlobIterType::local_type>::type>
+    type;
+};
+
+/**
+ * Native pointer ranges of the calling unit's elements in the global
+ * range \c [first, last), ordered by their position in the range.
+ *
+ * \see  dash::internal::for_each_local_chunk
+ */
+template<class GlobIterType>
+typename std::enable_if<
+  !GlobIterType::has_view::value,
+  std::vector<typename local_chunk_type<GlobIterType>::type>
+>::type
+local_chunks(
+  GlobIterType first,
+  GlobIterType last)
+{
+  std::vector<typename local_chunk_type<GlobIterType>::type> chunks;
+  auto lrange = dash::local_range(first, last);
+  if (lrange.begin != lrange.end) {
+    chunks.push_back({ lrange.begin, lrange.end });
+  }
+  return chunks;
+}
+
+template<class GlobIterType>
+typename std::enable_if<
+  GlobIterType::has_view::value,
+  std::vector<typename local_chunk_type<GlobIterType>::type>
+>::type
+local_chunks(
+  GlobIterType first,
+  GlobIterType last)
+{
+  std::vector<typename local_chunk_type<GlobIterType>::type> chunks;
+  for (const auto & seg : dash::local_segments(first, last)) {
+    chunks.push_back({ seg.lbegin, seg.lbegin + seg.size });
+  }
+  return chunks;
+}
+
+/**
+ * Splits the elements in a sequence of chunks into at most \c n_parts
+ * parts of balanced size and invokes
+ * \c func(part, chunk, offset_begin, offset_end) for every subrange
+ * \c [offset_begin, offset_end) of a chunk assigned to a part.
+ *
+ * Parts are ordered: all elements of part \c p precede the elements of
+ * part \c p+1 in the sequence of chunks, and every part's subranges are
+ * visited in order.
+ * Parts are processed by one thread each if multi-threading is enabled,
+ * otherwise sequentially in the calling thread.
+ * Every part contains at least \c DASH__ALGORITHM__PARALLEL_MIN_ELEMENTS
+ * elements unless the sequence is processed in a single part.
+ */
+template<class ChunkType, class PartFunction>
+void for_each_part(
+  int                            n_parts,
+  const std::vector<ChunkType> & chunks,
+  PartFunction                   func)
+{
+  // Prefix sum of chunk sizes, offsets[c] is the position of the first
+  // element of chunk c in the sequence:
+  std::vector<std::size_t> offsets(chunks.size() + 1, 0);
+  for (std::size_t c = 0; c < chunks.size(); ++c) {
+    offsets[c + 1] = offsets[c] + chunk_size(chunks[c]);
+  }
+  const std::size_t nelem = offsets.back();
+  DASH_LOG_TRACE("dash::internal::for_each_part",
+                 "parts:", n_parts, "chunks:", chunks.size(),
+                 "elements:", nelem);
+  if (nelem == 0) {
+    return;
+  }
+  n_parts = static_cast<int>(
+              std::max<std::size_t>(
+                std::min<std::size_t>(
+                  n_parts, nelem / DASH__ALGORITHM__PARALLEL_MIN_ELEMENTS),
+                1));
+
+  auto process_part = [&](int part) {
+    std::size_t part_begin = (nelem * part) / n_parts;
+    std::size_t part_end   = (nelem * (part + 1)) / n_parts;
+    // Chunk containing the part's first element:
+    std::size_t c = std::upper_bound(offsets.begin(), offsets.end(),
+                                     part_begin)
+                    - offsets.begin() - 1;
+    for (; c < chunks.size() && offsets[c] < part_end; ++c) {
+      std::size_t from = std::max(part_begin, offsets[c])   - offsets[c];
+      std::size_t to   = std::min(part_end, offsets[c + 1]) - offsets[c];
+      if (from < to) {
+        func(part, chunks[c], from, to);
+      }
+    }
+  };
+
+#ifdef DASH_ENABLE_OPENMP
+  if (n_parts > 1) {
+    #pragma omp parallel for num_threads(n_parts) schedule(static, 1)
+    for (int part = 0; part < n_parts; ++part) {
+      process_part(part);
+    }
+    return;
+  }
+#endif
+  for (int part = 0; part < n_parts; ++part) {
+    process_part(part);
+  }
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__PARALLEL_H__INCLUDED
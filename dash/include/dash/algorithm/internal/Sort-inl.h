@@ -1,13 +1,6 @@
 #ifndef DASH__ALGORITHM__INTERNAL__SORT_H__INCLUDED
 #define DASH__ALGORITHM__INTERNAL__SORT_H__INCLUDED
 
-#define IDX_DIST(nunits) ((nunits)*0)
-#define IDX_SUPP(nunits) ((nunits)*1)
-#define IDX_TARGET_DISP(nunits) ((nunits)*2)
-
-#define IDX_SEND_COUNT(nunits) IDX_DIST(nunits)
-#define IDX_TARGET_COUNT(nunits) IDX_SUPP(nunits)
-
 #define NLT_NLE_BLOCK 2
 
 #include <algorithm>
@@ -277,10 +270,11 @@ inline bool psort__validate_partitions(
   return nonstable_it == p_borders.is_stable.cend();
 }
 
-template <class LocalArrayT>
 inline void psort__calc_final_partition_dist(
     std::vector<size_t> const& acc_partition_count,
-    LocalArrayT&               l_partition_dist)
+    dash::team_unit_t          myid,
+    std::vector<size_t>&       l_partition_dist,
+    std::vector<size_t> const& l_partition_supp)
 {
   /* Calculate number of elements to receive for each partition:
    * We first assume that we we receive exactly the number of elements which
@@ -289,10 +283,9 @@ inline void psort__calc_final_partition_dist(
    */
   DASH_LOG_TRACE("< psort__calc_final_partition_dist");
 
-  auto const myid       = l_partition_dist.pattern().team().myid();
-  auto const nunits     = l_partition_dist.pattern().team().size();
-  auto const supp_begin = l_partition_dist.begin() + IDX_SUPP(nunits);
-  auto       dist_begin = l_partition_dist.begin() + IDX_DIST(nunits);
+  auto const nunits     = l_partition_dist.size();
+  auto const supp_begin = l_partition_supp.begin();
+  auto       dist_begin = l_partition_dist.begin();
 
   auto const n_my_elements = std::accumulate(
       dist_begin, dist_begin + nunits, static_cast<size_t>(0));
@@ -391,69 +384,6 @@ inline void psort__calc_send_count(
   DASH_LOG_TRACE("psort__calc_send_count >");
 }
 
-template <typename ElementType>
-inline void psort__calc_target_displs(
-    PartitionBorder<ElementType> const& p_borders,
-    std::vector<size_t> const&          valid_partitions,
-    dash::Array<size_t>&                g_partition_data)
-{
-  DASH_LOG_TRACE("< psort__calc_target_displs");
-  auto const nunits = g_partition_data.team().size();
-  auto const myid   = g_partition_data.team().myid();
-
-  auto* l_target_displs = &(g_partition_data.local[IDX_TARGET_DISP(nunits)]);
-
-  if (0 == myid) {
-    // Unit 0 always writes to target offset 0
-    std::fill(l_target_displs, l_target_displs + nunits, 0);
-  }
-
-  std::vector<size_t> target_displs(nunits, 0);
-
-  auto const u_blocksize = g_partition_data.lsize();
-
-  // What this algorithm does is basically an exclusive can over all send
-  // counts across all participating units to find the target displacements of
-  // a unit for all partitions. More precisely, each unit has to know the
-  // starting offset in each partition where the elements should be copied to.
-  //
-  // Note: The one-sided approach here is
-  // probably not the most efficient way. Something like dart_exscan should be
-  // more efficient in large scale scenarios
-
-  for (auto const& border_idx : valid_partitions) {
-    auto const   left_u  = p_borders.left_partition[border_idx];
-    auto const   right_u = border_idx + 1;
-    size_t const val =
-        (left_u == myid)
-            ?
-            /* if we are the bounding unit on the left-hand side we can access
-             * the value in local memory */
-            g_partition_data.local[left_u + IDX_SEND_COUNT(nunits)]
-            :
-            /* Otherwise we have to read the send count remotely from the
-             * corresponding offset at the unit's memory */
-            g_partition_data
-                [left_u * u_blocksize + myid + IDX_SEND_COUNT(nunits)];
-    target_displs[right_u] = val + target_displs[left_u];
-
-    if (right_u == myid) {
-      // we are local
-      g_partition_data.local[IDX_TARGET_DISP(nunits) + myid] =
-          target_displs[right_u];
-    }
-    else {
-      auto const target_offset =
-          right_u * u_blocksize + myid + IDX_TARGET_DISP(nunits);
-
-      g_partition_data.async[target_offset].set(&(target_displs[right_u]));
-    }
-  }
-
-  DASH_LOG_TRACE("psort__calc_target_displs >");
-  g_partition_data.async.flush();
-}
-
 template <typename GlobIterT>
 inline UnitInfo psort__find_partition_borders(
     typename GlobIterT::pattern_type const& pattern,
@@ -780,5 +710,546 @@ inline void trace_local_histo(
 #endif
 }
 
+
+/**
+ * Number of threads to use for sorting and merging \c nelem local elements,
+ * derived from the thread capacity of the calling unit's locality domain.
+ */
+inline int psort__num_threads(std::size_t nelem)
+{
+#ifdef DASH_ENABLE_OPENMP
+  if (nelem < __DASH_SORT__PARALLEL_MIN_ELEMENTS) {
+    return 1;
+  }
+  dash::util::UnitLocality uloc;
+  auto const n_threads = uloc.num_domain_threads();
+  DASH_LOG_TRACE("dash::sort", "thread capacity:", n_threads);
+  return std::max(n_threads, 1);
+#else
+  return 1;
+#endif
+}
+
+/**
+ * Order-preserving mapping of arithmetic keys to unsigned integers used
+ * as radix sort digits. Not defined for key types without a suitable
+ * unsigned integer type (e.g. long double).
+ */
+template <std::size_t NBytes>
+struct psort__radix_uint {
+};
+template <>
+struct psort__radix_uint<1> {
+  typedef std::uint8_t type;
+};
+template <>
+struct psort__radix_uint<2> {
+  typedef std::uint16_t type;
+};
+template <>
+struct psort__radix_uint<4> {
+  typedef std::uint32_t type;
+};
+template <>
+struct psort__radix_uint<8> {
+  typedef std::uint64_t type;
+};
+
+template <typename Key, typename = void>
+struct psort__radix_key {
+  static constexpr bool is_radix_sortable = false;
+};
+
+template <typename Key>
+struct psort__radix_key<
+    Key,
+    typename std::enable_if<
+        std::is_arithmetic<Key>::value &&
+        (sizeof(Key) == 1 || sizeof(Key) == 2 || sizeof(Key) == 4 ||
+         sizeof(Key) == 8) &&
+        (std::is_integral<Key>::value ||
+         std::numeric_limits<Key>::is_iec559)>::type> {
+  static constexpr bool is_radix_sortable = true;
+
+  typedef typename psort__radix_uint<sizeof(Key)>::type type;
+
+  static constexpr type sign_bit = type(1) << (sizeof(Key) * 8 - 1);
+
+  static type encode(Key key) noexcept
+  {
+    type bits;
+    std::memcpy(&bits, &key, sizeof(Key));
+    return encode_bits(bits, std::is_floating_point<Key>{},
+                       std::is_signed<Key>{});
+  }
+
+private:
+  static type encode_bits(type bits, std::true_type, std::true_type) noexcept
+  {
+    // negative floating point values in reverse order
+    return (bits & sign_bit) ? type(~bits) : type(bits | sign_bit);
+  }
+  static type encode_bits(type bits, std::false_type, std::true_type) noexcept
+  {
+    return bits ^ sign_bit;
+  }
+  static type encode_bits(type bits, std::false_type, std::false_type) noexcept
+  {
+    return bits;
+  }
+};
+
+/**
+ * Parallel LSD radix sort of the range \c [first, last) by the keys
+ * obtained from \c sortable_hash, using 8 bit digits. Passes in which all
+ * keys have the same digit are skipped.
+ */
+template <typename ValueType, typename SortableHash>
+inline void psort__radix_sort(
+    ValueType*   first,
+    ValueType*   last,
+    SortableHash sortable_hash,
+    int          nthreads)
+{
+  using mapped_type =
+      typename std::decay<typename dash::functional::closure_traits<
+          SortableHash>::result_type>::type;
+  using radix_key = psort__radix_key<mapped_type>;
+  using key_type  = typename radix_key::type;
+
+  constexpr std::size_t nbuckets = 256;
+  constexpr std::size_t npasses  = sizeof(key_type);
+
+  auto const nelem = static_cast<std::size_t>(std::distance(first, last));
+
+  std::vector<ValueType>   buffer(nelem);
+  std::vector<std::size_t> histo(nthreads * nbuckets);
+
+  ValueType* src  = first;
+  ValueType* dst  = buffer.data();
+  bool       skip = false;
+
+  auto const digit = [&sortable_hash](
+                         ValueType const& v, std::size_t shift) {
+    return static_cast<std::size_t>(
+        (radix_key::encode(sortable_hash(v)) >> shift) & (nbuckets - 1));
+  };
+
+#ifdef DASH_ENABLE_OPENMP
+#pragma omp parallel num_threads(nthreads)
+#endif
+  {
+#ifdef DASH_ENABLE_OPENMP
+    auto const tid = static_cast<std::size_t>(omp_get_thread_num());
+    auto const nth = static_cast<std::size_t>(omp_get_num_threads());
+#else
+    std::size_t const tid = 0;
+    std::size_t const nth = 1;
+#endif
+    auto const lo = nelem * tid / nth;
+    auto const hi = nelem * (tid + 1) / nth;
+
+    auto* const t_histo = histo.data() + tid * nbuckets;
+
+    for (std::size_t pass = 0; pass < npasses; ++pass) {
+      auto const shift = pass * 8;
+
+      std::fill(t_histo, t_histo + nbuckets, 0);
+      for (auto i = lo; i < hi; ++i) {
+        ++t_histo[digit(src[i], shift)];
+      }
+#ifdef DASH_ENABLE_OPENMP
+#pragma omp barrier
+#pragma omp single
+#endif
+      {
+        // exclusive prefix sum over buckets, ordered by thread within
+        // every bucket
+        std::size_t offset = 0;
+        skip               = false;
+        for (std::size_t b = 0; b < nbuckets && !skip; ++b) {
+          std::size_t bucket_size = 0;
+          for (std::size_t t = 0; t < nth; ++t) {
+            auto const count           = histo[t * nbuckets + b];
+            histo[t * nbuckets + b]    = offset;
+            offset                    += count;
+            bucket_size               += count;
+          }
+          skip = (bucket_size == nelem);
+        }
+      }
+      if (!skip) {
+        for (auto i = lo; i < hi; ++i) {
+          dst[t_histo[digit(src[i], shift)]++] = std::move(src[i]);
+        }
+      }
+#ifdef DASH_ENABLE_OPENMP
+#pragma omp barrier
+#pragma omp single
+#endif
+      {
+        if (!skip) {
+          std::swap(src, dst);
+        }
+      }
+    }
+
+    if (src != first) {
+      std::move(src + lo, src + hi, first + lo);
+    }
+  }
+}
+
+/**
+ * Merges the sorted sequences \c seqs, given as pairs of pointers, into
+ * \c out using a heap-based k-way merge.
+ */
+template <typename ValueType, typename Compare>
+inline void psort__kway_merge(
+    std::vector<std::pair<ValueType*, ValueType*>>& seqs,
+    ValueType*                                      out,
+    Compare                                         comp)
+{
+  seqs.erase(
+      std::remove_if(
+          seqs.begin(),
+          seqs.end(),
+          [](std::pair<ValueType*, ValueType*> const& seq) {
+            return seq.first == seq.second;
+          }),
+      seqs.end());
+
+  if (seqs.empty()) {
+    return;
+  }
+  if (seqs.size() == 1) {
+    std::move(seqs[0].first, seqs[0].second, out);
+    return;
+  }
+  if (seqs.size() == 2) {
+    std::merge(
+        std::make_move_iterator(seqs[0].first),
+        std::make_move_iterator(seqs[0].second),
+        std::make_move_iterator(seqs[1].first),
+        std::make_move_iterator(seqs[1].second),
+        out,
+        comp);
+    return;
+  }
+
+  // min-heap on the current head element of every sequence
+  auto const heap_comp = [&comp](
+                             std::pair<ValueType*, ValueType*> const& a,
+                             std::pair<ValueType*, ValueType*> const& b) {
+    return comp(*b.first, *a.first);
+  };
+  std::make_heap(seqs.begin(), seqs.end(), heap_comp);
+  while (!seqs.empty()) {
+    std::pop_heap(seqs.begin(), seqs.end(), heap_comp);
+    auto& seq = seqs.back();
+    *out++    = std::move(*seq.first++);
+    if (seq.first == seq.second) {
+      seqs.pop_back();
+    }
+    else {
+      std::push_heap(seqs.begin(), seqs.end(), heap_comp);
+    }
+  }
+}
+
+/**
+ * Merges the consecutive sorted sequences in \c first with boundaries given
+ * by the prefix sum \c seq_psum (number of sequences + 1 offsets) into
+ * \c out, which must not overlap the input.
+ *
+ * The output range is split into \c nthreads parts of balanced size by
+ * sampled splitters, every thread merges the corresponding subsequences
+ * independently.
+ */
+template <typename ValueType, typename Compare>
+inline void psort__merge_sequences(
+    ValueType*                      first,
+    std::vector<std::size_t> const& seq_psum,
+    ValueType*                      out,
+    Compare                         comp,
+    int                             nthreads)
+{
+  DASH_ASSERT(!seq_psum.empty());
+
+  auto const nseq  = seq_psum.size() - 1;
+  auto const nelem = seq_psum.back();
+  auto const nth   = static_cast<std::size_t>(std::max(nthreads, 1));
+
+  if (nseq == 0 || nelem == 0) {
+    return;
+  }
+
+  // split positions of every sequence for every thread, row major
+  std::vector<std::size_t> split((nth + 1) * nseq);
+  for (std::size_t s = 0; s < nseq; ++s) {
+    split[s]             = seq_psum[s];
+    split[nth * nseq + s] = seq_psum[s + 1];
+  }
+
+  if (nth > 1) {
+    // sample elements at a global stride such that every sequence
+    // contributes proportionally to its length
+    constexpr std::size_t samples_per_thread = 64;
+    auto const stride =
+        std::max<std::size_t>(1, nelem / (nth * samples_per_thread));
+    std::vector<ValueType> samples;
+    samples.reserve(nelem / stride + nseq);
+    for (std::size_t s = 0; s < nseq; ++s) {
+      for (auto i = seq_psum[s] + stride / 2; i < seq_psum[s + 1];
+           i += stride) {
+        samples.push_back(first[i]);
+      }
+    }
+    std::sort(samples.begin(), samples.end(), comp);
+
+    for (std::size_t t = 1; t < nth; ++t) {
+      auto* const t_split = split.data() + t * nseq;
+      if (samples.empty()) {
+        std::copy(split.data(), split.data() + nseq, t_split);
+        continue;
+      }
+      auto const& splitter = samples[t * samples.size() / nth];
+      auto const  rank     = nelem * t / nth;
+      // elements less than the splitter are assigned to the left part,
+      // elements equal to the splitter are distributed to meet the
+      // target rank
+      std::size_t nless = 0;
+      std::vector<std::size_t> nequal(nseq);
+      for (std::size_t s = 0; s < nseq; ++s) {
+        auto* const seq_first = first + seq_psum[s];
+        auto* const seq_last  = first + seq_psum[s + 1];
+        auto const  range =
+            std::equal_range(seq_first, seq_last, splitter, comp);
+        t_split[s] = range.first - first;
+        nequal[s]  = range.second - range.first;
+        nless     += range.first - seq_first;
+      }
+      auto nfill = (rank > nless) ? rank - nless : 0;
+      for (std::size_t s = 0; s < nseq && nfill > 0; ++s) {
+        auto const n = std::min(nfill, nequal[s]);
+        t_split[s] += n;
+        nfill      -= n;
+      }
+    }
+  }
+
+  std::vector<std::size_t> out_offset(nth + 1, 0);
+  for (std::size_t t = 1; t <= nth; ++t) {
+    out_offset[t] = 0;
+    for (std::size_t s = 0; s < nseq; ++s) {
+      out_offset[t] += split[t * nseq + s] - seq_psum[s];
+    }
+  }
+
+#ifdef DASH_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nth) schedule(static, 1)
+#endif
+  for (std::size_t t = 0; t < nth; ++t) {
+    std::vector<std::pair<ValueType*, ValueType*>> seqs;
+    seqs.reserve(nseq);
+    for (std::size_t s = 0; s < nseq; ++s) {
+      seqs.emplace_back(
+          first + split[t * nseq + s], first + split[(t + 1) * nseq + s]);
+    }
+    psort__kway_merge(seqs, out + out_offset[t], comp);
+  }
+}
+
+template <typename ValueType, typename SortableHash, typename Compare>
+inline void psort__local_sort_impl(
+    ValueType*   first,
+    ValueType*   last,
+    SortableHash sortable_hash,
+    Compare      /* comp */,
+    int          nthreads,
+    std::true_type /* radix sortable */)
+{
+  psort__radix_sort(first, last, sortable_hash, nthreads);
+}
+
+template <typename ValueType, typename SortableHash, typename Compare>
+inline void psort__local_sort_impl(
+    ValueType* first,
+    ValueType* last,
+    SortableHash /* sortable_hash */,
+    Compare    comp,
+    int        nthreads,
+    std::false_type /* radix sortable */)
+{
+  auto const nelem = static_cast<std::size_t>(std::distance(first, last));
+  auto const nth   = static_cast<std::size_t>(nthreads);
+
+  std::vector<std::size_t> chunk_psum(nth + 1);
+  for (std::size_t t = 0; t <= nth; ++t) {
+    chunk_psum[t] = nelem * t / nth;
+  }
+
+#ifdef DASH_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static, 1)
+#endif
+  for (std::size_t t = 0; t < nth; ++t) {
+    std::sort(first + chunk_psum[t], first + chunk_psum[t + 1], comp);
+  }
+
+  std::vector<ValueType> buffer(nelem);
+  psort__merge_sequences(first, chunk_psum, buffer.data(), comp, nthreads);
+
+#ifdef DASH_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static, 1)
+#endif
+  for (std::size_t t = 0; t < nth; ++t) {
+    std::move(
+        buffer.data() + chunk_psum[t],
+        buffer.data() + chunk_psum[t + 1],
+        first + chunk_psum[t]);
+  }
+}
+
+/**
+ * Sorts the local range \c [first, last) using \c nthreads threads.
+ *
+ * Keys of arithmetic type are sorted by parallel radix sort, other keys by
+ * a parallel merge sort of independently sorted chunks.
+ */
+template <typename ValueType, typename SortableHash, typename Compare>
+inline void psort__local_sort(
+    ValueType*   first,
+    ValueType*   last,
+    SortableHash sortable_hash,
+    Compare      comp,
+    int          nthreads)
+{
+  using mapped_type =
+      typename std::decay<typename dash::functional::closure_traits<
+          SortableHash>::result_type>::type;
+
+  auto const nelem = static_cast<std::size_t>(std::distance(first, last));
+
+  if (nthreads <= 1 || nelem < static_cast<std::size_t>(nthreads) * 2) {
+    std::sort(first, last, comp);
+    return;
+  }
+
+  psort__local_sort_impl(
+      first,
+      last,
+      sortable_hash,
+      comp,
+      nthreads,
+      std::integral_constant<
+          bool,
+          psort__radix_key<mapped_type>::is_radix_sortable>{});
+}
+
+/**
+ * Merges the sequences received from all units into \c buffer while the
+ * transfers are in flight.
+ *
+ * Sequences are merged pairwise along a binary tree over the source units.
+ * A tree node is merged in place as soon as the transfers of all sequences
+ * it covers are completed, tested with \c dart_testall_local on the
+ * transfer handles. If no transfer has completed since the last test, the
+ * next pending transfer is waited for with \c dart_wait_local instead of
+ * polling. The root of the tree is never merged in place.
+ *
+ * Returns the boundaries of the merged sequences in \c buffer once all
+ * transfers are completed.
+ */
+template <typename ValueType, typename Compare>
+inline std::vector<std::size_t> psort__merge_incoming(
+    ValueType*                      buffer,
+    std::vector<std::size_t> const& recv_psum,
+    std::vector<dart_handle_t>&     handles,
+    Compare                         comp)
+{
+  DASH_LOG_TRACE("< psort__merge_incoming");
+
+  auto const nseq = handles.size();
+
+  std::size_t depth = 0;
+  while ((std::size_t(1) << depth) < nseq) {
+    ++depth;
+  }
+
+  // node_merged[d][m]: sequences of source units [m << d, (m + 1) << d)
+  // are merged, level 0 denotes completed transfers
+  std::vector<std::vector<char>> node_merged(std::max<std::size_t>(depth, 1));
+  for (std::size_t d = 0; d < node_merged.size(); ++d) {
+    node_merged[d].assign(((nseq - 1) >> d) + 1, 0);
+  }
+
+  std::size_t narrived = 0;
+  while (true) {
+    std::size_t nnew = 0;
+    for (std::size_t src = 0; src < nseq; ++src) {
+      if (!node_merged[0][src]) {
+        int32_t arrived = 0;
+        DASH_ASSERT_RETURNS(
+            dart_testall_local(&handles[src], 1, &arrived), DART_OK);
+        if (arrived) {
+          node_merged[0][src] = 1;
+          ++nnew;
+        }
+      }
+    }
+    if (nnew == 0) {
+      // nothing to merge, block until the next pending transfer completes
+      auto const src = static_cast<std::size_t>(std::distance(
+          node_merged[0].begin(),
+          std::find(node_merged[0].begin(), node_merged[0].end(), 0)));
+      DASH_ASSERT_RETURNS(dart_wait_local(&handles[src]), DART_OK);
+      node_merged[0][src] = 1;
+      ++nnew;
+    }
+    narrived += nnew;
+    if (narrived == nseq) {
+      break;
+    }
+
+    for (std::size_t d = 1; d < node_merged.size(); ++d) {
+      auto const nchildren = node_merged[d - 1].size();
+      for (std::size_t m = 0; m < node_merged[d].size(); ++m) {
+        auto const left  = 2 * m;
+        auto const right = left + 1;
+        if (node_merged[d][m] || !node_merged[d - 1][left] ||
+            (right < nchildren && !node_merged[d - 1][right])) {
+          continue;
+        }
+        auto const first = m << d;
+        auto const mid   = std::min(first + (std::size_t(1) << (d - 1)), nseq);
+        auto const last  = std::min(first + (std::size_t(1) << d), nseq);
+        std::inplace_merge(
+            buffer + recv_psum[first],
+            buffer + recv_psum[mid],
+            buffer + recv_psum[last],
+            comp);
+        node_merged[d][m] = 1;
+      }
+    }
+  }
+
+  // boundaries of the largest merged sequences
+  std::vector<std::size_t> merged_psum{0};
+  std::size_t              src = 0;
+  while (src < nseq) {
+    std::size_t d = node_merged.size() - 1;
+    while (d > 0 &&
+           ((src & ((std::size_t(1) << d) - 1)) != 0 ||
+            !node_merged[d][src >> d])) {
+      --d;
+    }
+    src = std::min(src + (std::size_t(1) << d), nseq);
+    merged_psum.push_back(recv_psum[src]);
+  }
+
+  DASH_LOG_TRACE("psort__merge_incoming >");
+  return merged_psum;
+}
+
 }  // namespace detail
 #endif
@@ -198,7 +198,9 @@ public:
 
   /**
    * Set the value of the shared atomic variable.
-   * The operation will block until the local memory can be re-used.
+   * The value can be re-used immediately, updates of remote units are
+   * collected in a write-combining buffer, see
+   * \c dart_accumulate_combining.
    */
   void set(const T & value) const
   {
@@ -206,7 +208,7 @@ public:
             "Cannot modify value referenced by GlobAsyncRef<Atomic<const T>>!");
     DASH_LOG_DEBUG_VAR("GlobAsyncRef<Atomic>.set()", value);
     DASH_LOG_TRACE_VAR("GlobAsyncRef<Atomic>.set",   _gptr);
-    dart_ret_t ret = dart_accumulate_blocking_local(
+    dart_ret_t ret = dart_accumulate_combining(
                        _gptr,
                        &value,
                        1,
@@ -312,6 +314,8 @@ public:
 
   /**
    * Atomically executes specified operation on the referenced shared value.
+   * Updates of remote units are collected in a write-combining buffer, see
+   * \c dart_accumulate_combining.
    */
   template<typename BinaryOp>
   void op(
@@ -323,14 +327,14 @@ public:
             "Cannot modify value referenced by GlobAsyncRef<Atomic<const T>>!");
     DASH_LOG_DEBUG_VAR("GlobAsyncRef<Atomic>.op()", value);
     DASH_LOG_TRACE_VAR("GlobAsyncRef<Atomic>.op",   _gptr);
-    DASH_LOG_TRACE("GlobAsyncRef<Atomic>.op", "dart_accumulate");
-    dart_ret_t ret = dart_accumulate_blocking_local(
+    DASH_LOG_TRACE("GlobAsyncRef<Atomic>.op", "dart_accumulate_combining");
+    dart_ret_t ret = dart_accumulate_combining(
                        _gptr,
                        &value,
                        1,
                        dash::dart_punned_datatype<nonconst_value_type>::value,
                        binary_op.dart_operation());
-    DASH_ASSERT_EQ(DART_OK, ret, "dart_accumulate_blocking_local failed");
+    DASH_ASSERT_EQ(DART_OK, ret, "dart_accumulate_combining failed");
   }
 
   /**
@@ -6,7 +6,9 @@
 #include <dash/internal/Logging.h>
 #include <dash/util/FunctionalExpr.h>
 
+#include <algorithm>
 #include <functional>
+#include <limits>
 
 namespace dash {
 
@@ -675,7 +677,12 @@ public:
   using region_extent_t = typename RegionSpec_t::region_extent_t;
 
 public:
-  constexpr HaloSpec(const Specs_t& specs) : _specs(specs) {}
+  HaloSpec(const Specs_t& specs) : _specs(specs) {
+    for(const auto& spec : _specs) {
+      if(spec.extent() > 0)
+        ++_num_regions;
+    }
+  }
 
   template <typename StencilSpecT>
   HaloSpec(const StencilSpecT& stencil_spec) {
@@ -697,7 +704,39 @@ public:
     }
   }
 
-  HaloSpec(const Self_t& other) { _specs = other._specs; }
+  HaloSpec(const Self_t& other)
+  : _specs(other._specs), _num_regions(other._num_regions) {}
+
+  /**
+   * Creates a \ref HaloSpec with halo regions deep enough to apply the
+   * given \ref StencilSpec \c num_steps times between two halo updates
+   * (see \ref StencilOperator::update_steps).
+   *
+   * All halo regions, including the corner regions, get an extent of
+   * \c num_steps times the maximal stencil point distance.
+   */
+  template <typename StencilSpecT>
+  static Self_t for_steps(const StencilSpecT& stencil_spec,
+                          region_extent_t     num_steps) {
+    region_extent_t max_dist = 0;
+    for(const auto& stencil : stencil_spec.specs())
+      max_dist = std::max<region_extent_t>(max_dist, stencil.max());
+
+    DASH_ASSERT_MSG(
+      static_cast<std::size_t>(max_dist) * num_steps
+        <= std::numeric_limits<region_extent_t>::max(),
+      "Halo extent for the given number of steps exceeds the maximal region "
+      "extent");
+
+    Specs_t      specs{};
+    const auto   center_index = RegionCoords_t().index();
+    for(region_index_t index = 0; index < RegionCoords_t::MaxIndex; ++index) {
+      if(index != center_index && max_dist > 0)
+        specs[index] = RegionSpec_t(index, max_dist * num_steps);
+    }
+
+    return Self_t(specs);
+  }
 
   /**
    * Matching \ref RegionSpec for a given region index
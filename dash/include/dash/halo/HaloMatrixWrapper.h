@@ -7,6 +7,9 @@
 #include <dash/Pattern.h>
 #include <dash/halo/StencilOperator.h>
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <type_traits>
 #include <vector>
 
@@ -45,6 +48,27 @@ namespace halo {
  *     halo region 3             '- halo region 7
  */
 
+/**
+ * Communication scheme used by \ref HaloMatrixWrapper to exchange halo
+ * regions.
+ */
+enum class HaloExchange : std::uint8_t {
+  /**
+   * Every unit reads its halo regions from the boundary elements of its
+   * neighbors. Units must be synchronized before an update, so neighbors
+   * do not read boundary elements that are not updated yet, and after
+   * it, so halo regions are read before the boundary elements change.
+   */
+  PULL,
+  /**
+   * Every unit packs its boundary elements into persistent send buffers and
+   * writes them to the halo memory of its neighbors. Completion is signaled
+   * per neighbor with atomic counters, no team synchronization is required
+   * between updates.
+   */
+  PUSH
+};
+
 template <typename MatrixT>
 class HaloMatrixWrapper {
 private:
@@ -72,15 +96,22 @@ private:
   using HaloSpec_t            = HaloSpec<NumDimensions>;
   using Region_t              = Region<Element_t, Pattern_t, typename MatrixT::GlobMem_t>;
 
+  static constexpr auto MaxIndex = RegionCoords<NumDimensions>::MaxIndex;
+
 public:
   /**
-   * Constructor that takes \ref Matrix, a \ref GlobalBoundarySpec and a user
-   * defined number of stencil specifications (\ref StencilSpec)
+   * Constructor that takes \ref Matrix, the \ref HaloExchange scheme, a
+   * \ref GlobalBoundarySpec and a user defined number of stencil
+   * specifications (\ref StencilSpec)
+   *
+   * Collective operation.
    */
   template <typename... StencilSpecT>
-  HaloMatrixWrapper(MatrixT& matrix, const GlobBoundSpec_t& cycle_spec,
+  HaloMatrixWrapper(MatrixT& matrix, HaloExchange exchange,
+                    const GlobBoundSpec_t& cycle_spec,
                     const StencilSpecT&... stencil_spec)
-  : _matrix(matrix), _cycle_spec(cycle_spec), _halo_spec(stencil_spec...),
+  : _matrix(matrix), _exchange(exchange), _cycle_spec(cycle_spec),
+    _halo_spec(stencil_spec...),
     _view_global(matrix.local.offsets(), matrix.local.extents()),
     _haloblock(matrix.begin().globmem(), matrix.pattern(), _view_global,
                _halo_spec, cycle_spec),
@@ -235,8 +266,22 @@ public:
         num_elems_block = region.view().extent(0);
       }
     }
+
+    if(_exchange == HaloExchange::PUSH)
+      init_push();
   }
 
+  /**
+   * Constructor that takes \ref Matrix, a \ref GlobalBoundarySpec and a user
+   * defined number of stencil specifications (\ref StencilSpec).
+   * Halo regions are exchanged with \ref HaloExchange::PULL.
+   */
+  template <typename... StencilSpecT>
+  HaloMatrixWrapper(MatrixT& matrix, const GlobBoundSpec_t& cycle_spec,
+                    const StencilSpecT&... stencil_spec)
+  : HaloMatrixWrapper(matrix, HaloExchange::PULL, cycle_spec,
+                      stencil_spec...) {}
+
   /**
    * Constructor that takes \ref Matrix and a user
    * defined number of stencil specifications (\ref StencilSpec).
@@ -249,6 +294,9 @@ public:
   HaloMatrixWrapper() = delete;
 
   ~HaloMatrixWrapper() {
+    if(_exchange == HaloExchange::PUSH)
+      free_push();
+
     for(auto& dart_type : _dart_types) {
       dart_type_destroy(&dart_type);
     }
@@ -260,21 +308,32 @@ public:
    */
   const HaloBlock_t& halo_block() { return _haloblock; }
 
+  /**
+   * Returns the \ref HaloExchange scheme used to update halo regions
+   */
+  HaloExchange exchange() const { return _exchange; }
+
   /**
    * Initiates a blocking halo region update for all halo elements.
    */
   void update() {
-    for(auto& region : _region_data) {
-      update_halo_intern(region.second);
-    }
+    update_async();
     wait();
   }
 
   /**
    * Initiates a blocking halo region update for all halo elements within the
    * the given region.
+   *
+   * With \ref HaloExchange::PUSH, all halo regions are exchanged and only
+   * the given region is waited for.
    */
   void update_at(region_index_t index) {
+    if(_exchange == HaloExchange::PUSH) {
+      update_async();
+      wait(index);
+      return;
+    }
     auto it_find = _region_data.find(index);
     if(it_find != _region_data.end()) {
       update_halo_intern(it_find->second);
@@ -286,6 +345,10 @@ public:
    * Initiates an asychronous halo region update for all halo elements.
    */
   void update_async() {
+    if(_exchange == HaloExchange::PUSH) {
+      update_push_async();
+      return;
+    }
     for(auto& region : _region_data) {
       update_halo_intern(region.second);
     }
@@ -294,8 +357,14 @@ public:
   /**
    * Initiates an asychronous halo region update for all halo elements within
    * the given region.
+   *
+   * With \ref HaloExchange::PUSH, all halo regions are exchanged.
    */
   void update_async_at(region_index_t index) {
+    if(_exchange == HaloExchange::PUSH) {
+      update_push_async();
+      return;
+    }
     auto it_find = _region_data.find(index);
     if(it_find != _region_data.end()) {
       update_halo_intern(it_find->second);
@@ -305,8 +374,18 @@ public:
   /**
    * Waits until all halo updates are finished. Only useful for asynchronous
    * halo updates.
+   *
+   * With \ref HaloExchange::PUSH, also waits until the boundary regions are
+   * written to all neighbors, as neighbors only receiving from this unit
+   * depend on it.
    */
   void wait() {
+    if(_exchange == HaloExchange::PUSH) {
+      for(const auto& recv : _push_recv_data)
+        wait_push(recv.index);
+      progress_push(true);
+      return;
+    }
     for(auto& region : _region_data) {
       dart_wait_local(&region.second.handle);
     }
@@ -315,8 +394,16 @@ public:
   /**
    * Waits until the halo updates for the given halo region is finished.
    * Only useful for asynchronous halo updates.
+   *
+   * With \ref HaloExchange::PUSH, also waits until the boundary regions are
+   * written to all neighbors.
    */
   void wait(region_index_t index) {
+    if(_exchange == HaloExchange::PUSH) {
+      wait_push(index);
+      progress_push(true);
+      return;
+    }
     auto it_find = _region_data.find(index);
     if(it_find != _region_data.end())
       dart_wait_local(&it_find->second.handle);
@@ -460,6 +547,293 @@ private:
     data.get_halos(data.handle);
   }
 
+  struct PushSendData {
+    // unit receiving the boundary elements
+    dart_team_unit_t       dest;
+    // index of the halo region at the receiving unit
+    region_index_t         index;
+    // offset of the halo region in the halo memory of the receiving unit
+    pattern_size_t         halo_offset;
+    // local view of the boundary elements
+    ViewSpec_t             view;
+    // persistent send buffer
+    std::vector<Element_t> buffer;
+    // whether the packed buffer is not sent yet
+    bool                   pending;
+    // halo update the buffer was packed in
+    std::int64_t           epoch;
+  };
+
+  struct PushRecvData {
+    // index of the halo region
+    region_index_t   index;
+    // unit sending the halo region
+    dart_team_unit_t source;
+  };
+
+  // Number of int64 values describing a requested halo region: requesting
+  // unit, halo memory offset, region offsets and extents
+  static constexpr int PushRequestSize = 2 + 2 * NumDimensions;
+
+  /**
+   * Registers the halo memory in global memory and informs the units owning
+   * the elements of halo regions which elements they have to send.
+   *
+   * Collective operation.
+   */
+  void init_push() {
+    auto  team_id = _matrix.team().dart_id();
+    auto  myid    = _matrix.team().myid();
+    auto* halo_lbegin =
+      _halomemory.buffer().empty() ? nullptr : &*_halomemory.begin();
+    dart_storage<Element_t> ds_halo(_halomemory.buffer().size());
+    DASH_ASSERT_RETURNS(
+      dart_team_memregister(team_id, ds_halo.nelem, ds_halo.dtype,
+                            halo_lbegin, &_halo_gptr),
+      DART_OK);
+
+    DASH_ASSERT_RETURNS(
+      dart_team_memalloc_aligned(team_id, 2 * MaxIndex, DART_TYPE_LONGLONG,
+                                 &_signal_gptr),
+      DART_OK);
+    std::int64_t* signals = local_signal_addr(0);
+    std::fill(signals, signals + 2 * MaxIndex, 0);
+
+    // Every unit owns a slot per region index for requests of halo regions.
+    // The requesting unit is unique for every slot as the unit sending a
+    // halo region is located in the same direction for all units.
+    dart_gptr_t request_gptr;
+    DASH_ASSERT_RETURNS(
+      dart_team_memalloc_aligned(team_id, MaxIndex * PushRequestSize,
+                                 DART_TYPE_LONGLONG, &request_gptr),
+      DART_OK);
+    std::int64_t* requests = nullptr;
+    dart_gptr_t   request_lgptr = request_gptr;
+    DASH_ASSERT_RETURNS(dart_gptr_setunit(&request_lgptr, myid), DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_gptr_getaddr(request_lgptr, reinterpret_cast<void**>(&requests)),
+      DART_OK);
+    std::fill(requests, requests + MaxIndex * PushRequestSize, 0);
+    _matrix.team().barrier();
+
+    auto halo_begin = _halomemory.begin();
+    for(const auto& region : _haloblock.halo_regions()) {
+      if(region.size() == 0 || region.is_custom_region())
+        continue;
+
+      auto source = DART_TEAM_UNIT_ID(region.begin().dart_gptr().unitid);
+      _push_recv_data.push_back(PushRecvData{ region.index(), source });
+
+      std::array<std::int64_t, PushRequestSize> request;
+      request[0] = myid.id + 1;
+      request[1] = _halomemory.first_element_at(region.index()) - halo_begin;
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        request[2 + d]                 = region.view().offset(d);
+        request[2 + NumDimensions + d] = region.view().extent(d);
+      }
+      dart_gptr_t gptr = request_gptr;
+      DASH_ASSERT_RETURNS(dart_gptr_setunit(&gptr, source), DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_gptr_incaddr(&gptr, region.index() * PushRequestSize
+                                   * sizeof(std::int64_t)),
+        DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_put_blocking(gptr, request.data(), PushRequestSize,
+                          DART_TYPE_LONGLONG, DART_TYPE_LONGLONG),
+        DART_OK);
+    }
+    _matrix.team().barrier();
+
+    for(region_index_t index = 0; index < MaxIndex; ++index) {
+      const auto* request = requests + index * PushRequestSize;
+      if(request[0] == 0)
+        continue;
+
+      ElementCoords_t offsets;
+      std::array<pattern_size_t, NumDimensions> extents;
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        offsets[d] = request[2 + d] - _view_global.offset(d);
+        extents[d] = request[2 + NumDimensions + d];
+      }
+      ViewSpec_t view(offsets, extents);
+      auto       view_size = view.size();
+      _push_send_data.push_back(PushSendData{
+        DART_TEAM_UNIT_ID(request[0] - 1), index,
+        static_cast<pattern_size_t>(request[1]), std::move(view),
+        std::vector<Element_t>(view_size), false, 0 });
+    }
+    _matrix.team().barrier();
+    DASH_ASSERT_RETURNS(dart_team_memfree(request_gptr), DART_OK);
+  }
+
+  /**
+   * Completes all pending sends and releases the global memory used for
+   * push mode halo updates.
+   *
+   * Collective operation.
+   */
+  void free_push() {
+    progress_push(true);
+    _matrix.team().barrier();
+    dart_team_memfree(_signal_gptr);
+    dart_team_memderegister(_halo_gptr);
+  }
+
+  /**
+   * Signals the sending neighbors that the halo memory can be overwritten,
+   * packs the boundary elements into the send buffers and writes them to
+   * all neighbors that are ready to receive them.
+   */
+  void update_push_async() {
+    ++_push_epoch;
+
+    // Halo regions of the previous update are no longer in use:
+    const std::int64_t one = 1;
+    for(const auto& recv : _push_recv_data) {
+      DASH_ASSERT_RETURNS(
+        dart_accumulate(signal_gptr(recv.source, recv.index), &one, 1,
+                        DART_TYPE_LONGLONG, DART_OP_SUM),
+        DART_OK);
+    }
+    for(const auto& recv : _push_recv_data) {
+      DASH_ASSERT_RETURNS(
+        dart_flush(signal_gptr(recv.source, recv.index)), DART_OK);
+    }
+
+    // Send buffers must not be overwritten before the previous update is
+    // delivered:
+    progress_push(true);
+    for(auto& send : _push_send_data) {
+      pack(send);
+      send.pending = true;
+    }
+    progress_push(false);
+  }
+
+  /**
+   * Writes pending send buffers to all neighbors that are ready to receive
+   * them, until all buffers are written if \c blocking is set.
+   */
+  void progress_push(bool blocking) {
+    bool pending = true;
+    while(pending) {
+      pending = false;
+      for(auto& send : _push_send_data) {
+        if(!send.pending)
+          continue;
+        if(read_signal(send.index) < send.epoch) {
+          pending = true;
+          continue;
+        }
+        dart_gptr_t gptr = _halo_gptr;
+        DASH_ASSERT_RETURNS(dart_gptr_setunit(&gptr, send.dest), DART_OK);
+        DASH_ASSERT_RETURNS(
+          dart_gptr_incaddr(&gptr, send.halo_offset * sizeof(Element_t)),
+          DART_OK);
+        dart_storage<Element_t> ds(send.buffer.size());
+        DASH_ASSERT_RETURNS(
+          dart_put(gptr, send.buffer.data(), ds.nelem, ds.dtype, ds.dtype),
+          DART_OK);
+        DASH_ASSERT_RETURNS(dart_flush(gptr), DART_OK);
+        // Notify the receiving unit after the halo region is written:
+        const std::int64_t one = 1;
+        auto signal = signal_gptr(send.dest, MaxIndex + send.index);
+        DASH_ASSERT_RETURNS(
+          dart_accumulate(signal, &one, 1, DART_TYPE_LONGLONG, DART_OP_SUM),
+          DART_OK);
+        DASH_ASSERT_RETURNS(dart_flush(signal), DART_OK);
+        send.pending = false;
+      }
+      if(!blocking)
+        return;
+    }
+  }
+
+  /**
+   * Waits until the halo region with the given index is received, sends
+   * pending boundary regions in the meantime.
+   */
+  void wait_push(region_index_t index) {
+    auto it_find = std::find_if(
+      _push_recv_data.begin(), _push_recv_data.end(),
+      [index](const PushRecvData& recv) { return recv.index == index; });
+    if(it_find == _push_recv_data.end())
+      return;
+
+    while(read_signal(MaxIndex + index) < _push_epoch)
+      progress_push(false);
+  }
+
+  /**
+   * Packs the boundary elements of a send buffer in the memory order of the
+   * halo region for the current halo update.
+   */
+  void pack(PushSendData& send) {
+    send.epoch = _push_epoch;
+
+    constexpr dim_t fastest_dim =
+      (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 : 0;
+
+    std::array<pattern_size_t, NumDimensions> dim_offs;
+    if(MemoryArrange == ROW_MAJOR) {
+      dim_offs[NumDimensions - 1] = 1;
+      for(dim_t d = NumDimensions - 1; d > 0; --d)
+        dim_offs[d - 1] = dim_offs[d] * _view_local.extent(d);
+    } else {
+      dim_offs[0] = 1;
+      for(dim_t d = 1; d < NumDimensions; ++d)
+        dim_offs[d] = dim_offs[d - 1] * _view_local.extent(d - 1);
+    }
+
+    const auto& view     = send.view;
+    const auto* lbegin   = _matrix.lbegin();
+    auto        row_size = view.extent(fastest_dim);
+    auto        num_rows = (row_size > 0) ? view.size() / row_size : 0;
+    auto*       out      = send.buffer.data();
+    for(pattern_size_t row = 0; row < num_rows; ++row) {
+      pattern_size_t offset = view.offset(fastest_dim) * dim_offs[fastest_dim];
+      pattern_size_t r      = row;
+      for(dim_t i = 1; i < NumDimensions; ++i) {
+        dim_t d = (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 - i : i;
+        offset += (view.offset(d) + r % view.extent(d)) * dim_offs[d];
+        r      /= view.extent(d);
+      }
+      out = std::copy(lbegin + offset, lbegin + offset + row_size, out);
+    }
+  }
+
+  dart_gptr_t signal_gptr(dart_team_unit_t unit, region_index_t slot) const {
+    dart_gptr_t gptr = _signal_gptr;
+    DASH_ASSERT_RETURNS(dart_gptr_setunit(&gptr, unit), DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_gptr_incaddr(&gptr, slot * sizeof(std::int64_t)), DART_OK);
+    return gptr;
+  }
+
+  std::int64_t* local_signal_addr(region_index_t slot) const {
+    std::int64_t* addr = nullptr;
+    DASH_ASSERT_RETURNS(
+      dart_gptr_getaddr(signal_gptr(_matrix.team().myid(), slot),
+                        reinterpret_cast<void**>(&addr)),
+      DART_OK);
+    return addr;
+  }
+
+  /**
+   * Atomically reads a local signal counter.
+   */
+  std::int64_t read_signal(region_index_t slot) const {
+    std::int64_t value  = 0;
+    std::int64_t result = 0;
+    auto         gptr   = signal_gptr(_matrix.team().myid(), slot);
+    DASH_ASSERT_RETURNS(
+      dart_fetch_and_op(gptr, &value, &result, DART_TYPE_LONGLONG,
+                        DART_OP_NO_OP),
+      DART_OK);
+    DASH_ASSERT_RETURNS(dart_flush(gptr), DART_OK);
+    return result;
+  }
+
   Element_t* halo_element_at(ElementCoords_t& coords) {
     auto        index     = _haloblock.index_at(_view_local, coords);
     const auto& spec      = _halo_spec.spec(index);
@@ -475,6 +849,7 @@ private:
 
 private:
   MatrixT&                       _matrix;
+  const HaloExchange             _exchange;
   const GlobBoundSpec_t          _cycle_spec;
   const HaloSpec_t               _halo_spec;
   const ViewSpec_t               _view_global;
@@ -483,6 +858,19 @@ private:
   HaloMemory_t                   _halomemory;
   std::map<region_index_t, Data> _region_data;
   std::vector<dart_datatype_t>   _dart_types;
+
+  // Push mode: boundary regions sent to neighbors
+  std::vector<PushSendData>      _push_send_data;
+  // Push mode: halo regions received from neighbors
+  std::vector<PushRecvData>      _push_recv_data;
+  // Push mode: global pointer to the halo memory of all units
+  dart_gptr_t                    _halo_gptr   = DART_GPTR_NULL;
+  // Push mode: signal counters of all units, MaxIndex counters of send
+  // buffers ready to be written followed by MaxIndex counters of halo
+  // regions received
+  dart_gptr_t                    _signal_gptr = DART_GPTR_NULL;
+  // Push mode: number of halo updates initiated
+  std::int64_t                   _push_epoch  = 0;
 };
 
 }  // namespace halo
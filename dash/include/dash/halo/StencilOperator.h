@@ -3,6 +3,16 @@
 
 #include <dash/halo/iterator/StencilIterator.h>
 
+#include <dash/util/UnitLocality.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
 namespace dash {
 
 namespace halo {
@@ -32,6 +42,7 @@ private:
 
   using StencilOperator_t = StencilOperator<ElementT, PatternT, GlobMemT, StencilSpecT>;
   using pattern_size_t    = typename StencilOperator_t::pattern_size_t;
+  using pattern_index_t   = typename StencilOperator_t::pattern_index_t;
 
 public:
   using ViewSpec_t      = typename StencilOperator_t::ViewSpec_t;
@@ -147,103 +158,78 @@ public:
   */
   template <typename Op>
   void update(iterator begin, iterator end, ElementT* begin_dst, Op operation) {
+    if(begin == end)
+      return;
     if(end == this->end())
       end -= 1;
 
-    auto& begin_coords = begin.coords();
-    auto& end_coords   = end.coords();
-
-    auto center  = _stencil_op->_local_memory;
-    auto offsets = _stencil_op->set_dimension_offsets();
-    auto offset  = 0;
-    for(dim_t d = 0; d < NumDimensions; ++d) {
-      offset += offsets[d] * begin_coords[d];
-    }
-    center += offset;
-    auto center_dst = begin_dst + offset;
-
-    // specialization for 2-D
-    if(NumDimensions == 2) {
-      for(int i = begin_coords[0]; i <= end_coords[0]; ++i,
-              center += offsets[0], center_dst += offsets[0],
-              offset += offsets[0]) {
-        auto center_i     = center;
-        auto center_dst_i = center_dst;
-        auto offset_i     = offset;
-        for(int j = begin_coords[1]; j <= end_coords[1];
-            ++j, ++center_i, ++center_dst_i, ++offset_i) {
-          operation(center_i, center_dst_i, offset_i,
-                    _stencil_op->_stencil_offsets);
+    auto* local_memory = _stencil_op->_local_memory;
+    const auto& stencil_offs = _stencil_op->_stencil_offsets;
+    _stencil_op->for_each_row(
+      begin.coords(), end.coords(),
+      [&](pattern_index_t offset, pattern_size_t row_size) {
+        auto center     = local_memory + offset;
+        auto center_dst = begin_dst + offset;
+        for(pattern_size_t i = 0; i < row_size;
+            ++i, ++center, ++center_dst, ++offset) {
+          operation(center, center_dst, offset, stencil_offs);
         }
-      }
-      return;
-    }
+      });
+  }
 
-    // specialization for 3-D
-    if(NumDimensions == 3) {
-      for(int i = begin_coords[0]; i <= end_coords[0]; ++i,
-              center += offsets[0], center_dst += offsets[0],
-              offset += offsets[0]) {
-        auto center_i     = center;
-        auto center_dst_i = center_dst;
-        auto offset_i     = offset;
-        for(int j = begin_coords[1]; j <= end_coords[1]; ++j,
-                center_i += offsets[1], center_dst_i += offsets[1],
-                offset_i += offsets[1]) {
-          auto center_j     = center_i;
-          auto center_dst_j = center_dst_i;
-          auto offset_j     = offset_i;
-          for(int k = begin_coords[2]; k <= end_coords[2];
-              ++k, ++center_j, ++center_dst_j, ++offset_j) {
-            operation(center_j, center_dst_j, offset_j,
-                      _stencil_op->_stencil_offsets);
-          }
-        }
-      }
+  /**
+   * Updates all inner elements row by row using a user-defined stencil
+   * operation.
+   *
+   * The operation is called for every contiguous row of inner elements in
+   * the fastest dimension with the signature
+   *
+   *     operation(center, center_dst, offset, row_size, stencil_offsets)
+   *
+   * where \c center and \c center_dst point to the first element of the row
+   * in the local and destination memory. Stencil point \c s of the i-th
+   * element in the row is located at <tt>center[i + stencil_offsets[s]]</tt>,
+   * so the loop over the row can be vectorized by the compiler.
+   *
+   * \param begin_dst Pointer to the beginning of the destination memory
+   * \param operation User-definied operation for updating rows of inner
+   *                  elements
+   */
+  template <typename RowOp>
+  void update_rows(ElementT* begin_dst, RowOp operation) {
+    update_rows(begin(), end(), begin_dst, operation);
+  }
 
+  /**
+   * Updates all inner elements within a user defined range row by row using
+   * a user-defined stencil operation.
+   *
+   * \see update_rows(ElementT*, RowOp)
+   *
+   * \param begin Iterator of the beginnning inner data element
+   * \param end Iterator of the last inner data element
+   * \param begin_dst Pointer to the beginning of the destination memory
+   * \param operation User-definied operation for updating rows of inner
+   *                  elements
+   */
+  template <typename RowOp>
+  void update_rows(iterator begin, iterator end, ElementT* begin_dst,
+                   RowOp operation) {
+    if(begin == end)
       return;
-    }
+    if(end == this->end())
+      end -= 1;
 
-    // dimensions above 3-D
-    for(int i = begin_coords[0]; i <= end_coords[0]; ++i, center += offsets[0],
-            center_dst += offsets[0], offset += offsets[0]) {
-      Loop<1, Op>()(_stencil_op->_stencil_offsets, offsets, begin_coords,
-                    end_coords, center, center_dst, offset, operation);
-    }
+    auto* local_memory = _stencil_op->_local_memory;
+    const auto& stencil_offs = _stencil_op->_stencil_offsets;
+    _stencil_op->for_each_row(
+      begin.coords(), end.coords(),
+      [&](pattern_index_t offset, pattern_size_t row_size) {
+        operation(local_memory + offset, begin_dst + offset, offset,
+                  row_size, stencil_offs);
+      });
   }
 
-private:
-  template <dim_t dim, typename Op>
-  struct Loop {
-    template <typename OffsetT>
-    constexpr void operator()(const StencilOffsets_t& stencil_offs,
-                              const StencilOffsets_t& dim_offs,
-                              const ElementCoords_t&  begin,
-                              const ElementCoords_t& end, ElementT* center,
-                              ElementT* center_dst, OffsetT offset, Op op) {
-      for(int i = begin[dim]; i <= end[dim]; ++i, center += dim_offs[dim],
-              center_dst += dim_offs[dim], offset += dim_offs[dim]) {
-        Loop<dim + 1, Op>()(stencil_offs, dim_offs, begin, end, center,
-                            center_dst, offset, op);
-      }
-    }
-  };
-
-  template <typename Op>
-  struct Loop<NumDimensions - 1, Op> {
-    template <typename OffsetT>
-    constexpr void operator()(const StencilOffsets_t& stencil_offs,
-                              const StencilOffsets_t& dim_offs,
-                              const ElementCoords_t&  begin,
-                              const ElementCoords_t& end, ElementT* center,
-                              ElementT* center_dst, OffsetT offset, Op op) {
-      for(int i = begin[NumDimensions - 1]; i <= end[NumDimensions - 1];
-          ++i, ++center, ++center_dst, ++offset) {
-        op(center, center_dst, offset, stencil_offs);
-      }
-    }
-  };
-
 private:
   StencilOperator_t* _stencil_op;
 };
@@ -448,6 +434,25 @@ public:
   template <typename Op>
   void update(const iterator& begin, const iterator& end, ElementT* begin_out,
               Op operation) {
+#ifdef DASH_ENABLE_OPENMP
+    auto num_threads = _stencil_op->_num_threads;
+    auto num_elems   = end.rpos() - begin.rpos();
+    if(num_threads > 1 && num_elems > 1 && !omp_in_parallel()) {
+      // Every thread iterates its own contiguous range of boundary elements:
+      #pragma omp parallel num_threads(num_threads)
+      {
+        auto t_id     = omp_get_thread_num();
+        auto t_num    = omp_get_num_threads();
+        auto t_first  = num_elems * t_id / t_num;
+        auto t_last   = num_elems * (t_id + 1) / t_num;
+        auto it_t_end = begin + t_last;
+        for(auto it = begin + t_first; it != it_t_end; ++it) {
+          begin_out[it.lpos()] = operation(it);
+        }
+      }
+      return;
+    }
+#endif
     for(auto it = begin; it != end; ++it) {
       begin_out[it.lpos()] = operation(it);
     }
@@ -602,6 +607,10 @@ public:
           _spec_views.boundary_views(),
           _spec_views.boundary_size())
   {
+#ifdef DASH_ENABLE_OPENMP
+    dash::util::UnitLocality uloc;
+    _num_threads = uloc.num_domain_threads();
+#endif
   }
 
   /**
@@ -689,7 +698,374 @@ public:
     return offset;
   }
 
+  /**
+   * Updates all inner and boundary elements while the halo regions of the
+   * given halo wrapper are exchanged.
+   *
+   * Initiates an asynchronous halo update, updates all inner elements (see
+   * \ref StencilOperatorInner::update) and then updates the boundary
+   * elements region by region (see \ref StencilOperatorBoundary::update).
+   * Before a boundary region is updated, only the halo regions accessed by
+   * stencil points of its elements are waited for, so boundary regions are
+   * processed while the remaining halo regions are still in transfer.
+   *
+   * \param halo halo wrapper (e.g. \ref HaloMatrixWrapper) providing
+   *             \c update_async(), \c wait(region_index) and \c wait()
+   * \param begin_dst Pointer to the beginning of the destination memory
+   * \param inner_op operation for inner elements
+   * \param boundary_op operation for boundary elements
+   */
+  template <typename HaloT, typename InnerOp, typename BoundaryOp>
+  void update(HaloT& halo, ElementT* begin_dst, InnerOp inner_op,
+              BoundaryOp boundary_op) {
+    halo.update_async();
+
+    inner.update(begin_dst, inner_op);
+
+    pattern_index_t bnd_offset = 0;
+    for(const auto& bnd_view : _spec_views.boundary_views()) {
+      if(bnd_view.size() == 0)
+        continue;
+
+      for(auto index : halo_regions_at(bnd_view))
+        halo.wait(index);
+
+      boundary.update(_bbegin + bnd_offset,
+                      _bbegin + (bnd_offset + bnd_view.size()),
+                      begin_dst, boundary_op);
+      bnd_offset += bnd_view.size();
+    }
+
+    halo.wait();
+  }
+
+  /**
+   * Updates the halo regions of the given halo wrapper once and then applies
+   * the stencil operation \c num_steps times (temporal blocking).
+   *
+   * The halo regions have to be at least \c num_steps times as deep as the
+   * stencil (see \ref HaloSpec::for_steps). The local block and its halo
+   * regions are copied to a local workspace, where every sweep updates a
+   * region that shrinks by the stencil distance per step, so that after
+   * \c num_steps sweeps all inner and boundary elements are valid. Only
+   * these are written to \c begin_dst. It may point to the local memory of
+   * the matrix if neighbors do not read boundary elements concurrently, e.g.
+   * with \ref HaloExchange::PUSH. Elements which are not updated by the
+   * stencil operator, like global boundary elements without halo regions or
+   * custom halo elements, keep their values in all sweeps.
+   *
+   * The operation is called for every contiguous row of elements in the
+   * fastest dimension of a sweep with the signature
+   *
+   *     operation(center, center_dst, row_size, stencil_offsets)
+   *
+   * where \c center and \c center_dst point to the first element of the
+   * row in the source and destination workspace. Stencil point \c s of the
+   * i-th element in the row is located at
+   * <tt>center[i + stencil_offsets[s]]</tt>.
+   *
+   * With a \c tile_extent greater than 0, all sweeps are applied tile by
+   * tile along the slowest dimension in a wavefront, with tiles of
+   * \c tile_extent elements shifted by the stencil distance per step. Tiles
+   * should be small enough for the rows of all steps in a tile to stay in
+   * cache.
+   *
+   * \param halo halo wrapper (e.g. \ref HaloMatrixWrapper) providing
+   *             \c update()
+   * \param begin_dst Pointer to the beginning of the destination memory
+   * \param num_steps number of stencil sweeps per halo update
+   * \param operation operation for rows of elements
+   * \param tile_extent number of elements in the slowest dimension per
+   *                    wavefront tile, 0 to apply every sweep to the whole
+   *                    block at once
+   */
+  template <typename HaloT, typename RowOp>
+  void update_steps(HaloT& halo, ElementT* begin_dst, std::size_t num_steps,
+                    RowOp operation, pattern_size_t tile_extent = 0) {
+    using RegionCoords_t = RegionCoords<NumDimensions>;
+    using Extents_t      = std::array<pattern_size_t, NumDimensions>;
+
+    if(num_steps == 0)
+      return;
+
+    halo.update();
+
+    const auto& view_upd = view();
+    if(view_upd.size() == 0)
+      return;
+
+    constexpr dim_t slowest_dim =
+      (MemoryArrange == ROW_MAJOR) ? 0 : NumDimensions - 1;
+    const auto minmax_dist = _stencil_spec.minmax_distances();
+    const auto  steps       = static_cast<pattern_index_t>(num_steps);
+
+    // Per dimension: stencil distances, workspace margins and whether the
+    // swept region may grow into the halo region (neighbor data).
+    ElementCoords_t dist_pre, dist_post, margin_pre, margin_post;
+    std::array<bool, NumDimensions> grow_pre, grow_post;
+    Extents_t ws_extents;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      dist_pre[d]    = -minmax_dist[d].first;
+      dist_post[d]   = minmax_dist[d].second;
+      margin_pre[d]  = steps * dist_pre[d];
+      margin_post[d] = steps * dist_post[d];
+      ws_extents[d]  = _view_local->extent(d) + margin_pre[d] + margin_post[d];
+
+      auto* region_pre =
+        _halo_block->halo_region(RegionCoords_t::index(d, RegionPos::PRE));
+      auto* region_post =
+        _halo_block->halo_region(RegionCoords_t::index(d, RegionPos::POST));
+      grow_pre[d]  = region_pre != nullptr && region_pre->size() > 0
+                     && !region_pre->is_custom_region();
+      grow_post[d] = region_post != nullptr && region_post->size() > 0
+                     && !region_post->is_custom_region();
+    }
+
+    const auto ws_offs    = dimension_offsets(ws_extents);
+    const auto local_offs = set_dimension_offsets();
+    StencilOffsets_t ws_stencil_offs;
+    for(auto i = 0; i < NumStencilPoints; ++i) {
+      ws_stencil_offs[i] = 0;
+      for(dim_t d = 0; d < NumDimensions; ++d)
+        ws_stencil_offs[i] += _stencil_spec[i][d] * ws_offs[d];
+    }
+
+    auto ws_size = ws_offs[slowest_dim] * ws_extents[slowest_dim];
+    for(auto& buffer : _step_buffers)
+      buffer.resize(ws_size);
+    auto* ws_first = _step_buffers[0].data();
+
+    auto ws_offset = [&](const ElementCoords_t& coords) {
+      pattern_index_t offset = 0;
+      for(dim_t d = 0; d < NumDimensions; ++d)
+        offset += (coords[d] + margin_pre[d]) * ws_offs[d];
+      return offset;
+    };
+
+    // Local block:
+    for_each_box_row(
+      _view_local->extents(), [&](const ElementCoords_t& coords,
+                                  pattern_size_t row_size) {
+        pattern_index_t local_offset = 0;
+        for(dim_t d = 0; d < NumDimensions; ++d)
+          local_offset += coords[d] * local_offs[d];
+        std::copy(_local_memory + local_offset,
+                  _local_memory + local_offset + row_size,
+                  ws_first + ws_offset(coords));
+      });
+
+    // Halo regions within the workspace margins:
+    for(const auto& region : _halo_block->halo_regions()) {
+      if(region.size() == 0)
+        continue;
+
+      const auto& reg_extents = region.view().extents();
+      const auto  reg_coords  = RegionCoords_t::coords(region.index());
+      const auto  reg_offs    = dimension_offsets(reg_extents);
+      ElementCoords_t first_local, first_reg;
+      Extents_t       copy_extents;
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        pattern_index_t reg_ext = reg_extents[d];
+        if(reg_coords[d] == 1) {
+          first_local[d]  = 0;
+          first_reg[d]    = 0;
+          copy_extents[d] = reg_ext;
+          continue;
+        }
+        DASH_ASSERT_MSG(
+          region.is_custom_region()
+            || reg_ext >= (reg_coords[d] == 0 ? margin_pre[d]
+                                              : margin_post[d]),
+          "Halo region extent too small for the given number of steps");
+        if(reg_coords[d] == 0) {
+          copy_extents[d] = std::min(reg_ext, margin_pre[d]);
+          first_local[d]  = -static_cast<pattern_index_t>(copy_extents[d]);
+          first_reg[d]    = reg_ext - copy_extents[d];
+        } else {
+          copy_extents[d] = std::min(reg_ext, margin_post[d]);
+          first_local[d]  = _view_local->extent(d);
+          first_reg[d]    = 0;
+        }
+      }
+
+      const auto* reg_memory =
+        &*(_halo_memory->first_element_at(region.index()));
+      for_each_box_row(
+        copy_extents, [&](ElementCoords_t coords, pattern_size_t row_size) {
+          pattern_index_t reg_offset = 0;
+          for(dim_t d = 0; d < NumDimensions; ++d) {
+            reg_offset += (first_reg[d] + coords[d]) * reg_offs[d];
+            coords[d] += first_local[d];
+          }
+          std::copy(reg_memory + reg_offset,
+                    reg_memory + reg_offset + row_size,
+                    ws_first + ws_offset(coords));
+        });
+    }
+    std::copy(_step_buffers[0].begin(), _step_buffers[0].end(),
+              _step_buffers[1].begin());
+
+    // Swept region of a step in workspace coordinates, inclusive bounds:
+    auto swept_region = [&](pattern_index_t step, ElementCoords_t& first,
+                            ElementCoords_t& last) {
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        first[d] = margin_pre[d] + view_upd.offset(d)
+                   - (grow_pre[d] ? (steps - step) * dist_pre[d] : 0);
+        last[d]  = margin_pre[d] + view_upd.offset(d)
+                   + static_cast<pattern_index_t>(view_upd.extent(d)) - 1
+                   + (grow_post[d] ? (steps - step) * dist_post[d] : 0);
+      }
+    };
+
+    // Tiles are shifted by the stencil distance per step, so a tile only
+    // reads rows of the previous step which are already updated and only
+    // overwrites rows no longer read by the following tiles.
+    const pattern_index_t shift =
+      std::max(dist_pre[slowest_dim], dist_post[slowest_dim]);
+    ElementCoords_t first_1, last_1, first_n, last_n;
+    swept_region(1, first_1, last_1);
+    swept_region(steps, first_n, last_n);
+    const pattern_index_t tile_end = last_n[slowest_dim] + 1
+                                     + (steps - 1) * shift;
+    const pattern_index_t tile_size =
+      (tile_extent > 0) ? static_cast<pattern_index_t>(tile_extent)
+                        : tile_end - first_1[slowest_dim];
+
+    for(pattern_index_t tile = first_1[slowest_dim]; tile < tile_end;
+        tile += tile_size) {
+      for(pattern_index_t step = 1; step <= steps; ++step) {
+        ElementCoords_t first, last;
+        swept_region(step, first, last);
+        first[slowest_dim] =
+          std::max(first[slowest_dim], tile - (step - 1) * shift);
+        last[slowest_dim] =
+          std::min(last[slowest_dim], tile + tile_size - 1 - (step - 1) * shift);
+
+        const auto* src = _step_buffers[(step - 1) % 2].data();
+        auto*       dst = _step_buffers[step % 2].data();
+        for_each_row(first, last, ws_offs,
+                     [&](pattern_index_t offset, pattern_size_t row_size) {
+                       operation(src + offset, dst + offset, row_size,
+                                 ws_stencil_offs);
+                     });
+      }
+    }
+
+    const auto* result = _step_buffers[num_steps % 2].data();
+    for_each_box_row(
+      view_upd.extents(), [&](ElementCoords_t coords, pattern_size_t row_size) {
+        pattern_index_t local_offset = 0;
+        for(dim_t d = 0; d < NumDimensions; ++d) {
+          coords[d] += view_upd.offset(d);
+          local_offset += coords[d] * local_offs[d];
+        }
+        auto* row = result + ws_offset(coords);
+        std::copy(row, row + row_size, begin_dst + local_offset);
+      });
+  }
+
 private:
+  /**
+   * Calls row_func(offset, row_size) for every row in the fastest dimension
+   * of the local block [begin_coords, end_coords] (inclusive). Rows are
+   * distributed to OpenMP threads in contiguous tiles if OpenMP is enabled.
+   */
+  template <typename RowFunc>
+  void for_each_row(const ElementCoords_t& begin_coords,
+                    const ElementCoords_t& end_coords,
+                    RowFunc                row_func) const {
+    for_each_row(begin_coords, end_coords, set_dimension_offsets(), row_func);
+  }
+
+  /**
+   * Calls row_func(offset, row_size) for every row in the fastest dimension
+   * of the block [begin_coords, end_coords] (inclusive) of a memory range
+   * with the given dimension offsets.
+   */
+  template <typename RowFunc>
+  void for_each_row(const ElementCoords_t&  begin_coords,
+                    const ElementCoords_t&  end_coords,
+                    const StencilOffsets_t& dim_offs,
+                    RowFunc                 row_func) const {
+    constexpr dim_t fastest_dim =
+      (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 : 0;
+
+    std::array<pattern_index_t, NumDimensions> extents;
+    pattern_index_t num_rows = 1;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      extents[d] = end_coords[d] - begin_coords[d] + 1;
+      if(extents[d] <= 0)
+        return;
+      if(d != fastest_dim)
+        num_rows *= extents[d];
+    }
+    const pattern_size_t row_size = extents[fastest_dim];
+
+    // Consecutive rows are adjacent in memory:
+    auto row_offset = [&](pattern_index_t row) {
+      pattern_index_t offset = begin_coords[fastest_dim]
+                               * dim_offs[fastest_dim];
+      for(dim_t i = 1; i < NumDimensions; ++i) {
+        dim_t d = (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 - i : i;
+        offset += (begin_coords[d] + row % extents[d]) * dim_offs[d];
+        row    /= extents[d];
+      }
+      return offset;
+    };
+
+#ifdef DASH_ENABLE_OPENMP
+    if(_num_threads > 1 && num_rows > 1 && !omp_in_parallel()) {
+      #pragma omp parallel for num_threads(_num_threads) schedule(static)
+      for(pattern_index_t row = 0; row < num_rows; ++row) {
+        row_func(row_offset(row), row_size);
+      }
+      return;
+    }
+#endif
+    for(pattern_index_t row = 0; row < num_rows; ++row) {
+      row_func(row_offset(row), row_size);
+    }
+  }
+
+  /**
+   * Returns the indices of all halo regions accessed by stencil points of
+   * elements in the given local view.
+   */
+  std::vector<region_index_t> halo_regions_at(const ViewSpec_t& view) const {
+    using RegionCoords_t = RegionCoords<NumDimensions>;
+
+    std::array<bool, RegionCoords_t::MaxIndex> accessed{};
+    for(auto i = 0; i < NumStencilPoints; ++i) {
+      // region coordinates (0: pre, 1: local, 2: post) touched per dimension
+      std::array<std::array<bool, 3>, NumDimensions> touched{};
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        auto first = view.offset(d) + _stencil_spec[i][d];
+        auto last  = first + static_cast<pattern_index_t>(view.extent(d)) - 1;
+        auto ext   = static_cast<pattern_index_t>(_view_local->extent(d));
+        touched[d][0] = first < 0;
+        touched[d][1] = last >= 0 && first < ext;
+        touched[d][2] = last >= ext;
+      }
+      for(region_index_t index = 0; index < RegionCoords_t::MaxIndex;
+          ++index) {
+        auto coords = RegionCoords_t::coords(index);
+        bool is_accessed = true;
+        for(dim_t d = 0; d < NumDimensions && is_accessed; ++d)
+          is_accessed = touched[d][coords[d]];
+        accessed[index] = accessed[index] || is_accessed;
+      }
+    }
+
+    std::vector<region_index_t> indices;
+    const auto center_index = RegionCoords_t().index();
+    for(region_index_t index = 0; index < RegionCoords_t::MaxIndex; ++index) {
+      if(accessed[index] && index != center_index)
+        indices.push_back(index);
+    }
+
+    return indices;
+  }
+
   StencilOffsets_t set_stencil_offsets() {
     StencilOffsets_t stencil_offs;
     for(auto i = 0; i < NumStencilPoints; ++i) {
@@ -711,24 +1087,61 @@ private:
     return stencil_offs;
   }
 
-  StencilOffsets_t set_dimension_offsets() {
-    StencilOffsets_t      dim_offs;
-    signed_pattern_size_t offset = 0;
+  StencilOffsets_t set_dimension_offsets() const {
+    return dimension_offsets(_view_local->extents());
+  }
+
+  /**
+   * Returns the memory offsets between two consecutive elements in every
+   * dimension of a block with the given extents.
+   */
+  template <typename ExtentsT>
+  static StencilOffsets_t dimension_offsets(const ExtentsT& extents) {
+    StencilOffsets_t dim_offs;
     if(MemoryArrange == ROW_MAJOR) {
       dim_offs[NumDimensions - 1] = 1;
       for(auto d = NumDimensions - 1; d > 0;) {
         --d;
-        dim_offs[d] = dim_offs[d + 1] * _view_local->extent(d + 1);
+        dim_offs[d] = dim_offs[d + 1] * extents[d + 1];
       }
     } else {
       dim_offs[0] = 1;
       for(auto d = 1; d < NumDimensions; ++d)
-        dim_offs[d] = dim_offs[d - 1] * _view_local->extent(d - 1);
+        dim_offs[d] = dim_offs[d - 1] * extents[d - 1];
     }
 
     return dim_offs;
   }
 
+  /**
+   * Calls row_func(coords, row_size) for every row in the fastest dimension
+   * of a block with the given extents, coords being the block coordinates
+   * of the first element in the row.
+   */
+  template <typename ExtentsT, typename RowFunc>
+  static void for_each_box_row(const ExtentsT& extents, RowFunc row_func) {
+    constexpr dim_t fastest_dim =
+      (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 : 0;
+
+    ElementCoords_t coords{};
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      if(extents[d] == 0)
+        return;
+    }
+    while(true) {
+      row_func(coords, extents[fastest_dim]);
+      dim_t i = 1;
+      for(; i < NumDimensions; ++i) {
+        dim_t d = (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 - i : i;
+        if(++coords[d] < static_cast<pattern_index_t>(extents[d]))
+          break;
+        coords[d] = 0;
+      }
+      if(i == NumDimensions)
+        return;
+    }
+  }
+
 public:
   Inner_t inner;
   Bnd_t   boundary;
@@ -748,6 +1161,9 @@ private:
   iterator_inner _iend;
   iterator_bnd   _bbegin;
   iterator_bnd   _bend;
+  int            _num_threads = 1;
+
+  std::array<std::vector<ElementT>, 2> _step_buffers;
 };
 
 }  // namespace halo
@@ -12,6 +12,8 @@
 #include <set>
 #include <utility>
 #include <climits> //For CHAR_BITS
+#include <cstdint>
+#include <type_traits>
 
 namespace dash {
 namespace math {
@@ -54,6 +56,234 @@ inline T1 div_ceil(
   return (a / b) + static_cast<T1>(a % b > 0);
 }
 
+namespace internal {
+
+#if defined(__SIZEOF_INT128__)
+// __extension__ suppresses the ISO C++ warning on __int128 with -pedantic:
+__extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+/**
+ * High word of the full-width product of two unsigned integers.
+ */
+constexpr uint32_t mul_hi(uint32_t a, uint32_t b)
+{
+  return static_cast<uint32_t>(
+           (static_cast<uint64_t>(a) * static_cast<uint64_t>(b)) >> 32);
+}
+
+constexpr uint64_t mul_hi(uint64_t a, uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+  return static_cast<uint64_t>(
+           (static_cast<uint128_t>(a) *
+            static_cast<uint128_t>(b)) >> 64);
+#else
+  uint64_t lolo  = (a & 0xffffffffULL) * (b & 0xffffffffULL);
+  uint64_t hilo  = (a >> 32)           * (b & 0xffffffffULL);
+  uint64_t lohi  = (a & 0xffffffffULL) * (b >> 32);
+  uint64_t hihi  = (a >> 32)           * (b >> 32);
+  uint64_t cross = (lolo >> 32) + (hilo & 0xffffffffULL) + lohi;
+  return hihi + (hilo >> 32) + (cross >> 32);
+#endif
+}
+
+}  // namespace internal
+
+/**
+ * Division and modulo by a run-time invariant divisor using a precomputed
+ * multiplicative inverse ("magic number") instead of integer division.
+ * Powers of two are specialized to shift and mask.
+ *
+ * Dividends must be non-negative, negative dividends of signed types fall
+ * back to integer division. The divisor must be greater than 0.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::math::FastDivisor<long> blocksize(7);
+ *   auto block_idx = blocksize.div(g_idx); // g_idx / 7
+ *   auto phase     = blocksize.mod(g_idx); // g_idx % 7
+ * \endcode
+ *
+ * \see StaticDivisor
+ */
+template <typename IntegerT>
+class FastDivisor
+{
+  static_assert(std::is_integral<IntegerT>::value,
+                "FastDivisor requires integral type");
+
+  typedef typename std::conditional<
+            (sizeof(IntegerT) <= sizeof(uint32_t)),
+            uint32_t,
+            uint64_t
+          >::type  unsigned_t;
+
+  static constexpr int NumBits = sizeof(unsigned_t) * CHAR_BIT;
+
+public:
+  typedef IntegerT value_type;
+
+public:
+  constexpr FastDivisor() = default;
+
+  constexpr explicit FastDivisor(IntegerT divisor)
+  : _divisor(static_cast<unsigned_t>(divisor))
+  {
+    unsigned_t d  = _divisor;
+    _is_pow2      = (d != 0) && ((d & (d - 1)) == 0);
+    // ceil(log2(d)):
+    int log2d     = 0;
+    while (log2d < NumBits && (unsigned_t(1) << log2d) < d) {
+      ++log2d;
+    }
+    if (_is_pow2) {
+      _shift = log2d;
+      return;
+    }
+    if (d < 3) {
+      return;
+    }
+    // magic = floor(2^N * (2^log2d - d) / d) + 1, computed by long
+    // division as (2^log2d - d) < d:
+    unsigned_t rem = (log2d == NumBits)
+                     ? static_cast<unsigned_t>(0 - d)
+                     : (unsigned_t(1) << log2d) - d;
+    unsigned_t quot = 0;
+    for (int b = 0; b < NumBits; ++b) {
+      bool carry = (rem >> (NumBits - 1)) != 0;
+      rem  <<= 1;
+      quot <<= 1;
+      if (carry || rem >= d) {
+        rem  -= d;
+        quot |= 1;
+      }
+    }
+    _magic = quot + 1;
+    _shift = log2d - 1;
+  }
+
+  constexpr IntegerT divisor() const noexcept
+  {
+    return static_cast<IntegerT>(_divisor);
+  }
+
+  constexpr bool is_pow2() const noexcept
+  {
+    return _is_pow2;
+  }
+
+  /**
+   * Quotient \c (n / divisor).
+   */
+  constexpr IntegerT div(IntegerT n) const noexcept
+  {
+    return (n < 0)
+           ? static_cast<IntegerT>(n / divisor())
+           : static_cast<IntegerT>(div_unsigned(static_cast<unsigned_t>(n)));
+  }
+
+  /**
+   * Remainder \c (n % divisor).
+   */
+  constexpr IntegerT mod(IntegerT n) const noexcept
+  {
+    return (n < 0)
+           ? static_cast<IntegerT>(n % divisor())
+           : (_is_pow2
+              ? static_cast<IntegerT>(
+                  static_cast<unsigned_t>(n) & (_divisor - 1))
+              : static_cast<IntegerT>(
+                  static_cast<unsigned_t>(n)
+                  - div_unsigned(static_cast<unsigned_t>(n)) * _divisor));
+  }
+
+  constexpr bool operator==(const FastDivisor & other) const noexcept
+  {
+    return _divisor == other._divisor;
+  }
+
+  constexpr bool operator!=(const FastDivisor & other) const noexcept
+  {
+    return !(*this == other);
+  }
+
+private:
+  constexpr unsigned_t div_unsigned(unsigned_t n) const noexcept
+  {
+    return _is_pow2
+           ? (n >> _shift)
+           : ((_magic == 0)
+              // divisor 0, undefined:
+              ? n
+              : ((internal::mul_hi(_magic, n)
+                  + ((n - internal::mul_hi(_magic, n)) >> 1)) >> _shift));
+  }
+
+private:
+  unsigned_t _divisor = 1;
+  unsigned_t _magic   = 0;
+  int        _shift   = 0;
+  bool       _is_pow2 = true;
+};
+
+/**
+ * Division and modulo by a divisor known at compile time, provides the
+ * interface of \c FastDivisor for block sizes specified as template
+ * parameters. The compiler strength-reduces the operations.
+ *
+ * \see FastDivisor
+ */
+template <typename IntegerT, IntegerT Divisor>
+class StaticDivisor
+{
+  static_assert(Divisor > 0, "StaticDivisor requires divisor > 0");
+
+public:
+  typedef IntegerT value_type;
+
+public:
+  constexpr IntegerT divisor() const noexcept
+  {
+    return Divisor;
+  }
+
+  constexpr bool is_pow2() const noexcept
+  {
+    return (Divisor & (Divisor - 1)) == 0;
+  }
+
+  constexpr IntegerT div(IntegerT n) const noexcept
+  {
+    return n / Divisor;
+  }
+
+  constexpr IntegerT mod(IntegerT n) const noexcept
+  {
+    return n % Divisor;
+  }
+
+  constexpr operator FastDivisor<IntegerT>() const
+  {
+    return FastDivisor<IntegerT>(Divisor);
+  }
+};
+
+/**
+ * Divisors of all elements in \c extents.
+ */
+template <typename IntegerT, typename ExtentT, std::size_t NumDim>
+std::array<FastDivisor<IntegerT>, NumDim> make_divisors(
+  const std::array<ExtentT, NumDim> & extents)
+{
+  std::array<FastDivisor<IntegerT>, NumDim> divisors;
+  for (std::size_t d = 0; d < NumDim; ++d) {
+    divisors[d] = FastDivisor<IntegerT>(static_cast<IntegerT>(extents[d]));
+  }
+  return divisors;
+}
+
 template <typename Iter>
 inline void div_mean(Iter begin, Iter end)
 {
@@ -4,10 +4,115 @@
 #include <dash/GlobPtr.h>
 #include <dash/internal/Macro.h>
 #include <dash/Exception.h>
+#include <dash/Iterator.h>
+
+#include <algorithm>
+#include <limits>
 
 namespace dash {
 namespace internal {
 
+/**
+ * Number of elements from the position of a global iterator without view
+ * to the end of the current row of its view, which is unbounded.
+ */
+template<typename IteratorT>
+constexpr typename std::enable_if<
+  !IteratorT::has_view::value,
+  typename IteratorT::pattern_type::size_type
+>::type
+view_row_remaining(const IteratorT &) noexcept
+{
+  return std::numeric_limits<
+           typename IteratorT::pattern_type::size_type>::max();
+}
+
+/**
+ * Number of elements from the position of a global view iterator to the
+ * end of the current row of its view in the fastest-changing dimension.
+ */
+template<typename IteratorT>
+typename std::enable_if<
+  IteratorT::has_view::value,
+  typename IteratorT::pattern_type::size_type
+>::type
+view_row_remaining(const IteratorT & it)
+{
+  using pattern_type = typename IteratorT::pattern_type;
+  using size_type    = typename pattern_type::size_type;
+  if (!it.is_relative()) {
+    return std::numeric_limits<size_type>::max();
+  }
+  constexpr const int ndim = pattern_type::ndim();
+  const int fast_dim = (it.pattern().memory_order() == dash::ROW_MAJOR)
+                       ? ndim - 1 : 0;
+  // Views are iterated in the memory order of the pattern, the phase in
+  // the fastest-changing dimension is the position modulo its extent:
+  size_type extent_d = it.viewspec().extent(fast_dim);
+  return extent_d - (static_cast<size_type>(it.rpos()) % extent_d);
+}
+
+/**
+ * Number of elements in the contiguous range starting at \c first, i.e.
+ * the longest sequence of elements in \c [first, last) that are stored
+ * consecutively in the local memory of a single unit.
+ *
+ * Block rows in the fastest-changing dimension of the pattern are
+ * contiguous in local memory. Subsequent block rows are appended to the
+ * range as long as they directly follow in the same unit's memory.
+ */
+template<typename IteratorT>
+typename IteratorT::pattern_type::size_type
+contiguous_range_size(const IteratorT & first, const IteratorT & last)
+{
+  using pattern_type = typename IteratorT::pattern_type;
+  using index_type   = typename pattern_type::index_type;
+  using size_type    = typename pattern_type::size_type;
+
+  auto num_elem_total = dash::distance(first, last);
+  if (num_elem_total <= 0) {
+    return 0;
+  }
+  const size_type elems_total = num_elem_total;
+
+  constexpr const int ndim = pattern_type::ndim();
+  const auto& pattern  = first.pattern();
+  const int   fast_dim = (pattern.memory_order() == dash::ROW_MAJOR)
+                         ? ndim - 1 : 0;
+
+  auto      cur_last = first;
+  auto      lpos     = first.lpos();
+  size_type num_elem = 0;
+
+  do {
+    /* Determine coords and offset in current block */
+    auto global_coords  = pattern.coords(cur_last.gpos());
+    auto block_idx      = pattern.block_at(global_coords);
+    auto block_viewspec = pattern.block(block_idx);
+    auto phase_d        = global_coords[fast_dim]
+                          - block_viewspec.offset(fast_dim);
+    // the number of elements in the block row is the block extent minus
+    // the offset in the block, limited by the row of the iterator's view
+    size_type num_block_elem = std::min<size_type>(
+                                 block_viewspec.extent(fast_dim) - phase_d,
+                                 view_row_remaining(cur_last));
+    // don't exceed the total range
+    if (num_block_elem >= elems_total - num_elem) {
+      return elems_total;
+    }
+    num_elem += num_block_elem;
+    cur_last += num_block_elem;
+    // check whether the contiguous range continues in the next block row
+    auto next_lpos = cur_last.lpos();
+    if (next_lpos.unit != lpos.unit ||
+        next_lpos.index - lpos.index != static_cast<index_type>(num_elem)) {
+      break;
+    }
+  } while (1);
+
+  return num_elem;
+}
+
 /**
  * Iterator used to find consecutive memory ranges across a global memory range.
  */
@@ -86,55 +191,7 @@ private:
       return std::make_pair(m_end, 0);
     }
 
-    auto cur_last  = cur_first;
-    size_type num_copy_elem = 0;
-    constexpr const int ndim = pattern_type::ndim();
-    const auto& pattern = m_pos.pattern();
-    const int fast_dim = (pattern.memory_order() == dash::ROW_MAJOR) ? ndim - 1 : 0;
-
-
-    auto lpos = m_pos.lpos();
-    auto prev_lpos = lpos;
-
-    do {
-
-      /* Determine coords and offset in first block */
-      auto global_coords = pattern.coords(cur_last.gpos());
-
-      auto block_idx = pattern.block_at(global_coords);
-
-      auto block_viewspec = pattern.block(block_idx);
-
-      auto phase_d = global_coords[fast_dim] - block_viewspec.offset(fast_dim);
-
-      auto blocksize_d = block_viewspec.extent(fast_dim);
-
-      // the number of elements to copy is the blocksize minus the offset in the block
-      size_type num_copy_block_elem = blocksize_d - phase_d;
-
-      // don't try to copy too many elements
-      size_type elems_left = dash::distance(cur_last, m_end);
-      if (num_copy_block_elem > elems_left) {
-        num_copy_block_elem = elems_left;
-        // nothing more to do here
-        num_copy_elem += num_copy_block_elem;
-        break;
-      }
-
-      cur_last      += num_copy_block_elem;
-      auto next_lpos = cur_last.lpos();
-
-      num_copy_elem += num_copy_block_elem;
-      // check whether the contiguous range is over at the end of the block
-      if (cur_last == m_end ||
-          next_lpos.unit != lpos.unit ||
-          next_lpos.index != (prev_lpos.index + 1)) {
-        break;
-      }
-
-      prev_lpos = next_lpos;
-
-    } while (1);
+    size_type num_copy_elem = contiguous_range_size(cur_first, m_end);
     DASH_LOG_TRACE("next_range<GlobIter>", "cur_first", cur_first,
                    "num_copy_elem", num_copy_elem);
     return std::make_pair(cur_first, num_copy_elem);
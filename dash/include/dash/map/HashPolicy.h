@@ -3,6 +3,11 @@
 
 #include <dash/Team.h>
 
+#include <functional>
+#include <type_traits>
+#include <cstring>
+#include <cstdint>
+
 namespace dash {
 template <typename Key>
 class HashLocal {
@@ -41,8 +46,53 @@ class HashLocal {
   team_unit_t _myid;
 };  // class HashLocal
 
+/**
+ * Whether a hash policy maps a key to the same unit independent of the
+ * unit evaluating the hash function.
+ *
+ * Only for unit-invariant hash policies, the unit returned by the hash
+ * function can be used to locate an element from any unit.
+ * User-defined hash policies are expected to be unit-invariant,
+ * \c HashLocal maps every key to the calling unit.
+ */
+template <typename Hash>
+struct is_unit_invariant_hash : std::true_type { };
+
+template <typename Key>
+struct is_unit_invariant_hash<HashLocal<Key>> : std::false_type { };
+
 namespace detail {
 
+/**
+ * Hash of a key to a bucket in a unit's local bucket index.
+ *
+ * Uses \c std::hash if it is defined for the key type, otherwise falls
+ * back to FNV-1a over the key's object representation.
+ */
+template <typename Key, typename = void>
+struct key_bucket_hash {
+  std::size_t operator()(const Key& key) const noexcept
+  {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&key);
+    uint64_t             hash  = 14695981039346656037ull;
+    for (std::size_t b = 0; b < sizeof(Key); ++b) {
+      hash ^= bytes[b];
+      hash *= 1099511628211ull;
+    }
+    return static_cast<std::size_t>(hash);
+  }
+};
+
+template <typename Key>
+struct key_bucket_hash<
+    Key,
+    decltype(void(std::hash<Key>()(std::declval<const Key&>())))> {
+  std::size_t operator()(const Key& key) const noexcept
+  {
+    return std::hash<Key>()(key);
+  }
+};
+
 struct HashNodeBase {
   HashNodeBase* _next;
 
@@ -10,6 +10,7 @@
 #include <dash/Array.h>
 #include <dash/Allocator.h>
 #include <dash/Meta.h>
+#include <dash/Onesided.h>
 
 #include <dash/memory/GlobHeapMem.h>
 
@@ -23,10 +24,13 @@
 #include <iterator>
 #include <utility>
 #include <limits>
+#include <type_traits>
 #include <vector>
 #include <functional>
 #include <algorithm>
+#include <numeric>
 #include <cstddef>
+#include <cstdint>
 
 
 namespace dash {
@@ -138,6 +142,29 @@ public:
             size_type, int, dash::CSRPattern<1, dash::ROW_MAJOR, int> >
     local_sizes_map;
 
+private:
+  /// Entry in a unit's bucket index, refers to the position of an element
+  /// with the given key in a unit's local memory.
+  typedef struct {
+    key_type    key;
+    dart_unit_t unit;
+    index_type  lidx;
+  } bucket_entry;
+
+  typedef dash::CSRPattern<1, dash::ROW_MAJOR, index_type>
+    bucket_index_pattern;
+
+  /// Bucket index entries of all units, ordered by bucket.
+  typedef dash::Array<bucket_entry, index_type, bucket_index_pattern>
+    bucket_entries_map;
+
+  /// Offsets of buckets in the bucket index entries of all units.
+  typedef dash::Array<size_type, index_type, bucket_index_pattern>
+    bucket_offsets_map;
+
+  typedef dash::detail::key_bucket_hash<key_type>
+    bucket_hasher;
+
 private:
   /// Team containing all units interacting with the map.
   dash::Team           * _team            = nullptr;
@@ -159,9 +186,16 @@ private:
   local_sizes_map        _local_sizes;
   /// Cumulative (postfix sum) local sizes of all units.
   std::vector<size_type> _local_cumul_sizes;
-  /// Iterators to elements in local memory space that are marked for move
-  /// to remote unit in next commit.
-  std::vector<iterator>  _move_elements;
+  /// Heads of the bucket chains of local elements, -1 for empty buckets.
+  std::vector<index_type> _lbucket_heads;
+  /// Local index of the successor of every local element in its bucket
+  /// chain, -1 for the last element in a chain.
+  std::vector<index_type> _lbucket_next;
+  /// Bucket index published in the last commit. Every unit holds the
+  /// entries of keys that are mapped to it by the hash function.
+  bucket_entries_map     _bucket_entries;
+  /// Bucket offsets in the published bucket index of every unit.
+  bucket_offsets_map     _bucket_offsets;
   /// Global pointer to local element in _local_sizes.
   dart_gptr_t            _local_size_gptr = DART_GPTR_NULL;
   /// Hash type for mapping of key to unit and local offset.
@@ -273,6 +307,8 @@ public:
                    "invalid size after global commit");
     _begin = iterator(this, 0);
     _end   = iterator(this, new_size);
+    // Publish keys of all elements in the bucket indices of their units:
+    _publish_bucket_index();
     DASH_LOG_TRACE("UnorderedMap.barrier >", "passed barrier");
   }
 
@@ -362,6 +398,12 @@ public:
       _globmem = nullptr;
     }
     _local_cumul_sizes    = std::vector<size_type>(_team->size(), 0);
+    _lbucket_heads.clear();
+    _lbucket_next.clear();
+    if (_bucket_entries.size() > 0) {
+      _bucket_entries.deallocate();
+      _bucket_offsets.deallocate();
+    }
     _remote_size          = 0;
     _begin                = iterator();
     _end                  = _begin;
@@ -549,14 +591,21 @@ public:
     return nelem;
   }
 
+  /**
+   * Finds an element with key equivalent to the specified key.
+   *
+   * Elements in local memory are resolved in the local bucket index.
+   * Otherwise, the bucket index of the unit that is mapped to the key by
+   * the hash function is searched, at the cost of two one-sided gets for
+   * a remote unit. Hash policies that are not unit-invariant (like
+   * \c HashLocal) fall back to searching the bucket indices of all units.
+   *
+   * Elements inserted at remote units are visible after the next commit.
+   */
   iterator find(const key_type & key)
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find()", key);
-    iterator found = std::find_if(
-                       _begin, _end,
-                       [&](const value_type & v) {
-                         return _key_equal(v.first, key);
-                       });
+    iterator found = _find(key);
     DASH_LOG_TRACE("UnorderedMap.find >", found);
     return found;
   }
@@ -564,11 +613,7 @@ public:
   const_iterator find(const key_type & key) const
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find() const", key);
-    const_iterator found = std::find_if(
-                             _begin, _end,
-                             [&](const value_type & v) {
-                               return _key_equal(v.first, key);
-                             });
+    const_iterator found = _find(key);
     DASH_LOG_TRACE("UnorderedMap.find const >", found);
     return found;
   }
@@ -612,57 +657,21 @@ public:
   }
 
   iterator insert(
+    /// Unused, element positions are determined by the bucket index.
     const_iterator hint,
     const value_type & value)
   {
-    auto key = value.first;
-    auto mapped = value.second;
-
-    DASH_ASSERT(_globmem != nullptr);
-    DASH_LOG_DEBUG("UnorderedMap.insert()", "key:", key, "mapped:", mapped);
-
-    auto unit = _key_hash(key);
-
-    iterator found = _end;
-
-    if (_myid == unit) {
-      DASH_LOG_TRACE("UnorderedMap.insert", "local element key lookup");
-
-      auto lbegin = static_cast<value_type *>(_lbegin);
-      auto lend = static_cast<value_type *>(_lend);
-      const_local_iterator liter = std::find_if(
-                  _lbegin, _lend,
-                   [&](const value_type & v) {
-                     return _key_equal(v.first, key);
-                   });
-
-      if (liter != _lend) {
-        found = iterator(this, _myid, liter.pos());
-      }
-
-    } else  {
-      DASH_LOG_TRACE("UnorderedMap.insert", "element key lookup");
-      iterator found = find(key);
-    }
-    DASH_LOG_TRACE_VAR("UnorderedMap.insert", found);
-
-    iterator res;
-    if (found != _end) {
-      DASH_LOG_TRACE("UnorderedMap.insert", "key found");
-      // Existing element found, no insertion:
-      res = found;
-    } else {
-      DASH_LOG_TRACE("UnorderedMap.insert", "key not found");
-      // Unit mapped to the new element's key by the hash function:
-      DASH_LOG_TRACE("UnorderedMap.insert", "target unit:", unit);
-      // No element with specified key exists, insert new value.
-      auto result = _insert_at(unit, value);
-      res = result.first;
-    }
-
-    return res;
+    DASH_LOG_DEBUG("UnorderedMap.insert()", "key:", value.first);
+    return insert(value).first;
   }
 
+  /**
+   * Inserts the elements in the given range, elements with keys that
+   * already exist in the map are ignored.
+   *
+   * Local capacity for all elements in the range is allocated in a single
+   * call of \c globmem.grow().
+   */
   template<class InputIterator>
   void insert(
     // Iterator at first value in the range to insert.
@@ -670,13 +679,100 @@ public:
     // Iterator past the last value in the range to insert.
     InputIterator last)
   {
-    // TODO: Calling insert() on every single element in the range could cause
-    //       multiple calls of globmem.grow(_local_buffer_size).
-    //       Could be optimized to allocate additional memory in a single call
-    //       of globmem.grow(std::distance(first,last)).
+    DASH_LOG_TRACE("UnorderedMap.insert(first,last)");
+    std::vector<value_type> values(first, last);
+    _reserve_local(values.size());
+    for (const auto & value : values) {
+      insert(value);
+    }
+    DASH_LOG_TRACE("UnorderedMap.insert(first,last) >");
+  }
+
+  /**
+   * Collective bulk insertion of the elements in the given local range.
+   *
+   * Every unit passes its local batch of elements. Elements are moved to
+   * the units mapped to their keys by the hash function in a single
+   * all-to-all exchange, every unit then inserts its share using a single
+   * call of \c globmem.grow() and commits the map.
+   * Elements with keys that already exist in the map are ignored. For hash
+   * policies that are not unit-invariant, keys are only compared to
+   * elements at the calling unit.
+   *
+   * Local elements that have not been committed to global memory yet are
+   * committed in the same operation.
+   *
+   * \returns  The number of elements inserted at the calling unit.
+   */
+  template<class InputIterator>
+  size_type bulk_insert(
+    // Iterator at first value in the local range to insert.
+    InputIterator first,
+    // Iterator past the last value in the local range to insert.
+    InputIterator last)
+  {
+    DASH_LOG_TRACE("UnorderedMap.bulk_insert()");
+    DASH_ASSERT(_globmem != nullptr);
+    auto nunits = _team->size();
+    // Stage elements by target unit:
+    std::vector<std::vector<value_type>> unit_values(nunits);
     for (auto it = first; it != last; ++it) {
-      insert(*it);
+      const value_type & value = *it;
+      unit_values[_owner_of(value.first)].push_back(value);
+    }
+    std::vector<size_t> send_counts(nunits);
+    std::vector<size_t> send_displs(nunits);
+    std::vector<size_t> recv_counts(nunits);
+    std::vector<size_t> recv_displs(nunits);
+    size_t nsend = 0;
+    for (size_type u = 0; u < nunits; ++u) {
+      send_displs[u] = nsend;
+      send_counts[u] = unit_values[u].size();
+      nsend         += send_counts[u];
+    }
+    std::vector<value_type> send_values;
+    send_values.reserve(nsend);
+    for (auto & values : unit_values) {
+      for (const auto & value : values) {
+        send_values.push_back(value);
+      }
+      values = std::vector<value_type>();
+    }
+    DASH_ASSERT_RETURNS(
+      dart_alltoall(send_counts.data(), recv_counts.data(), 1,
+                    dash::dart_datatype<size_t>::value, _team->dart_id()),
+      DART_OK);
+    size_t nrecv = 0;
+    for (size_type u = 0; u < nunits; ++u) {
+      recv_displs[u] = nrecv;
+      nrecv         += recv_counts[u];
     }
+    DASH_LOG_TRACE("UnorderedMap.bulk_insert", "exchanging elements",
+                   "send:", nsend, "recv:", nrecv);
+    typedef typename std::aligned_storage<
+                       sizeof(value_type), alignof(value_type)
+                     >::type value_storage;
+    std::vector<value_storage> recv_values(nrecv);
+    dart_datatype_t dtype;
+    DASH_ASSERT_RETURNS(
+      dart_type_create_custom(sizeof(value_type), &dtype),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_alltoallv(send_values.data(), send_counts.data(),
+                     send_displs.data(), dtype,
+                     recv_values.data(), recv_counts.data(),
+                     recv_displs.data(), _team->dart_id()),
+      DART_OK);
+    DASH_ASSERT_RETURNS(dart_type_destroy(&dtype), DART_OK);
+    send_values = std::vector<value_type>();
+
+    auto recv_begin = reinterpret_cast<const value_type *>(
+                        recv_values.data());
+    auto ninserted  = _insert_local(recv_begin, recv_begin + nrecv);
+    // Commit all elements:
+    barrier();
+    DASH_LOG_TRACE("UnorderedMap.bulk_insert >", "inserted:", ninserted);
+    return ninserted;
   }
 
   iterator erase(
@@ -800,6 +896,320 @@ private:
                    "lptr to mapped:", lptr_mapped);
   }
 
+  /**
+   * Unit mapped to the given key by the hash function.
+   */
+  team_unit_t _unit_of(const key_type & key) const
+  {
+    // Hash functors are not required to be const-invocable:
+    return const_cast<hasher &>(_key_hash)(key);
+  }
+
+  /**
+   * Unit holding the bucket index entry of the given key.
+   */
+  team_unit_t _owner_of(const key_type & key) const
+  {
+    return is_unit_invariant_hash<hasher>::value
+           ? _unit_of(key)
+           : _myid;
+  }
+
+  /**
+   * Bucket of a key in a bucket index with the given number of buckets,
+   * which is a power of two.
+   */
+  static size_type _bucket_of(const key_type & key, size_type nbuckets)
+  {
+    uint64_t h = static_cast<uint64_t>(bucket_hasher()(key));
+    // Mix bits as std::hash is the identity for integral types:
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    return static_cast<size_type>(h) & (nbuckets - 1);
+  }
+
+  /**
+   * Number of buckets in a bucket index of the given number of entries.
+   */
+  static size_type _num_buckets(size_type nentries)
+  {
+    size_type nbuckets = 1;
+    while (nbuckets < nentries) {
+      nbuckets <<= 1;
+    }
+    return nbuckets;
+  }
+
+  /**
+   * Element at the given offset in local memory.
+   */
+  const value_type & _local_value(index_type lidx) const
+  {
+    return *static_cast<const value_type *>(_globmem->lbegin() + lidx);
+  }
+
+  /**
+   * Adds the local element at the given offset to the local bucket index.
+   */
+  void _local_index_insert(index_type lidx)
+  {
+    DASH_ASSERT_EQ(static_cast<size_type>(lidx), _lbucket_next.size(),
+                   "local elements must be indexed in order");
+    _lbucket_next.push_back(-1);
+    if (_lbucket_next.size() > _lbucket_heads.size()) {
+      // Rehash at load factor 1:
+      _lbucket_heads.assign(
+        std::max<size_type>(2 * _lbucket_heads.size(), 16), -1);
+      for (index_type l = 0; l <= lidx; ++l) {
+        auto b = _bucket_of(_local_value(l).first, _lbucket_heads.size());
+        _lbucket_next[l]  = _lbucket_heads[b];
+        _lbucket_heads[b] = l;
+      }
+    } else {
+      auto b = _bucket_of(_local_value(lidx).first, _lbucket_heads.size());
+      _lbucket_next[lidx] = _lbucket_heads[b];
+      _lbucket_heads[b]   = lidx;
+    }
+  }
+
+  /**
+   * Offset of the element with the given key in local memory, -1 if
+   * there is no such element in local memory.
+   */
+  index_type _local_find(const key_type & key) const
+  {
+    if (_lbucket_heads.empty()) {
+      return -1;
+    }
+    auto lidx = _lbucket_heads[_bucket_of(key, _lbucket_heads.size())];
+    while (lidx >= 0 && !_key_equal(_local_value(lidx).first, key)) {
+      lidx = _lbucket_next[lidx];
+    }
+    return lidx;
+  }
+
+  /**
+   * Looks up the given key in the bucket index published by the specified
+   * unit.
+   */
+  iterator _index_find(team_unit_t unit, const key_type & key) const
+  {
+    auto     self     = const_cast<self_t *>(this);
+    auto   & pattern  = _bucket_offsets.pattern();
+    auto     nbuckets = pattern.local_size(unit) - 1;
+    auto     bucket   = _bucket_of(key, nbuckets);
+    DASH_LOG_TRACE("UnorderedMap._index_find()", "unit:", unit,
+                   "nbuckets:", nbuckets, "bucket:", bucket);
+    if (unit == _myid) {
+      auto offsets = _bucket_offsets.lbegin();
+      auto entries = _bucket_entries.lbegin();
+      for (auto e = offsets[bucket]; e < offsets[bucket + 1]; ++e) {
+        if (_key_equal(entries[e].key, key)) {
+          return iterator(self, team_unit_t(entries[e].unit),
+                          entries[e].lidx);
+        }
+      }
+      return _end;
+    }
+    size_type range[2];
+    dash::internal::get_blocking(
+      (_bucket_offsets.begin() + pattern.global(unit, bucket)).dart_gptr(),
+      range, 2);
+    if (range[1] == range[0]) {
+      return _end;
+    }
+    std::vector<bucket_entry> entries(range[1] - range[0]);
+    dash::internal::get_blocking(
+      (_bucket_entries.begin() +
+         _bucket_entries.pattern().global(unit, range[0])).dart_gptr(),
+      entries.data(), entries.size());
+    for (const auto & entry : entries) {
+      if (_key_equal(entry.key, key)) {
+        return iterator(self, team_unit_t(entry.unit), entry.lidx);
+      }
+    }
+    return _end;
+  }
+
+  iterator _find(const key_type & key) const
+  {
+    auto self = const_cast<self_t *>(this);
+    auto lidx = _local_find(key);
+    if (lidx >= 0) {
+      return iterator(self, _myid, lidx);
+    }
+    if (_bucket_offsets.size() == 0) {
+      // No bucket index has been published yet:
+      return _end;
+    }
+    if (is_unit_invariant_hash<hasher>::value) {
+      return _index_find(_unit_of(key), key);
+    }
+    // Keys are indexed at the unit storing them, the local unit's index
+    // has been searched already:
+    for (team_unit_t u{0}; u < _team->size(); ++u) {
+      if (u == _myid) {
+        continue;
+      }
+      auto found = _index_find(u, key);
+      if (found != _end) {
+        return found;
+      }
+    }
+    return _end;
+  }
+
+  /**
+   * Collectively publishes the keys of all elements in the bucket index
+   * of the unit mapped to the key by the hash function.
+   * Index entries refer to the element's position in the local memory
+   * of the unit that inserted the element.
+   */
+  void _publish_bucket_index()
+  {
+    DASH_LOG_TRACE("UnorderedMap._publish_bucket_index()");
+    auto nunits = _team->size();
+    auto dtype  = dash::dart_datatype<size_type>::value;
+    // Index entries of local elements, grouped by the unit holding the
+    // entry:
+    std::vector<std::vector<bucket_entry>> send_entries(nunits);
+    for (index_type lidx = 0; lidx < static_cast<index_type>(lsize());
+         ++lidx) {
+      auto & key = _local_value(lidx).first;
+      send_entries[_owner_of(key)].push_back(bucket_entry{ key, _myid.id, lidx });
+    }
+    std::vector<size_type> send_count(nunits);
+    std::vector<size_type> recv_count(nunits);
+    for (size_type u = 0; u < nunits; ++u) {
+      send_count[u] = send_entries[u].size();
+    }
+    DASH_ASSERT_RETURNS(
+      dart_alltoall(send_count.data(), recv_count.data(), 1, dtype,
+                    _team->dart_id()),
+      DART_OK);
+    // Offsets of the entries received from every unit in the local
+    // entries:
+    std::vector<size_type> recv_offset(nunits);
+    std::vector<size_type> send_offset(nunits);
+    size_type nentries = 0;
+    for (size_type u = 0; u < nunits; ++u) {
+      recv_offset[u] = nentries;
+      nentries      += recv_count[u];
+    }
+    DASH_ASSERT_RETURNS(
+      dart_alltoall(recv_offset.data(), send_offset.data(), 1, dtype,
+                    _team->dart_id()),
+      DART_OK);
+    std::vector<size_type> nentries_all(nunits);
+    DASH_ASSERT_RETURNS(
+      dart_allgather(&nentries, nentries_all.data(), 1, dtype,
+                     _team->dart_id()),
+      DART_OK);
+    // Reallocate bucket index, local sizes of entries are padded to avoid
+    // empty local segments:
+    std::vector<size_type> entries_lsizes(nunits);
+    std::vector<size_type> offsets_lsizes(nunits);
+    for (size_type u = 0; u < nunits; ++u) {
+      entries_lsizes[u] = std::max<size_type>(nentries_all[u], 1);
+      offsets_lsizes[u] = _num_buckets(nentries_all[u]) + 1;
+    }
+    if (_bucket_entries.size() > 0) {
+      _bucket_entries.deallocate();
+      _bucket_offsets.deallocate();
+    }
+    _bucket_entries.allocate(bucket_index_pattern(entries_lsizes, *_team));
+    _bucket_offsets.allocate(bucket_index_pattern(offsets_lsizes, *_team));
+    // Write entries to their units:
+    for (team_unit_t u{0}; u < nunits; ++u) {
+      if (send_entries[u].empty()) {
+        continue;
+      }
+      if (u == _myid) {
+        std::copy(send_entries[u].begin(), send_entries[u].end(),
+                  _bucket_entries.lbegin() + send_offset[u]);
+      } else {
+        dash::internal::put_blocking(
+          (_bucket_entries.begin() +
+             _bucket_entries.pattern().global(u, send_offset[u])
+          ).dart_gptr(),
+          send_entries[u].data(), send_entries[u].size());
+      }
+    }
+    _team->barrier();
+    // Order local entries by bucket:
+    auto nbuckets = offsets_lsizes[_myid] - 1;
+    auto offsets  = _bucket_offsets.lbegin();
+    auto entries  = _bucket_entries.lbegin();
+    std::vector<bucket_entry> received(entries, entries + nentries);
+    std::fill(offsets, offsets + nbuckets + 1, 0);
+    for (const auto & entry : received) {
+      ++offsets[_bucket_of(entry.key, nbuckets) + 1];
+    }
+    std::partial_sum(offsets, offsets + nbuckets + 1, offsets);
+    std::vector<size_type> bucket_pos(offsets, offsets + nbuckets);
+    for (const auto & entry : received) {
+      entries[bucket_pos[_bucket_of(entry.key, nbuckets)]++] = entry;
+    }
+    // Bucket indices must be complete before remote lookups:
+    _team->barrier();
+    DASH_LOG_TRACE("UnorderedMap._publish_bucket_index >",
+                   "local entries:", nentries, "buckets:", nbuckets);
+  }
+
+  /**
+   * Increases local capacity to hold at least the given number of
+   * additional elements in a single call of \c globmem.grow().
+   */
+  void _reserve_local(size_type nelem)
+  {
+    auto lsize_new = lsize() + nelem;
+    auto lcap      = _globmem->local_size();
+    if (lsize_new > lcap) {
+      DASH_LOG_TRACE("UnorderedMap._reserve_local",
+                     "globmem.grow(", lsize_new - lcap, ")");
+      _globmem->grow(std::max(lsize_new - lcap, _local_buffer_size));
+    }
+  }
+
+  /**
+   * Inserts the elements in the given range into local memory, skipping
+   * keys that exist in local memory or are published in the local unit's
+   * bucket index.
+   *
+   * \returns  The number of inserted elements.
+   */
+  size_type _insert_local(
+    const value_type * first,
+    const value_type * last)
+  {
+    _reserve_local(std::distance(first, last));
+    auto      lsize_old = lsize();
+    size_type ninserted = 0;
+    bool      indexed   = _bucket_offsets.size() > 0;
+    for (auto it = first; it != last; ++it) {
+      if (_local_find(it->first) >= 0 ||
+          (indexed && _index_find(_myid, it->first) != _end)) {
+        continue;
+      }
+      // Address every slot from lbegin as incrementing a local pointer
+      // across a bucket boundary is not supported by GlobHeapLocalPtr.
+      // Using placement new to avoid assignment/copy as value_type is
+      // const:
+      auto lptr = static_cast<value_type *>(
+                    _globmem->lbegin() + (lsize_old + ninserted));
+      new (lptr) value_type(*it);
+      _local_index_insert(lsize_old + ninserted);
+      ++ninserted;
+    }
+    // Single atomic update of the local size:
+    GlobRef<Atomic<size_type>>(_local_size_gptr).fetch_add(ninserted);
+    _local_cumul_sizes[_myid] += ninserted;
+    _lend = _lbegin + lsize();
+    _end  = iterator(this, size());
+    return ninserted;
+  }
+
   /**
    * Insert value at specified unit.
    */
@@ -822,7 +1232,7 @@ private:
 
     size_type new_local_size   = old_local_size + 1;
     size_type local_capacity   = _globmem->local_size();
-    _local_cumul_sizes[unit]  += 1;
+    _local_cumul_sizes[_myid] += 1;
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", local_capacity);
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", _local_buffer_size);
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", old_local_size);
@@ -848,19 +1258,15 @@ private:
     // Using placement new to avoid assignment/copy as value_type is
     // const:
     new (lptr_insert) value_type(value);
-    // Convert local iterator to global iterator:
+    _local_index_insert(old_local_size);
+    // Elements are stored in the local memory of the inserting unit,
+    // the key is published in the bucket index of the target unit in the
+    // next commit:
     DASH_LOG_TRACE("UnorderedMap._insert_at", "converting to global iterator",
-                   "unit:", unit, "lidx:", old_local_size);
-    result.first  = iterator(this, unit, old_local_size);
+                   "unit:", _myid, "lidx:", old_local_size);
+    result.first  = iterator(this, _myid, old_local_size);
     result.second = true;
-
-    if (unit != _myid) {
-      DASH_LOG_TRACE("UnorderedMap.insert", "remote insertion");
-      // Mark inserted element for move to remote unit in next commit:
-      _move_elements.push_back(result.first);
-    } else {
-      ++_lend;
-    }
+    ++_lend;
 
     // Update iterators as global memory space has been changed for the
     // active unit:
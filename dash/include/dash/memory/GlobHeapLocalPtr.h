@@ -207,6 +207,7 @@ public:
       // element is in bucket currently referenced by this iterator:
       return _bucket_it->lptr[_bucket_phase + offset];
     } else {
+      offset += _bucket_phase;
       // find bucket containing element at given offset:
       for (auto b_it = _bucket_it; b_it != _bucket_last; ++b_it) {
         if (offset >= b_it->size) {
@@ -393,6 +394,7 @@ private:
       // element is in bucket currently referenced by this iterator:
       _bucket_phase += offset;
     } else {
+      offset += _bucket_phase;
       // find bucket containing element at given offset:
       for (; _bucket_it != _bucket_last; ++_bucket_it) {
         if (offset >= _bucket_it->size) {
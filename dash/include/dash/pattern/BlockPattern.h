@@ -93,6 +93,8 @@ private:
     ViewSpec_t;
   typedef internal::PatternArguments<NumDimensions, IndexType>
     PatternArguments_t;
+  typedef std::array<dash::math::FastDivisor<IndexType>, NumDimensions>
+    Divisors_t;
 
 public:
   typedef IndexType   index_type;
@@ -123,6 +125,10 @@ private:
   MemoryLayout_t              _memory_layout;
   /// Maximum extents of a block in this pattern
   BlockSizeSpec_t             _blocksize_spec;
+  /// Precomputed divisors of the block extents in all dimensions
+  Divisors_t                  _blocksize_div;
+  /// Precomputed divisors of the team extents in all dimensions
+  Divisors_t                  _teamspec_div;
   /// Number of blocks in all dimensions
   BlockSpec_t                 _blockspec;
   /// A projected view of the global memory layout representing the
@@ -238,6 +244,10 @@ public:
     , _memory_layout(sizespec.extents())
     , _blocksize_spec(
           initialize_blocksizespec(sizespec, _distspec, _teamspec))
+    , _blocksize_div(
+          dash::math::make_divisors<IndexType>(_blocksize_spec.extents()))
+    , _teamspec_div(
+          dash::math::make_divisors<IndexType>(_teamspec.extents()))
     , _blockspec(initialize_blockspec(sizespec, _distspec, _blocksize_spec))
     , _local_memory_layout(initialize_local_extents(_team->myid()))
     , _local_blockspec(
@@ -299,6 +309,10 @@ public:
     , _memory_layout(sizespec.extents())
     , _blocksize_spec(
           initialize_blocksizespec(sizespec, _distspec, _teamspec))
+    , _blocksize_div(
+          dash::math::make_divisors<IndexType>(_blocksize_spec.extents()))
+    , _teamspec_div(
+          dash::math::make_divisors<IndexType>(_teamspec.extents()))
     , _blockspec(initialize_blockspec(sizespec, _distspec, _blocksize_spec))
     , _local_memory_layout(initialize_local_extents(_team->myid()))
     , _local_blockspec(
@@ -320,6 +334,8 @@ public:
     _nunits(other._nunits),
     _memory_layout(other._memory_layout),
     _blocksize_spec(other._blocksize_spec),
+    _blocksize_div(other._blocksize_div),
+    _teamspec_div(other._teamspec_div),
     _blockspec(other._blockspec),
     _local_memory_layout(other._local_memory_layout),
     _local_blockspec(other._local_blockspec),
@@ -387,6 +403,8 @@ public:
       _memory_layout       = other._memory_layout;
       _local_memory_layout = other._local_memory_layout;
       _blocksize_spec      = other._blocksize_spec;
+      _blocksize_div       = other._blocksize_div;
+      _teamspec_div        = other._teamspec_div;
       _blockspec           = other._blockspec;
       _local_blockspec     = other._local_blockspec;
       _local_capacity      = other._local_capacity;
@@ -452,8 +470,8 @@ public:
     std::array<IndexType, NumDimensions> unit_coords{};
     // Coord to block coord to unit coord:
     for (auto d = 0; d < NumDimensions; ++d) {
-      unit_coords[d] = (coords[d] / _blocksize_spec.extent(d))
-                         % _teamspec.extent(d);
+      unit_coords[d] = _teamspec_div[d].mod(
+                         _blocksize_div[d].div(coords[d]));
     }
     // Unit coord to unit id:
     team_unit_t unit_id(_teamspec.at(unit_coords));
@@ -660,9 +678,9 @@ public:
     std::array<IndexType, NumDimensions> local_coords{};
     for (auto d = 0; d < NumDimensions; ++d) {
       auto block_size_d     = _blocksize_spec.extent(d);
-      auto b_offset_d       = global_coords[d] % block_size_d;
-      auto g_block_offset_d = global_coords[d] / block_size_d;
-      auto l_block_offset_d = g_block_offset_d / _teamspec.extent(d);
+      auto b_offset_d       = _blocksize_div[d].mod(global_coords[d]);
+      auto g_block_offset_d = _blocksize_div[d].div(global_coords[d]);
+      auto l_block_offset_d = _teamspec_div[d].div(g_block_offset_d);
       local_coords[d]       = b_offset_d +
                               (l_block_offset_d * block_size_d);
     }
@@ -726,7 +744,7 @@ public:
       auto blocksize_d          = _blocksize_spec.extent(d);
       auto local_index_d        = local_coords[d];
       // TOOD: Use % (blocksize_d - underfill_d)
-      auto elem_block_offset_d  = local_index_d % blocksize_d;
+      auto elem_block_offset_d  = _blocksize_div[d].mod(local_index_d);
       // Global coords of the element's block within all blocks:
       auto block_index_d        = dist.local_index_to_block_coord(
                                     unit_ts_coord[d], // unit ts offset in d
@@ -939,10 +957,10 @@ public:
     // Apply viewspec offset in dimension to given position
     dim_offset += viewspec.offset(dim);
     // Offset to block offset
-    IndexType block_coord_d    = dim_offset / _blocksize_spec.extent(dim);
+    IndexType block_coord_d    = _blocksize_div[dim].div(dim_offset);
     DASH_LOG_TRACE_VAR("BlockPattern.has_local_elements", block_coord_d);
     // Coordinate of unit in team spec in given dimension
-    IndexType teamspec_coord_d = block_coord_d % _teamspec.extent(dim);
+    IndexType teamspec_coord_d = _teamspec_div[dim].mod(block_coord_d);
     DASH_LOG_TRACE_VAR("BlockPattern.has_local_elements()",
                        teamspec_coord_d);
     // Check if unit id lies in cartesian sub-space of team spec
@@ -1011,7 +1029,7 @@ public:
     std::array<index_type, NumDimensions> block_coords{};
     // Coord to block coord to unit coord:
     for (auto d = 0; d < NumDimensions; ++d) {
-      block_coords[d] = g_coords[d] / _blocksize_spec.extent(d);
+      block_coords[d] = _blocksize_div[d].div(g_coords[d]);
     }
     // Block coord to block index:
     auto block_idx = _blockspec.at(block_coords);
@@ -1035,11 +1053,9 @@ public:
     std::array<IndexType, NumDimensions> l_block_coords{};
     std::array<IndexType, NumDimensions> unit_ts_coords{};
     for (dim_t d = 0; d < NumDimensions; ++d) {
-      auto nunits_d      = _teamspec.extent(d);
-      auto blocksize_d   = _blocksize_spec.extent(d);
-      auto block_coord_d = g_coords[d] / blocksize_d;
-      l_block_coords[d]  = block_coord_d / nunits_d;
-      unit_ts_coords[d]  = block_coord_d % nunits_d;
+      auto block_coord_d = _blocksize_div[d].div(g_coords[d]);
+      l_block_coords[d]  = _teamspec_div[d].div(block_coord_d);
+      unit_ts_coords[d]  = _teamspec_div[d].mod(block_coord_d);
     }
     l_pos.unit  = _teamspec.at(unit_ts_coords);
     l_pos.index = _local_blockspec.at(l_block_coords);
@@ -1362,6 +1378,10 @@ private:
          arguments.sizespec(),
          _distspec,
          _teamspec)),
+     _blocksize_div(dash::math::make_divisors<IndexType>(
+         _blocksize_spec.extents())),
+     _teamspec_div(dash::math::make_divisors<IndexType>(
+         _teamspec.extents())),
      _blockspec(initialize_blockspec(
          arguments.sizespec(),
          _distspec,
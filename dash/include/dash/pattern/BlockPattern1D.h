@@ -87,6 +87,8 @@ private:
     ViewSpec_t;
   typedef internal::PatternArguments<NumDimensions, IndexType>
     PatternArguments_t;
+  typedef dash::math::FastDivisor<IndexType>
+    FastDivisor_t;
 
 public:
   typedef IndexType   index_type;
@@ -117,6 +119,10 @@ private:
   SizeType                    _nunits          = 0;
   /// Maximum extents of a block in this pattern
   SizeType                    _blocksize       = 0;
+  /// Precomputed divisor of the block size
+  FastDivisor_t               _blocksize_div;
+  /// Precomputed divisor of the number of units
+  FastDivisor_t               _nunits_div;
   /// Number of blocks in all dimensions
   SizeType                    _nblocks         = 0;
   /// Actual number of local elements.
@@ -214,6 +220,8 @@ public:
         _size,
         _distspec,
         _nunits)),
+    _blocksize_div(static_cast<IndexType>(_blocksize)),
+    _nunits_div(static_cast<IndexType>(_nunits)),
     _nblocks(initialize_num_blocks(
         _size,
         _blocksize,
@@ -271,6 +279,8 @@ public:
         _size,
         _distspec,
         _nunits)),
+    _blocksize_div(static_cast<IndexType>(_blocksize)),
+    _nunits_div(static_cast<IndexType>(_nunits)),
     _nblocks(initialize_num_blocks(
         _size,
         _blocksize,
@@ -381,8 +391,9 @@ public:
     const std::array<IndexType, NumDimensions> & coords,
     /// View specification (offsets) to apply on \c coords
     const ViewSpec_t & viewspec) const {
-    return team_unit_t (((coords[0] + viewspec.offset(0)) / _blocksize)
-                        % _nunits);
+    return team_unit_t(
+             _nunits_div.mod(
+               _blocksize_div.div(coords[0] + viewspec.offset(0))));
   }
 
   /**
@@ -392,7 +403,7 @@ public:
    */
   constexpr team_unit_t unit_at(
     const std::array<IndexType, NumDimensions> & coords) const {
-    return team_unit_t((coords[0] / _blocksize) % _nunits);
+    return team_unit_t(_nunits_div.mod(_blocksize_div.div(coords[0])));
   }
 
   /**
@@ -406,8 +417,9 @@ public:
     /// View to apply global position
     const ViewSpec_t & viewspec
   ) const {
-    return team_unit_t(((global_pos + viewspec.offset(0)) / _blocksize)
-                       % _nunits);
+    return team_unit_t(
+             _nunits_div.mod(
+               _blocksize_div.div(global_pos + viewspec.offset(0))));
   }
 
   /**
@@ -419,7 +431,7 @@ public:
     /// Global linear element offset
     IndexType global_pos
   ) const {
-    return team_unit_t((global_pos / _blocksize) % _nunits);
+    return team_unit_t(_nunits_div.mod(_blocksize_div.div(global_pos)));
   }
 
   ////////////////////////////////////////////////////////////////////////////
@@ -603,8 +615,9 @@ public:
   ) const noexcept {
     return std::array<IndexType, 1> {{
              static_cast<IndexType>(
-               (((global_coords[0] / _blocksize) / _nunits) * _blocksize)
-               + (global_coords[0] % _blocksize)
+               (_nunits_div.div(_blocksize_div.div(global_coords[0]))
+                * _blocksize)
+               + _blocksize_div.mod(global_coords[0])
              )
            }};
   }
@@ -643,7 +656,7 @@ public:
                        local_coords[0],
                        _nunits)
                    ) * _blocksize)
-                  + (local_coords[0] % _blocksize)
+                  + _blocksize_div.mod(local_coords[0])
                 )
               }};
   }
@@ -838,7 +851,7 @@ public:
   constexpr index_type block_at(
     /// Global coordinates of element
     const std::array<index_type, NumDimensions> & g_coords) const {
-    return g_coords[0] / _blocksize;
+    return _blocksize_div.div(g_coords[0]);
   }
 
   /**
@@ -852,10 +865,10 @@ public:
     return local_index_t {
              // unit id:
              static_cast<team_unit_t>(
-                (g_coords[0] / _blocksize) % _teamspec.size()),
+                _blocksize_div.div(g_coords[0]) % _teamspec.size()),
              // local block index:
              static_cast<index_type>(
-                (g_coords[0] / _blocksize) / _teamspec.size())
+                _blocksize_div.div(g_coords[0]) / _teamspec.size())
            };
   }
 
@@ -1121,6 +1134,8 @@ private:
          _size,
          _distspec,
          _nunits)),
+     _blocksize_div(static_cast<IndexType>(_blocksize)),
+     _nunits_div(static_cast<IndexType>(_nunits)),
      _nblocks(initialize_num_blocks(
          _size,
          _blocksize,
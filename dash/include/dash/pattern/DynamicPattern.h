@@ -1,9 +1,12 @@
 #ifndef DASH__DYNAMIC_PATTERN_H__INCLUDED
 #define DASH__DYNAMIC_PATTERN_H__INCLUDED
 
+#include <algorithm>
 #include <functional>
 #include <array>
+#include <numeric>
 #include <type_traits>
+#include <vector>
 
 #include <dash/Types.h>
 #include <dash/Distribution.h>
@@ -11,11 +14,11 @@
 #include <dash/Dimensional.h>
 #include <dash/Cartesian.h>
 #include <dash/Team.h>
-#include <dash/PatternProperties.h>
+#include <dash/pattern/PatternProperties.h>
 
 #include <dash/internal/Math.h>
 #include <dash/internal/Logging.h>
-#include <dash/internal/PatternArguments.h>
+#include <dash/pattern/internal/PatternArguments.h>
 
 namespace dash {
 
@@ -483,9 +486,162 @@ public:
   /**
    * Balance the number of local elements across all units in the pattern's
    * associated team.
+   *
+   * Collective operation.
+   * Local sizes updated in \c local_resize are published to all units
+   * before the balanced distribution is computed, units are therefore only
+   * required to resize their own local range.
    */
   inline void balance()
   {
+    balance(std::vector<double>());
+  }
+
+  /**
+   * Balance the number of local elements across all units in the pattern's
+   * associated team proportional to the given unit weights, for example
+   * obtained from \c dash::UnitClockFreqMeasure::unit_weights.
+   *
+   * Collective operation.
+   */
+  void balance(
+    /// Relative weight of every unit in the team, elements are distributed
+    /// evenly if empty.
+    const std::vector<double> & unit_weights)
+  {
+    DASH_LOG_TRACE("DynamicPattern.balance()");
+    auto l_sizes = gather_local_sizes(_local_sizes[_myid]);
+    update_local_sizes(
+      balanced_local_sizes(initialize_size(l_sizes), unit_weights));
+    DASH_LOG_TRACE_VAR("DynamicPattern.balance >", _local_sizes);
+  }
+
+  /**
+   * Balance the elements in global dynamic memory across all units in the
+   * pattern's associated team and migrate elements between units such that
+   * their global order is preserved.
+   *
+   * Local ranges are staged in symmetric global memory from which every
+   * unit reads the elements in its new local range using a single bulk
+   * one-sided transfer per previous owner. The pattern's local sizes are
+   * updated to the resulting distribution.
+   *
+   * Collective operation, also commits pending changes of \c globmem.
+   */
+  template <
+    class GlobMemType,
+    typename = typename std::enable_if<
+                 !std::is_same<GlobMemType, std::vector<double>>::value
+               >::type >
+  void balance(
+    /// Global dynamic memory containing the pattern's elements, for example
+    /// \c dash::GlobHeapMem.
+    GlobMemType               & globmem,
+    /// Relative weight of every unit in the team, elements are distributed
+    /// evenly if empty.
+    const std::vector<double> & unit_weights = std::vector<double>())
+  {
+    typedef typename GlobMemType::value_type value_t;
+
+    DASH_LOG_TRACE("DynamicPattern.balance(globmem)");
+    DASH_ASSERT_EQ(globmem.team().dart_id(), _team->dart_id(),
+                   "global memory and pattern must use the same team");
+    // Attach local memory allocated since the last commit such that it is
+    // accessible by other units:
+    globmem.commit();
+
+    auto const old_sizes   = gather_local_sizes(globmem.local_size());
+    auto const old_offsets = initialize_block_offsets(old_sizes);
+    auto const new_sizes   = balanced_local_sizes(
+                               initialize_size(old_sizes), unit_weights);
+
+    if (new_sizes == old_sizes) {
+      update_local_sizes(new_sizes);
+      DASH_LOG_TRACE("DynamicPattern.balance(globmem) >", "balanced");
+      return;
+    }
+
+    auto const new_offsets = initialize_block_offsets(new_sizes);
+    size_type const g_begin = new_offsets[_myid];
+    size_type const g_end   = g_begin + new_sizes[_myid];
+
+    // Global pointers to buckets of global dynamic memory are resolved from
+    // the calling unit's bucket list, so remote local ranges are staged in
+    // symmetric memory to read them in a single transfer per source unit:
+    size_type const max_old = *std::max_element(old_sizes.begin(),
+                                                 old_sizes.end());
+    dash::dart_storage<value_t> ds_stage(std::max<size_type>(max_old, 1));
+    dart_gptr_t stage_gptr = DART_GPTR_NULL;
+    DASH_ASSERT_RETURNS(
+      dart_team_memalloc_aligned(
+        _team->dart_id(), ds_stage.nelem, ds_stage.dtype, &stage_gptr),
+      DART_OK);
+    dart_gptr_t l_stage_gptr = stage_gptr;
+    DASH_ASSERT_RETURNS(
+      dart_gptr_setunit(&l_stage_gptr, _myid),
+      DART_OK);
+    value_t * l_stage = nullptr;
+    DASH_ASSERT_RETURNS(
+      dart_gptr_getaddr(l_stage_gptr, reinterpret_cast<void **>(&l_stage)),
+      DART_OK);
+    std::copy(globmem.lbegin(), globmem.lend(), l_stage);
+    _team->barrier();
+
+    // Fetch elements of the new local range from their current owners:
+    std::vector<value_t>       l_buf(new_sizes[_myid]);
+    std::vector<dart_handle_t> handles;
+    for (size_type u = 0; u < _nunits; ++u) {
+      size_type const src_begin = std::max(g_begin, old_offsets[u]);
+      size_type const src_end   = std::min(g_end,
+                                           old_offsets[u] + old_sizes[u]);
+      if (src_begin >= src_end) {
+        continue;
+      }
+      size_type const src_offset = src_begin - old_offsets[u];
+      value_t * dest = l_buf.data() + (src_begin - g_begin);
+      if (u == static_cast<size_type>(_myid)) {
+        std::copy(l_stage + src_offset, l_stage + src_offset
+                                        + (src_end - src_begin), dest);
+        continue;
+      }
+      dart_gptr_t src_gptr = stage_gptr;
+      DASH_ASSERT_RETURNS(
+        dart_gptr_setunit(&src_gptr, team_unit_t(u)),
+        DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_gptr_incaddr(&src_gptr, src_offset * sizeof(value_t)),
+        DART_OK);
+      dash::dart_storage<value_t> ds(src_end - src_begin);
+      dart_handle_t handle;
+      DASH_ASSERT_RETURNS(
+        dart_get_handle(
+          dest, src_gptr, ds.nelem, ds.dtype, ds.dtype, &handle),
+        DART_OK);
+      handles.push_back(handle);
+    }
+    DASH_LOG_TRACE_VAR("DynamicPattern.balance(globmem)", handles.size());
+    DASH_ASSERT_RETURNS(
+      dart_waitall_local(handles.data(), handles.size()),
+      DART_OK);
+    // Staging memory must not be released before all units completed
+    // reading from it:
+    _team->barrier();
+    DASH_ASSERT_RETURNS(
+      dart_team_memfree(stage_gptr),
+      DART_OK);
+
+    size_type const l_size_old = old_sizes[_myid];
+    size_type const l_size_new = new_sizes[_myid];
+    if (l_size_new > l_size_old) {
+      globmem.grow(l_size_new - l_size_old);
+    } else if (l_size_new < l_size_old) {
+      globmem.shrink(l_size_old - l_size_new);
+    }
+    std::copy(l_buf.begin(), l_buf.end(), globmem.lbegin());
+    globmem.commit();
+
+    update_local_sizes(new_sizes);
+    DASH_LOG_TRACE_VAR("DynamicPattern.balance(globmem) >", _local_sizes);
   }
 
   ////////////////////////////////////////////////////////////////////////////
@@ -1127,7 +1283,10 @@ public:
   inline SizeType local_size(
     team_unit_t unit = UNDEFINED_TEAM_UNIT_ID) const
   {
-    return _local_size;
+    if (unit == UNDEFINED_TEAM_UNIT_ID) {
+      unit = _myid;
+    }
+    return _local_sizes[unit];
   }
 
   /**
@@ -1470,6 +1629,88 @@ private:
     DASH_LOG_DEBUG_VAR("DynamicPattern.init_local_range >", _lend);
   }
 
+  /**
+   * Exchange the local size of the active unit with all units in the team.
+   */
+  std::vector<size_type> gather_local_sizes(size_type local_size) const
+  {
+    std::vector<size_type> l_sizes(_nunits);
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        &local_size,
+        l_sizes.data(),
+        1,
+        dash::dart_datatype<size_type>::value,
+        _team->dart_id()),
+      DART_OK);
+    DASH_LOG_TRACE_VAR("DynamicPattern.gather_local_sizes >", l_sizes);
+    return l_sizes;
+  }
+
+  /**
+   * Local sizes of a balanced distribution of \c total_size elements,
+   * proportional to the given unit weights or evenly if no weights are
+   * specified.
+   */
+  std::vector<size_type> balanced_local_sizes(
+    size_type                   total_size,
+    const std::vector<double> & unit_weights) const
+  {
+    std::vector<size_type> l_sizes(_nunits, 0);
+    if (_nunits == 0) {
+      return l_sizes;
+    }
+    if (unit_weights.empty()) {
+      auto const nbase = total_size / _nunits;
+      auto const nrest = total_size % _nunits;
+      for (size_type u = 0; u < _nunits; ++u) {
+        l_sizes[u] = nbase + (u < nrest ? 1 : 0);
+      }
+      return l_sizes;
+    }
+    DASH_ASSERT_EQ(unit_weights.size(), _nunits,
+                   "number of unit weights does not match number of units");
+    double const weights_sum = std::accumulate(
+                                 unit_weights.begin(), unit_weights.end(),
+                                 0.0);
+    DASH_ASSERT_GT(weights_sum, 0, "sum of unit weights must be positive");
+    // Rounding prefix sums instead of single weights keeps the total size:
+    double    weights_psum = 0;
+    size_type offset       = 0;
+    for (size_type u = 0; u < _nunits; ++u) {
+      weights_psum += unit_weights[u];
+      size_type offset_next = (u == _nunits - 1)
+                              ? total_size
+                              : std::min<size_type>(
+                                  total_size,
+                                  static_cast<size_type>(
+                                    total_size * weights_psum / weights_sum
+                                    + 0.5));
+      offset_next = std::max(offset, offset_next);
+      l_sizes[u]  = offset_next - offset;
+      offset      = offset_next;
+    }
+    return l_sizes;
+  }
+
+  /**
+   * Update the local sizes of all units and the pattern properties derived
+   * from them.
+   */
+  void update_local_sizes(const std::vector<size_type> & local_sizes)
+  {
+    _local_sizes         = local_sizes;
+    _size                = initialize_size(_local_sizes);
+    _block_offsets       = initialize_block_offsets(_local_sizes);
+    _memory_layout       = MemoryLayout_t(std::array<SizeType, 1> { _size });
+    _blockspec           = initialize_blockspec(_size, _local_sizes);
+    _local_size          = initialize_local_extent(_myid);
+    _local_memory_layout = LocalMemoryLayout_t(
+                             std::array<SizeType, 1> { _local_size });
+    _local_capacity      = initialize_local_capacity();
+    initialize_local_range();
+  }
+
   /**
    * Resolve extents of local memory layout for a specified unit.
    */
@@ -99,6 +99,10 @@ private:
     ViewSpec_t;
   typedef internal::PatternArguments<NumDimensions, IndexType>
     PatternArguments_t;
+  typedef dash::math::FastDivisor<IndexType>
+    FastDivisor_t;
+  typedef std::array<FastDivisor_t, NumDimensions>
+    Divisors_t;
 
 public:
   typedef IndexType   index_type;
@@ -131,6 +135,12 @@ private:
   SizeType                    _nunits          = dash::Team::All().size();
   /// Maximum extents of a block in this pattern
   BlockSizeSpec_t             _blocksize_spec;
+  /// Precomputed divisors of the block extents in all dimensions
+  Divisors_t                  _blocksize_div;
+  /// Precomputed divisors of the team extents in all dimensions
+  Divisors_t                  _teamspec_div;
+  /// Precomputed divisor of the number of elements in a block
+  FastDivisor_t               _blocksize_size_div;
   /// Arrangement of blocks in all dimensions
   BlockSpec_t                 _blockspec;
   /// Arrangement of local blocks in all dimensions
@@ -248,6 +258,12 @@ public:
     , _nunits(_teamspec.size())
     , _blocksize_spec(
           initialize_blocksizespec(sizespec, _distspec, _teamspec))
+    , _blocksize_div(
+          dash::math::make_divisors<IndexType>(_blocksize_spec.extents()))
+    , _teamspec_div(
+          dash::math::make_divisors<IndexType>(_teamspec.extents()))
+    , _blocksize_size_div(
+          static_cast<IndexType>(_blocksize_spec.size()))
     , _blockspec(initialize_blockspec(sizespec, _blocksize_spec, _teamspec))
     , _local_blockspec(
           initialize_local_blockspec(_blockspec, _blocksize_spec, _teamspec))
@@ -308,6 +324,12 @@ public:
     , _nunits(_teamspec.size())
     , _blocksize_spec(
           initialize_blocksizespec(sizespec, _distspec, _teamspec))
+    , _blocksize_div(
+          dash::math::make_divisors<IndexType>(_blocksize_spec.extents()))
+    , _teamspec_div(
+          dash::math::make_divisors<IndexType>(_teamspec.extents()))
+    , _blocksize_size_div(
+          static_cast<IndexType>(_blocksize_spec.size()))
     , _blockspec(initialize_blockspec(sizespec, _blocksize_spec, _teamspec))
     , _local_blockspec(
           initialize_local_blockspec(_blockspec, _blocksize_spec, _teamspec))
@@ -411,8 +433,8 @@ public:
     for (auto d = 0; d < NumDimensions; ++d) {
       auto vs_coord      = coords[d] + viewspec.offset(d);
       // Global block coordinate:
-      block_coords[d]   = vs_coord / _blocksize_spec.extent(d);
-      unit_ts_coords[d] = block_coords[d] % _teamspec.extent(d);
+      block_coords[d]   = _blocksize_div[d].div(vs_coord);
+      unit_ts_coords[d] = _teamspec_div[d].mod(block_coords[d]);
     }
     team_unit_t unit_id(_teamspec.at(unit_ts_coords));
     DASH_LOG_TRACE_VAR("TilePattern.unit_at", block_coords);
@@ -437,8 +459,8 @@ public:
     // e.g (x + y + z) % nunits
     for (auto d = 0; d < NumDimensions; ++d) {
       // Global block coordinate:
-      block_coords[d]   = coords[d] / _blocksize_spec.extent(d);
-      unit_ts_coords[d] = block_coords[d] % _teamspec.extent(d);
+      block_coords[d]   = _blocksize_div[d].div(coords[d]);
+      unit_ts_coords[d] = _teamspec_div[d].mod(block_coords[d]);
     }
     team_unit_t unit_id(_teamspec.at(unit_ts_coords));
     DASH_LOG_TRACE_VAR("TilePattern.unit_at", block_coords);
@@ -569,9 +591,8 @@ public:
     for (auto d = 0; d < NumDimensions; ++d) {
       auto vs_offset_d  = viewspec.offset(d);
       auto vs_coord_d   = local_coords[d] + vs_offset_d;
-      auto block_size_d = _blocksize_spec.extent(d);
-      phase_coords[d]   = vs_coord_d % block_size_d;
-      block_coords_l[d] = vs_coord_d / block_size_d;
+      phase_coords[d]   = _blocksize_div[d].mod(vs_coord_d);
+      block_coords_l[d] = _blocksize_div[d].div(vs_coord_d);
     }
     DASH_LOG_TRACE("TilePattern.local_at",
                    "local_coords:",       local_coords);
@@ -612,9 +633,8 @@ public:
     std::array<IndexType, NumDimensions> block_coords_l{};
     for (auto d = 0; d < NumDimensions; ++d) {
       auto gcoord_d     = local_coords[d];
-      auto block_size_d = _blocksize_spec.extent(d);
-      phase_coords[d]   = gcoord_d % block_size_d;
-      block_coords_l[d] = gcoord_d / block_size_d;
+      phase_coords[d]   = _blocksize_div[d].mod(gcoord_d);
+      block_coords_l[d] = _blocksize_div[d].div(gcoord_d);
     }
     DASH_LOG_TRACE("TilePattern.local_at",
                    "local_coords:",       local_coords,
@@ -644,12 +664,11 @@ public:
     std::array<IndexType, NumDimensions> local_coords{};
     std::array<IndexType, NumDimensions> unit_ts_coords{};
     for (dim_t d = 0; d < NumDimensions; ++d) {
-      auto nunits_d        = _teamspec.extent(d);
       auto blocksize_d     = _blocksize_spec.extent(d);
-      auto block_coord_d   = global_coords[d] / blocksize_d;
-      auto phase_d         = global_coords[d] % blocksize_d;
-      auto l_block_coord_d = block_coord_d / nunits_d;
-      unit_ts_coords[d]    = block_coord_d % nunits_d;
+      auto block_coord_d   = _blocksize_div[d].div(global_coords[d]);
+      auto phase_d         = _blocksize_div[d].mod(global_coords[d]);
+      auto l_block_coord_d = _teamspec_div[d].div(block_coord_d);
+      unit_ts_coords[d]    = _teamspec_div[d].mod(block_coord_d);
       local_coords[d]      = (l_block_coord_d * blocksize_d) + phase_d;
     }
     l_coords.unit   = _teamspec.at(unit_ts_coords);
@@ -684,11 +703,10 @@ public:
   {
     std::array<IndexType, NumDimensions> local_coords{};
     for (dim_t d = 0; d < NumDimensions; ++d) {
-      auto nunits_d        = _teamspec.extent(d);
       auto blocksize_d     = _blocksize_spec.extent(d);
-      auto block_coord_d   = global_coords[d] / blocksize_d;
-      auto phase_d         = global_coords[d] % blocksize_d;
-      auto l_block_coord_d = block_coord_d / nunits_d;
+      auto block_coord_d   = _blocksize_div[d].div(global_coords[d]);
+      auto phase_d         = _blocksize_div[d].mod(global_coords[d]);
+      auto l_block_coord_d = _teamspec_div[d].div(block_coord_d);
       local_coords[d]      = (l_block_coord_d * blocksize_d) + phase_d;
     }
     return local_coords;
@@ -727,9 +745,8 @@ public:
       std::array<IndexType, NumDimensions> block_coords_l{};
       for (auto d = 0; d < NumDimensions; ++d) {
         auto gcoord_d     = l_coords[d];
-        auto block_size_d = _blocksize_spec.extent(d);
-        phase_coords[d]   = gcoord_d % block_size_d;
-        block_coords_l[d] = gcoord_d / block_size_d;
+        phase_coords[d]   = _blocksize_div[d].mod(gcoord_d);
+        block_coords_l[d] = _blocksize_div[d].div(gcoord_d);
       }
       DASH_LOG_TRACE("TilePattern.local_index",
                      "local_coords:",       l_coords,
@@ -770,8 +787,8 @@ public:
     for (dim_t d = 0; d < NumDimensions; ++d) {
       auto blocksize_d     = _blocksize_spec.extent(d);
       auto nunits_d        = _teamspec.extent(d);
-      auto phase           = local_coords[d] % blocksize_d;
-      auto l_block_coord_d = local_coords[d] / blocksize_d;
+      auto phase           = _blocksize_div[d].mod(local_coords[d]);
+      auto l_block_coord_d = _blocksize_div[d].div(local_coords[d]);
       auto g_block_coord_d = (l_block_coord_d * nunits_d) +
                              unit_ts_coords[d];
       global_coords[d]     = (g_block_coord_d * blocksize_d) + phase;
@@ -804,9 +821,8 @@ public:
     DASH_LOG_TRACE("TilePattern.global()",
                    "local_index:", local_index,
                    "unit:",        _myid);
-    auto block_size    = _blocksize_spec.size();
-    auto phase         = local_index % block_size;
-    auto l_block_index = local_index / block_size;
+    auto phase         = _blocksize_size_div.mod(local_index);
+    auto l_block_index = _blocksize_size_div.div(local_index);
     // Block coordinate in local memory:
     auto l_block_coord = _local_blockspec.coords(l_block_index);
     // Coordinate of element in block:
@@ -877,8 +893,8 @@ public:
     std::array<IndexType, NumDimensions> block_coords{};
     for (auto d = 0; d < NumDimensions; ++d) {
       auto vs_coord     = global_coords[d] + viewspec.offset(d);
-      phase_coords[d]   = vs_coord % _blocksize_spec.extent(d);
-      block_coords[d]   = vs_coord / _blocksize_spec.extent(d);
+      phase_coords[d]   = _blocksize_div[d].mod(vs_coord);
+      block_coords[d]   = _blocksize_div[d].div(vs_coord);
     }
     DASH_LOG_TRACE("TilePattern.global_at",
                    "block coords:", block_coords,
@@ -919,8 +935,8 @@ public:
 
     for (auto d = 0; d < NumDimensions; ++d) {
       auto vs_coord     = global_coords[d];
-      phase_coords[d]   = vs_coord % _blocksize_spec.extent(d);
-      block_coords[d]   = vs_coord / _blocksize_spec.extent(d);
+      phase_coords[d]   = _blocksize_div[d].mod(vs_coord);
+      block_coords[d]   = _blocksize_div[d].div(vs_coord);
     }
     DASH_LOG_TRACE("TilePattern.global_at",
                    "block coords:", block_coords,
@@ -961,11 +977,10 @@ public:
     // Local coordinates of the block containing the element:
     std::array<IndexType, NumDimensions> l_block_coords;
     for (auto d = 0; d < NumDimensions; ++d) {
-      auto nunits_d     = _teamspec.extent(d);
       auto vs_coord     = global_coords[d] + viewspec.offset(d);
-      phase_coords[d]   = vs_coord % _blocksize_spec.extent(d);
-      block_coords[d]   = vs_coord / _blocksize_spec.extent(d);
-      l_block_coords[d] = block_coords[d] / nunits_d;
+      phase_coords[d]   = _blocksize_div[d].mod(vs_coord);
+      block_coords[d]   = _blocksize_div[d].div(vs_coord);
+      l_block_coords[d] = _teamspec_div[d].div(block_coords[d]);
     }
     index_type l_block_index = _local_blockspec.at(l_block_coords);
     DASH_LOG_TRACE("TilePattern.at",
@@ -998,11 +1013,10 @@ public:
     // Local coordinates of the block containing the element:
     std::array<IndexType, NumDimensions> l_block_coords{};
     for (auto d = 0; d < NumDimensions; ++d) {
-      auto nunits_d     = _teamspec.extent(d);
       auto gcoord_d     = global_coords[d];
-      phase_coords[d]   = gcoord_d % _blocksize_spec.extent(d);
-      block_coords[d]   = gcoord_d / _blocksize_spec.extent(d);
-      l_block_coords[d] = block_coords[d] / nunits_d;
+      phase_coords[d]   = _blocksize_div[d].mod(gcoord_d);
+      block_coords[d]   = _blocksize_div[d].div(gcoord_d);
+      l_block_coords[d] = _teamspec_div[d].div(block_coords[d]);
     }
     index_type l_block_index = _local_blockspec.at(l_block_coords);
     DASH_LOG_TRACE("TilePattern.at",
@@ -1062,10 +1076,10 @@ public:
     // Apply viewspec offset in dimension to given position
     dim_offset += viewspec.offset(dim);
     // Offset to block offset
-    IndexType block_coord_d    = dim_offset / _blocksize_spec.extent(dim);
+    IndexType block_coord_d    = _blocksize_div[dim].div(dim_offset);
     DASH_LOG_TRACE_VAR("TilePattern.has_local_elements", block_coord_d);
     // Coordinate of unit in team spec in given dimension
-    IndexType teamspec_coord_d = block_coord_d % _teamspec.extent(dim);
+    IndexType teamspec_coord_d = _teamspec_div[dim].mod(block_coord_d);
     DASH_LOG_TRACE_VAR("TilePattern.has_local_elements",
                        teamspec_coord_d);
     // Check if unit id lies in cartesian sub-space of team spec
@@ -1118,7 +1132,7 @@ public:
     std::array<index_type, NumDimensions> block_coords{};
     // Coord to block coord to unit coord:
     for (auto d = 0; d < NumDimensions; ++d) {
-      block_coords[d] = g_coords[d] / _blocksize_spec.extent(d);
+      block_coords[d] = _blocksize_div[d].div(g_coords[d]);
     }
     // Block coord to block index:
     auto block_idx = _blockspec.at(block_coords);
@@ -1142,11 +1156,9 @@ public:
     std::array<IndexType, NumDimensions> l_block_coords{};
     std::array<IndexType, NumDimensions> unit_ts_coords{};
     for (dim_t d = 0; d < NumDimensions; ++d) {
-      auto nunits_d      = _teamspec.extent(d);
-      auto blocksize_d   = _blocksize_spec.extent(d);
-      auto block_coord_d = g_coords[d] / blocksize_d;
-      l_block_coords[d]  = block_coord_d / nunits_d;
-      unit_ts_coords[d]  = block_coord_d % nunits_d;
+      auto block_coord_d = _blocksize_div[d].div(g_coords[d]);
+      l_block_coords[d]  = _teamspec_div[d].div(block_coord_d);
+      unit_ts_coords[d]  = _teamspec_div[d].mod(block_coord_d);
     }
     l_pos.unit  = _teamspec.at(unit_ts_coords);
     l_pos.index = _local_blockspec.at(l_block_coords);
@@ -1438,8 +1450,9 @@ public:
     IndexType index) const {
 
     ::std::array<IndexType, NumDimensions> pos{};
-    auto block_coords = _blockspec.coords(index / _blocksize_spec.size());
-    auto phase_coords = _blocksize_spec.coords(index % _blocksize_spec.size());
+    auto block_coords = _blockspec.coords(_blocksize_size_div.div(index));
+    auto phase_coords = _blocksize_spec.coords(
+                          _blocksize_size_div.mod(index));
     for (auto d = 0; d < NumDimensions; ++d) {
       pos[d] = block_coords[d]*_blocksize_spec.extent(d) + phase_coords[d];
     }
@@ -1459,9 +1472,9 @@ public:
     const ViewSpec_t & viewspec) const {
 
     ::std::array<IndexType, NumDimensions> pos;
-    auto block_coords = _blockspec.coords(index / _blocksize_spec.size(),
+    auto block_coords = _blockspec.coords(_blocksize_size_div.div(index),
                                           viewspec);
-    auto phase_coords = _blocksize_spec.coords(index % _blocksize_spec.size(),
+    auto phase_coords = _blocksize_spec.coords(_blocksize_size_div.mod(index),
                                                viewspec);
     for (auto d = 0; d < NumDimensions; ++d) {
       pos[d] = block_coords[d]*_blocksize_spec.extent(d) + phase_coords[d];
@@ -1497,6 +1510,11 @@ private:
         arguments.sizespec(),
         _distspec,
         _teamspec)),
+    _blocksize_div(dash::math::make_divisors<IndexType>(
+        _blocksize_spec.extents())),
+    _teamspec_div(dash::math::make_divisors<IndexType>(
+        _teamspec.extents())),
+    _blocksize_size_div(static_cast<IndexType>(_blocksize_spec.size())),
     _blockspec(initialize_blockspec(
         arguments.sizespec(),
         _blocksize_spec,
@@ -64,6 +64,13 @@ public:
 
   void print_pinning();
 
+  /**
+   * Prints the maximum duration of the locality initialization phases in
+   * \c dash::init over all units.
+   * Collective operation, must be called by all units.
+   */
+  void print_locality_init();
+
   void print_section_start(const std::string & section_name) const;
   void print_section_end() const;
 
@@ -0,0 +1,166 @@
+#ifndef DASH__UTIL__COMM_STATS_H__INCLUDED
+#define DASH__UTIL__COMM_STATS_H__INCLUDED
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_stats.h>
+
+#include <dash/Team.h>
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+namespace dash {
+namespace util {
+
+/**
+ * Snapshot of the DART communication statistics counters of a unit or,
+ * when reduced, of a team.
+ *
+ * Counters are only recorded while statistics are enabled, either with
+ * \c CommStats::enable() or by setting the environment variable
+ * \c DART_ENABLE_STATS before \c dash::init.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::util::CommStats::enable();
+ *   // ... access containers ...
+ *   auto stats = dash::util::CommStats().reduce(dash::Team::All());
+ *   if (dash::myid() == 0) {
+ *     stats.dump(std::cout);
+ *   }
+ * \endcode
+ */
+class CommStats
+{
+private:
+  typedef CommStats self_t;
+
+public:
+  typedef dart_stats_op_t       op_t;
+  typedef dart_stats_path_t     path_t;
+  typedef dart_stats_counters_t counters_t;
+
+  static constexpr int num_ops   = DART_STATS_NUM_OPS;
+  static constexpr int num_paths = DART_STATS_NUM_PATHS;
+
+public:
+  /**
+   * Enable recording of communication statistics at the calling unit.
+   */
+  static void enable();
+
+  /**
+   * Disable recording of communication statistics at the calling unit.
+   */
+  static void disable();
+
+  /**
+   * Whether communication statistics are recorded at the calling unit.
+   */
+  static bool enabled();
+
+  /**
+   * Reset the communication statistics counters of the calling unit.
+   */
+  static void reset();
+
+  /**
+   * Name of a communication operation, e.g. \c "get_handle".
+   */
+  static std::string op_name(op_t op);
+
+public:
+  /**
+   * Creates a snapshot of the counters of the calling unit.
+   */
+  CommStats();
+
+  CommStats(const self_t &)            = default;
+  self_t & operator=(const self_t &)   = default;
+
+  /**
+   * Counters of the given communication operation.
+   */
+  inline const counters_t & operator[](op_t op) const
+  {
+    return _ops[op];
+  }
+
+  /**
+   * Maximum number of bytes of the given operation transferred by a single
+   * unit. Equal to \c operator[](op).bytes unless the snapshot is reduced.
+   */
+  inline uint64_t max_bytes(op_t op) const
+  {
+    return _max_bytes[op];
+  }
+
+  /**
+   * Number of one-sided and point-to-point operations by global target
+   * unit.
+   */
+  inline const std::vector<uint64_t> & target_calls() const
+  {
+    return _target_calls;
+  }
+
+  /**
+   * Number of bytes transferred in one-sided and point-to-point operations
+   * by global target unit.
+   */
+  inline const std::vector<uint64_t> & target_bytes() const
+  {
+    return _target_bytes;
+  }
+
+  /**
+   * Total number of calls of all operations.
+   */
+  uint64_t calls() const;
+
+  /**
+   * Total number of bytes transferred in all operations.
+   */
+  uint64_t bytes() const;
+
+  /**
+   * Total number of bytes transferred in all operations on the given path.
+   */
+  uint64_t bytes(path_t path) const;
+
+  /**
+   * Number of units the snapshot has been accumulated from.
+   */
+  inline int num_units() const
+  {
+    return _num_units;
+  }
+
+  /**
+   * Collective operation on all units in \c team, sums the counters of
+   * all units in the team.
+   */
+  self_t reduce(dash::Team & team = dash::Team::All()) const;
+
+  /**
+   * Write a table of counters of all operations that have been called and
+   * the target unit histogram to the given stream.
+   */
+  void dump(std::ostream & os) const;
+
+private:
+  std::vector<counters_t> _ops;
+  std::vector<uint64_t>   _max_bytes;
+  std::vector<uint64_t>   _target_calls;
+  std::vector<uint64_t>   _target_bytes;
+  int                     _num_units = 1;
+};
+
+} // namespace util
+} // namespace dash
+
+#endif // DASH__UTIL__COMM_STATS_H__INCLUDED
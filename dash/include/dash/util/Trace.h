@@ -3,33 +3,134 @@
 
 #include <dash/Init.h>
 #include <dash/util/Timer.h>
+#include <dash/util/internal/TimestampCounterPosix.h>
+
+#include <atomic>
+#include <cstdint>
 #include <iostream>
-#include <fstream>
-#include <sstream>
-#include <iomanip>
+#include <memory>
 #include <string>
-#include <utility>
-#include <vector>
 
 namespace dash {
 namespace util {
 
+/**
+ * Fixed-size binary trace record.
+ */
+struct trace_record_t
+{
+  /// Timestamp counter value (TSC) at the event.
+  uint64_t timestamp;
+  /// Interned identifier of the event name.
+  uint32_t event;
+  /// Interned identifier of the trace context.
+  uint16_t context;
+  /// Event type, one of \c TraceStore::event_type.
+  uint16_t type;
+  /// User-defined payload words.
+  uint64_t payload[2];
+};
+
+/**
+ * Single-producer ring buffer of trace records of a single thread.
+ * The oldest records are overwritten if the buffer capacity is exceeded.
+ */
+class TraceBuffer
+{
+public:
+  TraceBuffer(int thread_id, std::size_t capacity);
+
+  inline void push(const trace_record_t & record)
+  {
+    uint64_t head = _head.load(std::memory_order_relaxed);
+    _records[head & _mask] = record;
+    _head.store(head + 1, std::memory_order_release);
+  }
+
+  /**
+   * Number of records in the buffer.
+   */
+  inline std::size_t size() const
+  {
+    uint64_t head = _head.load(std::memory_order_acquire);
+    return head < _capacity ? head : _capacity;
+  }
+
+  /**
+   * Number of records that have been overwritten.
+   */
+  inline std::size_t dropped() const
+  {
+    uint64_t head = _head.load(std::memory_order_acquire);
+    return head < _capacity ? 0 : head - _capacity;
+  }
+
+  /**
+   * Record at the given offset from the oldest record in the buffer.
+   */
+  inline trace_record_t & operator[](std::size_t offset)
+  {
+    return _records[(dropped() + offset) & _mask];
+  }
+
+  inline const trace_record_t & operator[](std::size_t offset) const
+  {
+    return _records[(dropped() + offset) & _mask];
+  }
+
+  inline int thread_id() const
+  {
+    return _thread_id;
+  }
+
+  inline std::size_t capacity() const
+  {
+    return _capacity;
+  }
+
+  inline void clear()
+  {
+    _head.store(0, std::memory_order_release);
+  }
+
+private:
+  std::unique_ptr<trace_record_t[]> _records;
+  std::size_t                       _capacity;
+  uint64_t                          _mask;
+  std::atomic<uint64_t>             _head;
+  int                               _thread_id;
+};
+
+/**
+ * Per-unit store of trace records.
+ *
+ * Every thread records events into its own ring buffer of fixed-size binary
+ * records, event names and contexts are interned. Recording an event does
+ * not allocate or synchronize once the name has been interned by the
+ * thread.
+ *
+ * Tracing is enabled if the configuration parameter \c DASH_ENABLE_TRACE
+ * is set. The capacity of the ring buffers in number of records per thread
+ * is set in \c DASH_TRACE_BUFFER_SIZE (default: 65536).
+ * In \c dash::finalize, recorded trace data are written to files
+ * \c uNNNNN.trace.json (Chrome trace event format) and \c uNNNNN.trace.bin
+ * in the directory specified in \c DASH_TRACE_LOG_PATH.
+ */
 class TraceStore
 {
 public:
-  typedef std::string
+  typedef const char *
     state_t;
-  typedef dash::util::Timer<dash::util::TimeMeasure::Clock>
-    timer_t;
-  typedef typename timer_t::timestamp_t
+  typedef uint64_t
     timestamp_t;
-  typedef struct {
-    timestamp_t start{};
-    timestamp_t end{};
-    state_t     state;
-  } state_timespan_t;
-  typedef std::vector<state_timespan_t>
-    trace_events_t;
+  typedef dash::util::internal::TimestampCounterPosix
+    counter_t;
+
+  enum event_type : uint16_t {
+    EVENT_BEGIN   = 0,
+    EVENT_END     = 1,
+    EVENT_INSTANT = 2
+  };
 
 public:
   /**
@@ -48,30 +149,72 @@ public:
   /**
    * Whether trace storage is enabled.
    */
-  static bool enabled();
+  static inline bool enabled()
+  {
+    return _trace_enabled.load(std::memory_order_relaxed);
+  }
 
   /**
    * Clear trace data.
+   * Must not be called while other threads record events.
    */
   static void clear();
 
   /**
    * Clear trace data of given context.
+   * Must not be called while other threads record events.
    */
   static void clear(const std::string & context);
 
   /**
    * Register a new trace context.
+   *
+   * \returns  The interned identifier of the context.
    */
-  static void add_context(const std::string & context);
+  static uint16_t add_context(const std::string & context);
 
   /**
-   * Return reference to traces list for given context.
+   * Interned identifier of an event or context name.
+   *
+   * Names are cached by address, the name string must not be modified
+   * while tracing is enabled (usually a string literal).
    */
-  static trace_events_t & context_trace(const std::string & context);
+  static inline uint32_t intern(const char * name)
+  {
+    // Names are cached by their address so interning string literals
+    // does not allocate after their first use in the thread:
+    auto & entry = _intern_cache[
+                     (reinterpret_cast<std::uintptr_t>(name) >> 3)
+                     & (intern_cache_size - 1)];
+    if (entry.name != name) {
+      entry.id   = intern_name(name);
+      entry.name = name;
+    }
+    return entry.id;
+  }
 
   /**
-   * Write trace data to given output stream.
+   * Append a record to the trace buffer of the calling thread.
+   */
+  static inline void record(
+    uint16_t   context,
+    uint32_t   event,
+    event_type type,
+    uint64_t   payload_0 = 0,
+    uint64_t   payload_1 = 0)
+  {
+    trace_record_t rec;
+    rec.timestamp  = counter_t::ArchCycleCount();
+    rec.event      = event;
+    rec.context    = context;
+    rec.type       = type;
+    rec.payload[0] = payload_0;
+    rec.payload[1] = payload_1;
+    local_buffer().push(rec);
+  }
+
+  /**
+   * Write trace data to given output stream as CSV of state time spans.
    */
   static void write(std::ostream & out, bool printHeader = true);
 
@@ -82,65 +225,140 @@ public:
     const std::string & filename,
     const std::string & path = "");
 
+  /**
+   * Write trace data to given output stream in Chrome trace event format.
+   */
+  static void write_chrome_json(std::ostream & out);
+
+  /**
+   * Write trace data to given output stream in compact binary format:
+   *
+   * - magic \c "DASHTRC1", unit id (int32), counter ticks per microsecond
+   *   (double), counter value at trace start (uint64)
+   * - number of interned names (uint32), for every name its length
+   *   (uint32) and characters
+   * - number of thread buffers (uint32), for every buffer the thread id
+   *   (int32), number of records (uint64) and the records
+   */
+  static void write_binary(std::ostream & out);
+
+  /**
+   * Write trace data of the unit to files if tracing is configured, called
+   * in \c dash::finalize.
+   */
+  static void finalize();
+
 private:
-  static std::map<std::string, trace_events_t> _traces;
-  static bool                                  _trace_enabled;
+  static TraceBuffer & local_buffer()
+  {
+    if (nullptr == _local_buffer) {
+      _local_buffer = register_buffer();
+    }
+    return *_local_buffer;
+  }
+
+  static TraceBuffer * register_buffer();
+
+  static uint32_t intern_name(const char * name);
+
+private:
+  static constexpr std::size_t intern_cache_size = 64;
+
+  struct intern_cache_entry {
+    const char * name;
+    uint32_t     id;
+  };
+
+  static std::atomic<bool>                     _trace_enabled;
+  static thread_local TraceBuffer            * _local_buffer;
+  static thread_local intern_cache_entry       _intern_cache[
+                                                 intern_cache_size];
 };
 
 class Trace
 {
 private:
-  typedef typename TraceStore::timestamp_t
-    timestamp_t;
   typedef typename TraceStore::state_t
     state_t;
-  typedef typename TraceStore::timer_t
-    timer_t;
-  typedef typename TraceStore::state_timespan_t
-    state_timespan_t;
-  typedef typename TraceStore::trace_events_t
-    trace_events_t;
 
 private:
-  std::string _context;
-  timestamp_t _ts_start;
+  uint16_t _context = 0;
 
 public:
   Trace() : Trace("global")
   { }
 
-  Trace(std::string context)
-    : _context(std::move(context))
+  Trace(const char * context)
   {
     if (!TraceStore::enabled()) {
       return;
     }
-    TraceStore::add_context(_context);
-    timer_t::Calibrate(0);
-    dash::barrier();
-    _ts_start = timer_t::Now();
+    _context = static_cast<uint16_t>(TraceStore::intern(context));
   }
 
-  inline void enter_state(const state_t & state)
+  Trace(const std::string & context)
   {
     if (!TraceStore::enabled()) {
       return;
     }
-    state_timespan_t state_timespan;
-    timestamp_t ts_event = timer_t::Now() - _ts_start;
-    state_timespan.start = ts_event;
-    state_timespan.end   = ts_event;
-    state_timespan.state = state;
-    TraceStore::context_trace(_context).push_back(state_timespan);
+    _context = TraceStore::add_context(context);
   }
 
-  inline void exit_state(const state_t &)
+  inline void enter_state(
+    state_t  state,
+    uint64_t payload_0 = 0,
+    uint64_t payload_1 = 0)
+  {
+    if (!TraceStore::enabled()) {
+      return;
+    }
+    TraceStore::record(_context, TraceStore::intern(state),
+                       TraceStore::EVENT_BEGIN, payload_0, payload_1);
+  }
+
+  inline void exit_state(
+    state_t  state,
+    uint64_t payload_0 = 0,
+    uint64_t payload_1 = 0)
+  {
+    if (!TraceStore::enabled()) {
+      return;
+    }
+    TraceStore::record(_context, TraceStore::intern(state),
+                       TraceStore::EVENT_END, payload_0, payload_1);
+  }
+
+  inline void enter_state(const std::string & state)
+  {
+    if (!TraceStore::enabled()) {
+      return;
+    }
+    TraceStore::record(_context, TraceStore::add_context(state),
+                       TraceStore::EVENT_BEGIN);
+  }
+
+  inline void exit_state(const std::string & state)
+  {
+    if (!TraceStore::enabled()) {
+      return;
+    }
+    TraceStore::record(_context, TraceStore::add_context(state),
+                       TraceStore::EVENT_END);
+  }
+
+  /**
+   * Record an instant event without duration.
+   */
+  inline void event(
+    state_t  state,
+    uint64_t payload_0 = 0,
+    uint64_t payload_1 = 0)
   {
     if (!TraceStore::enabled()) {
       return;
     }
-    timestamp_t ts_event = timer_t::Now() - _ts_start;
-    TraceStore::context_trace(_context).back().end = ts_event;
+    TraceStore::record(_context, TraceStore::intern(state),
+                       TraceStore::EVENT_INSTANT, payload_0, payload_1);
   }
 
 };
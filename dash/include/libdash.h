@@ -58,6 +58,7 @@ namespace dash {
 #include <dash/util/BenchmarkParams.h>
 #include <dash/util/Config.h>
 #include <dash/util/Trace.h>
+#include <dash/util/CommStats.h>
 #include <dash/util/PatternMetrics.h>
 #include <dash/util/Timer.h>
 
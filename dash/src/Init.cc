@@ -6,6 +6,7 @@
 
 #include <dash/util/Locality.h>
 #include <dash/util/Config.h>
+#include <dash/util/Trace.h>
 #include <dash/internal/Logging.h>
 
 #include <dash/internal/Annotation.h>
@@ -68,6 +69,9 @@ void dash::init(int * argc, char ** *argv)
 
   DASH_LOG_DEBUG("dash::init", "dash::util::Locality::init()");
   dash::util::Locality::init();
+
+  DASH_LOG_DEBUG("dash::init", "dash::util::TraceStore::on()");
+  dash::util::TraceStore::on();
   DASH_LOG_DEBUG("dash::init >");
 }
 
@@ -84,6 +88,10 @@ void dash::finalize()
   // Wait for all units:
   dash::barrier();
 
+  // Write trace data recorded at this unit:
+  DASH_LOG_DEBUG("dash::finalize", "write trace data");
+  dash::util::TraceStore::finalize();
+
   // Deallocate global memory allocated in teams:
   DASH_LOG_DEBUG("dash::finalize", "free team global memory");
   dash::Team::finalize();
@@ -37,6 +37,13 @@ void mmult_local<float>(
   long long     m,
   long long     n,
   long long     k,
+  /// Leading dimension of A, the number of elements between successive
+  /// rows (for row major storage) or columns (for column major storage).
+  long long     lda,
+  /// Leading dimension of B.
+  long long     ldb,
+  /// Leading dimension of C.
+  long long     ldc,
   MemArrange    storage)
 {
   typedef float value_t;
@@ -48,15 +55,6 @@ void mmult_local<float>(
   /// multiplication.
   auto   tp_a  = CblasNoTrans;
   auto   tp_b  = CblasNoTrans;
-  /// Leading dimension of A, or the number of elements between successive
-  /// rows (for row major storage) in memory.
-  auto   lda   = k;
-  /// Leading dimension of B, or the number of elements between successive
-  /// rows (for row major storage) in memory.
-  auto   ldb   = n;
-  /// Leading dimension of B, or the number of elements between successive
-  /// rows (for row major storage) in memory.
-  auto   ldc   = n;
   /// Real value used to scale the product of matrices A and B.
   value_t alpha = 1.0;
   /// Real value used to scale matrix C.
@@ -102,6 +100,13 @@ void mmult_local<double>(
   long long      m,
   long long      n,
   long long      k,
+  /// Leading dimension of A, the number of elements between successive
+  /// rows (for row major storage) or columns (for column major storage).
+  long long      lda,
+  /// Leading dimension of B.
+  long long      ldb,
+  /// Leading dimension of C.
+  long long      ldc,
   MemArrange     storage)
 {
   typedef double value_t;
@@ -113,15 +118,6 @@ void mmult_local<double>(
   /// multiplication.
   auto   tp_a  = CblasNoTrans;
   auto   tp_b  = CblasNoTrans;
-  /// Leading dimension of A, or the number of elements between successive
-  /// rows (for row major storage) in memory.
-  auto   lda   = k;
-  /// Leading dimension of B, or the number of elements between successive
-  /// rows (for row major storage) in memory.
-  auto   ldb   = n;
-  /// Leading dimension of B, or the number of elements between successive
-  /// rows (for row major storage) in memory.
-  auto   ldc   = n;
   /// Real value used to scale the product of matrices A and B.
   value_t alpha = 1.0;
   /// Real value used to scale matrix C.
@@ -14,6 +14,9 @@
 #include <dash/Array.h>
 #include <dash/Version.h>
 
+#include <dash/dart/if/dart_locality.h>
+#include <dash/dart/if/dart_communication.h>
+
 // Environment variables as array of strings, terminated by null pointer.
 extern char ** environ;
 
@@ -239,6 +242,37 @@ void BenchmarkParams::print_pinning()
   print_section_end();
 }
 
+void BenchmarkParams::print_locality_init()
+{
+  dart_locality_init_timing_t timing;
+  DASH_ASSERT_RETURNS(
+    dart_locality_init_timing(&timing),
+    DART_OK);
+
+  double phases_us[5] = { timing.node_topology_us,
+                          timing.unit_mapping_us,
+                          timing.host_topology_us,
+                          timing.domain_hierarchy_us,
+                          timing.total_us };
+  double phases_max_us[5];
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      phases_us, phases_max_us, 5, DART_TYPE_DOUBLE, DART_OP_MAX,
+      DART_TEAM_ALL),
+    DART_OK);
+
+  if (_myid != 0) {
+    return;
+  }
+  print_section_start("Locality Initialization (max. us)");
+  print_param("node topology",    phases_max_us[0]);
+  print_param("unit mapping",     phases_max_us[1]);
+  print_param("host topology",    phases_max_us[2]);
+  print_param("domain hierarchy", phases_max_us[3]);
+  print_param("total",            phases_max_us[4]);
+  print_section_end();
+}
+
 void BenchmarkParams::print_section_start(
   const std::string & section_name) const
 {
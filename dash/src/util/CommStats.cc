@@ -0,0 +1,186 @@
+#include <dash/util/CommStats.h>
+
+#include <dash/Exception.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <iomanip>
+#include <sstream>
+
+
+namespace dash {
+namespace util {
+
+void CommStats::enable()
+{
+  DASH_ASSERT_RETURNS(
+    dart_stats_enable(true),
+    DART_OK);
+}
+
+void CommStats::disable()
+{
+  DASH_ASSERT_RETURNS(
+    dart_stats_enable(false),
+    DART_OK);
+}
+
+bool CommStats::enabled()
+{
+  bool enabled = false;
+  DASH_ASSERT_RETURNS(
+    dart_stats_enabled(&enabled),
+    DART_OK);
+  return enabled;
+}
+
+void CommStats::reset()
+{
+  DASH_ASSERT_RETURNS(
+    dart_stats_reset(),
+    DART_OK);
+}
+
+std::string CommStats::op_name(op_t op)
+{
+  const char * name = nullptr;
+  DASH_ASSERT_RETURNS(
+    dart_stats_op_name(op, &name),
+    DART_OK);
+  return name;
+}
+
+CommStats::CommStats()
+: _ops(num_ops),
+  _max_bytes(num_ops),
+  _target_calls(dash::Team::All().size()),
+  _target_bytes(dash::Team::All().size())
+{
+  for (int op = 0; op < num_ops; ++op) {
+    DASH_ASSERT_RETURNS(
+      dart_stats_op(static_cast<op_t>(op), &_ops[op]),
+      DART_OK);
+    _max_bytes[op] = _ops[op].bytes;
+  }
+  DASH_ASSERT_RETURNS(
+    dart_stats_target_histogram(
+      _target_calls.data(), _target_bytes.data(), _target_calls.size()),
+    DART_OK);
+}
+
+uint64_t CommStats::calls() const
+{
+  uint64_t total = 0;
+  for (const auto & op_counters : _ops) {
+    total += op_counters.calls;
+  }
+  return total;
+}
+
+uint64_t CommStats::bytes() const
+{
+  uint64_t total = 0;
+  for (const auto & op_counters : _ops) {
+    total += op_counters.bytes;
+  }
+  return total;
+}
+
+uint64_t CommStats::bytes(path_t path) const
+{
+  uint64_t total = 0;
+  for (const auto & op_counters : _ops) {
+    total += op_counters.path_bytes[path];
+  }
+  return total;
+}
+
+CommStats CommStats::reduce(dash::Team & team) const
+{
+  static_assert(sizeof(counters_t) % sizeof(uint64_t) == 0,
+                "counters must consist of 64-bit values only");
+  static_assert(sizeof(unsigned long long) == sizeof(uint64_t),
+                "DART_TYPE_ULONGLONG must match uint64_t");
+
+  constexpr size_t counters_nelem = sizeof(counters_t) / sizeof(uint64_t);
+
+  CommStats result(*this);
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      _ops.data(), result._ops.data(),
+      num_ops * counters_nelem,
+      DART_TYPE_ULONGLONG, DART_OP_SUM, team.dart_id()),
+    DART_OK);
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      _max_bytes.data(), result._max_bytes.data(),
+      num_ops,
+      DART_TYPE_ULONGLONG, DART_OP_MAX, team.dart_id()),
+    DART_OK);
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      _target_calls.data(), result._target_calls.data(),
+      _target_calls.size(),
+      DART_TYPE_ULONGLONG, DART_OP_SUM, team.dart_id()),
+    DART_OK);
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      _target_bytes.data(), result._target_bytes.data(),
+      _target_bytes.size(),
+      DART_TYPE_ULONGLONG, DART_OP_SUM, team.dart_id()),
+    DART_OK);
+  int num_units = _num_units;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &num_units, &result._num_units, 1,
+      DART_TYPE_INT, DART_OP_SUM, team.dart_id()),
+    DART_OK);
+  return result;
+}
+
+void CommStats::dump(std::ostream & os) const
+{
+  std::ostringstream ss;
+  ss << "-- communication statistics of " << _num_units << " unit(s)"
+     << std::endl
+     << std::setw(18) << std::left  << "op"
+     << std::setw(10) << std::right << "calls"
+     << std::setw(14) << "bytes"
+     << std::setw(14) << "max.bytes"
+     << std::setw(10) << "local"
+     << std::setw(10) << "shmem"
+     << std::setw(10) << "mpi"
+     << std::endl;
+  for (int op = 0; op < num_ops; ++op) {
+    const counters_t & c = _ops[op];
+    if (c.calls == 0) {
+      continue;
+    }
+    ss << std::setw(18) << std::left  << op_name(static_cast<op_t>(op))
+       << std::setw(10) << std::right << c.calls
+       << std::setw(14) << c.bytes
+       << std::setw(14) << _max_bytes[op]
+       << std::setw(10) << c.path_calls[DART_STATS_PATH_LOCAL]
+       << std::setw(10) << c.path_calls[DART_STATS_PATH_SHMEM]
+       << std::setw(10) << c.path_calls[DART_STATS_PATH_MPI]
+       << std::endl;
+  }
+  ss << "-- targets" << std::endl
+     << std::setw(18) << std::left  << "unit"
+     << std::setw(10) << std::right << "calls"
+     << std::setw(14) << "bytes"
+     << std::endl;
+  for (size_t unit = 0; unit < _target_calls.size(); ++unit) {
+    if (_target_calls[unit] == 0) {
+      continue;
+    }
+    ss << std::setw(18) << std::left  << unit
+       << std::setw(10) << std::right << _target_calls[unit]
+       << std::setw(14) << _target_bytes[unit]
+       << std::endl;
+  }
+  os << ss.str();
+}
+
+} // namespace util
+} // namespace dash
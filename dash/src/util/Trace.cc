@@ -2,95 +2,279 @@
 #include <dash/util/Config.h>
 #include <dash/Team.h>
 
-#include <map>
+#include <algorithm>
+#include <chrono>
+#include <mutex>
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <iomanip>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <unistd.h>
 
-std::map<std::string, dash::util::TraceStore::trace_events_t>
-dash::util::TraceStore::_traces
-  = {{ }};
 
-bool dash::util::TraceStore::_trace_enabled
-  = false;
+namespace dash {
+namespace util {
 
-bool dash::util::TraceStore::on()
+namespace {
+
+/// Default capacity of trace buffers in number of records per thread.
+constexpr std::size_t default_trace_buffer_size = 1 << 16;
+
+/// Mutex protecting registration of buffers and interned names.
+std::mutex                                    trace_mutex;
+/// Trace buffers of all threads, in registration order.
+std::vector<std::unique_ptr<TraceBuffer>>     trace_buffers;
+/// Interned names, indexed by their identifier.
+std::vector<std::string>                      trace_names = { "" };
+std::unordered_map<std::string, uint32_t>     trace_name_ids;
+
+/// Timestamp counter and wall clock at trace start, used to convert
+/// counter values to microseconds.
+uint64_t                                      trace_start_ticks = 0;
+std::chrono::steady_clock::time_point         trace_start_time;
+bool                                          trace_started     = false;
+
+void start_trace_clock()
 {
-  _trace_enabled = dash::util::Config::get<bool>("DASH_ENABLE_TRACE");
-  return _trace_enabled;
+  trace_start_time  = std::chrono::steady_clock::now();
+  trace_start_ticks = TraceStore::counter_t::ArchCycleCount();
+  trace_started     = true;
 }
 
-void dash::util::TraceStore::off()
+/**
+ * Counter ticks per microsecond, measured against the steady clock since
+ * trace start.
+ */
+double trace_ticks_per_us()
 {
-  _trace_enabled = false;
+  auto     now_time  = std::chrono::steady_clock::now();
+  uint64_t now_ticks = TraceStore::counter_t::ArchCycleCount();
+  double   elapsed_us = std::chrono::duration<double, std::micro>(
+                          now_time - trace_start_time).count();
+  if (!trace_started || elapsed_us <= 0 || now_ticks <= trace_start_ticks) {
+    return 1.0;
+  }
+  return static_cast<double>(now_ticks - trace_start_ticks) / elapsed_us;
 }
 
-bool dash::util::TraceStore::enabled()
+inline double trace_time_us(uint64_t ticks, double ticks_per_us)
 {
-  return _trace_enabled == true;
+  return (static_cast<double>(ticks) -
+          static_cast<double>(trace_start_ticks)) / ticks_per_us;
 }
 
-void dash::util::TraceStore::clear()
+void write_json_string(std::ostream & out, const std::string & str)
 {
-  _traces.clear();
+  out << '"';
+  for (char c : str) {
+    switch (c) {
+      case '"':  out << "\\\""; break;
+      case '\\': out << "\\\\"; break;
+      case '\n': out << "\\n";  break;
+      case '\t': out << "\\t";  break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+              << static_cast<int>(c) << std::dec << std::setfill(' ');
+        } else {
+          out << c;
+        }
+    }
+  }
+  out << '"';
 }
 
-void dash::util::TraceStore::clear(const std::string & context)
+template <typename T>
+void write_raw(std::ostream & out, const T & value)
 {
-  _traces[context].clear();
+  out.write(reinterpret_cast<const char *>(&value), sizeof(T));
 }
 
-void dash::util::TraceStore::add_context(const std::string & context)
+std::string trace_file_path(const std::string & filename)
 {
-  if (_traces.count(context) == 0) {
-    _traces[context] = trace_events_t();
+  std::string trace_log_dir = ".";
+  if (dash::util::Config::is_set("DASH_TRACE_LOG_PATH")) {
+    trace_log_dir = dash::util::Config::get<std::string>(
+                      "DASH_TRACE_LOG_PATH");
+  }
+  auto unit = dash::Team::GlobalUnitID();
+  std::ostringstream fn;
+  fn << trace_log_dir << "/"
+     << "u" << std::setfill('0') << std::setw(5) << unit
+     << "." << filename;
+  return fn.str();
+}
+
+} // namespace
+
+std::atomic<bool> TraceStore::_trace_enabled(false);
+
+thread_local TraceBuffer *
+TraceStore::_local_buffer = nullptr;
+
+thread_local TraceStore::intern_cache_entry
+TraceStore::_intern_cache[TraceStore::intern_cache_size] = { };
+
+TraceBuffer::TraceBuffer(int thread_id, std::size_t capacity)
+: _capacity(1),
+  _head(0),
+  _thread_id(thread_id)
+{
+  while (_capacity < capacity) {
+    _capacity <<= 1;
+  }
+  _mask    = _capacity - 1;
+  _records.reset(new trace_record_t[_capacity]);
+}
+
+bool TraceStore::on()
+{
+  bool enable = dash::util::Config::get<bool>("DASH_ENABLE_TRACE");
+  if (enable) {
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    if (!trace_started) {
+      start_trace_clock();
+    }
+  }
+  _trace_enabled.store(enable);
+  if (enable) {
+    // Allocate the trace buffer of the calling thread before the first
+    // event is recorded:
+    local_buffer();
+  }
+  return enable;
+}
+
+void TraceStore::off()
+{
+  _trace_enabled.store(false);
+}
+
+void TraceStore::clear()
+{
+  std::lock_guard<std::mutex> lock(trace_mutex);
+  for (auto & buffer : trace_buffers) {
+    buffer->clear();
+  }
+  start_trace_clock();
+}
+
+void TraceStore::clear(const std::string & context)
+{
+  std::lock_guard<std::mutex> lock(trace_mutex);
+  auto it = trace_name_ids.find(context);
+  if (it == trace_name_ids.end()) {
+    return;
+  }
+  uint16_t context_id = static_cast<uint16_t>(it->second);
+  // Records of the context are kept in the ring buffers but marked as
+  // unassigned to any context:
+  for (auto & buffer : trace_buffers) {
+    auto & buf = *buffer;
+    for (std::size_t r = 0; r < buf.size(); ++r) {
+      if (buf[r].context == context_id) {
+        buf[r].context = 0;
+        buf[r].event   = 0;
+      }
+    }
   }
 }
 
-dash::util::TraceStore::trace_events_t &
-dash::util::TraceStore::context_trace(const std::string & context)
+uint16_t TraceStore::add_context(const std::string & context)
 {
-  return _traces[context];
+  return static_cast<uint16_t>(intern_name(context.c_str()));
 }
 
-void dash::util::TraceStore::write(std::ostream & out, bool printHeader)
+uint32_t TraceStore::intern_name(const char * name)
+{
+  std::lock_guard<std::mutex> lock(trace_mutex);
+  auto it = trace_name_ids.find(name);
+  if (it != trace_name_ids.end()) {
+    return it->second;
+  }
+  uint32_t id = static_cast<uint32_t>(trace_names.size());
+  trace_names.push_back(name);
+  trace_name_ids.insert(std::make_pair(trace_names.back(), id));
+  return id;
+}
+
+TraceBuffer * TraceStore::register_buffer()
+{
+  std::size_t capacity = default_trace_buffer_size;
+  if (dash::util::Config::is_set("DASH_TRACE_BUFFER_SIZE")) {
+    capacity = std::max<std::size_t>(
+                 dash::util::Config::get<std::size_t>(
+                   "DASH_TRACE_BUFFER_SIZE"),
+                 1);
+  }
+  std::lock_guard<std::mutex> lock(trace_mutex);
+  trace_buffers.emplace_back(
+    new TraceBuffer(static_cast<int>(trace_buffers.size()), capacity));
+  return trace_buffers.back().get();
+}
+
+void TraceStore::write(std::ostream & out, bool printHeader)
 {
   if (!dash::util::Config::get<bool>("DASH_ENABLE_TRACE")) {
     return;
   }
 
+  std::lock_guard<std::mutex> lock(trace_mutex);
+  double ticks_per_us = trace_ticks_per_us();
+
   std::ostringstream os;
   auto unit   = dash::Team::GlobalUnitID();
-  for (auto context_traces : _traces) {
-    std::string      context = context_traces.first;
-    trace_events_t & events  = context_traces.second;
-
-    // Master prints CSV headers:
-    if (printHeader && unit == 0) {
-      os << "-- [TRACE] "
-         << std::setw(15) << "context"  << ","
-         << std::setw(5)  << "unit"     << ","
-         << std::setw(15) << "start"    << ","
-         << std::setw(15) << "end"      << ","
-         << std::setw(12) << "state"
-         << std::endl;
-    }
+  // Master prints CSV headers:
+  if (printHeader && unit == 0) {
+    os << "-- [TRACE] "
+       << std::setw(15) << "context"  << ","
+       << std::setw(5)  << "unit"     << ","
+       << std::setw(15) << "start"    << ","
+       << std::setw(15) << "end"      << ","
+       << std::setw(12) << "state"
+       << std::endl;
+  }
 
-    for (auto state_timespan : events) {
-      auto   start    = state_timespan.start;
-      auto   end      = state_timespan.end;
-      auto   state    = state_timespan.state;
+  for (auto & buffer : trace_buffers) {
+    const auto & buf = *buffer;
+    // Begin records of states not exited yet:
+    std::vector<const trace_record_t *> open_states;
+    for (std::size_t r = 0; r < buf.size(); ++r) {
+      const trace_record_t & rec = buf[r];
+      if (rec.event == 0) {
+        continue;
+      }
+      if (rec.type == EVENT_BEGIN) {
+        open_states.push_back(&rec);
+        continue;
+      }
+      const trace_record_t * begin = &rec;
+      if (rec.type == EVENT_END) {
+        auto match = std::find_if(
+                       open_states.rbegin(), open_states.rend(),
+                       [&](const trace_record_t * b) {
+                         return b->event   == rec.event &&
+                                b->context == rec.context;
+                       });
+        if (match == open_states.rend()) {
+          // Begin record has been overwritten:
+          continue;
+        }
+        begin = *match;
+        open_states.erase(std::next(match).base());
+      }
       os << "-- [TRACE] "
-         << std::setw(15) << std::fixed << context  << ", "
-         << std::setw(5)  << std::fixed << unit     << ", "
-         << std::setw(15) << std::fixed << start    << ", "
-         << std::setw(15) << std::fixed << end      << ", "
-         << std::setw(12) << std::fixed << state
+         << std::setw(15) << std::fixed << trace_names[rec.context] << ", "
+         << std::setw(5)  << std::fixed << unit                     << ", "
+         << std::setw(15) << std::fixed
+         << trace_time_us(begin->timestamp, ticks_per_us)           << ", "
+         << std::setw(15) << std::fixed
+         << trace_time_us(rec.timestamp, ticks_per_us)              << ", "
+         << std::setw(12) << std::fixed << trace_names[rec.event]
          << std::endl;
     }
   }
@@ -98,11 +282,11 @@ void dash::util::TraceStore::write(std::ostream & out, bool printHeader)
   out << os.str();
 }
 
-void dash::util::TraceStore::write(
+void TraceStore::write(
   const std::string & filename,
   const std::string & path)
 {
-	if (!dash::util::Config::get<bool>("DASH_ENABLE_TRACE")) {
+  if (!dash::util::Config::get<bool>("DASH_ENABLE_TRACE")) {
     return;
   }
 
@@ -126,3 +310,106 @@ void dash::util::TraceStore::write(
   write(out);
   out.close();
 }
+
+void TraceStore::write_chrome_json(std::ostream & out)
+{
+  std::lock_guard<std::mutex> lock(trace_mutex);
+  double ticks_per_us = trace_ticks_per_us();
+  auto   unit         = dash::Team::GlobalUnitID();
+
+  static const char * phases[] = { "B", "E", "i" };
+
+  out << "{\"traceEvents\":[";
+  bool first = true;
+  for (auto & buffer : trace_buffers) {
+    const auto & buf = *buffer;
+    for (std::size_t r = 0; r < buf.size(); ++r) {
+      const trace_record_t & rec = buf[r];
+      if (rec.event == 0 || rec.type > EVENT_INSTANT) {
+        continue;
+      }
+      out << (first ? "\n" : ",\n") << "{\"name\":";
+      write_json_string(out, trace_names[rec.event]);
+      out << ",\"cat\":";
+      write_json_string(out, trace_names[rec.context]);
+      out << ",\"ph\":\"" << phases[rec.type] << "\""
+          << ",\"ts\":" << std::fixed << std::setprecision(3)
+          << trace_time_us(rec.timestamp, ticks_per_us)
+          << ",\"pid\":" << unit
+          << ",\"tid\":" << buf.thread_id();
+      if (rec.type == EVENT_INSTANT) {
+        out << ",\"s\":\"t\"";
+      }
+      out << ",\"args\":{\"payload\":["
+          << rec.payload[0] << "," << rec.payload[1] << "]}}";
+      first = false;
+    }
+  }
+  out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+void TraceStore::write_binary(std::ostream & out)
+{
+  std::lock_guard<std::mutex> lock(trace_mutex);
+  double   ticks_per_us = trace_ticks_per_us();
+  int32_t  unit         = dash::Team::GlobalUnitID();
+
+  out.write("DASHTRC1", 8);
+  write_raw(out, unit);
+  write_raw(out, ticks_per_us);
+  write_raw(out, trace_start_ticks);
+
+  write_raw(out, static_cast<uint32_t>(trace_names.size()));
+  for (const auto & name : trace_names) {
+    write_raw(out, static_cast<uint32_t>(name.length()));
+    out.write(name.data(), name.length());
+  }
+
+  write_raw(out, static_cast<uint32_t>(trace_buffers.size()));
+  for (auto & buffer : trace_buffers) {
+    const auto & buf = *buffer;
+    write_raw(out, static_cast<int32_t>(buf.thread_id()));
+    write_raw(out, static_cast<uint64_t>(buf.size()));
+    // Records in the ring buffer are stored in up to two contiguous
+    // ranges:
+    std::size_t num_records = buf.size();
+    std::size_t first_range = std::min(
+                                num_records,
+                                buf.capacity() -
+                                  (buf.dropped() & (buf.capacity() - 1)));
+    out.write(reinterpret_cast<const char *>(&buf[0]),
+              first_range * sizeof(trace_record_t));
+    if (first_range < num_records) {
+      out.write(reinterpret_cast<const char *>(&buf[first_range]),
+                (num_records - first_range) * sizeof(trace_record_t));
+    }
+  }
+}
+
+void TraceStore::finalize()
+{
+  if (!dash::util::Config::get<bool>("DASH_ENABLE_TRACE")) {
+    return;
+  }
+  off();
+  bool has_records = false;
+  {
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    for (auto & buffer : trace_buffers) {
+      has_records |= (buffer->size() > 0);
+    }
+  }
+  if (!has_records) {
+    return;
+  }
+  std::ofstream json_out(trace_file_path("trace.json"));
+  write_chrome_json(json_out);
+  json_out.close();
+  std::ofstream bin_out(trace_file_path("trace.bin"),
+                        std::ios::out | std::ios::binary);
+  write_binary(bin_out);
+  bin_out.close();
+}
+
+} // namespace util
+} // namespace dash
@@ -1020,6 +1020,67 @@ TEST_F(CopyTest, MatrixToSmallerTeam)
   }
 }
 
+TEST_F(CopyTest, BlockingGlobalToGlobalPatterns)
+{
+  const size_t num_elem_per_unit = 23;
+  size_t num_elem_total          = _dash_size * num_elem_per_unit;
+
+  dash::Array<int> array_src(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_dst(num_elem_total, dash::BLOCKCYCLIC(3));
+
+  for (size_t l = 0; l < array_src.lsize(); ++l) {
+    array_src.local[l] = array_src.pattern().global(l);
+  }
+  std::fill(array_dst.lbegin(), array_dst.lend(), -1);
+  array_src.barrier();
+
+  // Shift the copied range by a few elements so source and destination
+  // chunks are not aligned:
+  const size_t offset = 2;
+  auto out_last = dash::copy(array_src.begin(),
+                             array_src.end() - offset,
+                             array_dst.begin() + offset);
+  EXPECT_EQ_U(array_dst.end(), out_last);
+
+  array_dst.barrier();
+
+  for (size_t l = 0; l < array_dst.lsize(); ++l) {
+    auto gidx = array_dst.pattern().global(l);
+    int expected = (gidx < offset) ? -1 : static_cast<int>(gidx - offset);
+    EXPECT_EQ_U(expected, array_dst.local[l]);
+  }
+  array_dst.barrier();
+}
+
+TEST_F(CopyTest, AsyncGlobalToGlobalPatterns)
+{
+  const size_t num_elem_per_unit = 17;
+  size_t num_elem_total          = _dash_size * num_elem_per_unit;
+
+  dash::Array<int> array_src(num_elem_total, dash::CYCLIC);
+  dash::Array<int> array_dst(num_elem_total, dash::BLOCKED);
+
+  for (size_t l = 0; l < array_src.lsize(); ++l) {
+    array_src.local[l] = array_src.pattern().global(l) + 1000;
+  }
+  array_src.barrier();
+
+  auto copy_fut = dash::copy_async(array_src.begin(),
+                                   array_src.end(),
+                                   array_dst.begin());
+  // Blocks until local completion of the transfers started by this unit:
+  auto out_last = copy_fut.get();
+  EXPECT_EQ_U(array_dst.end(), out_last);
+
+  array_dst.barrier();
+
+  for (size_t l = 0; l < array_dst.lsize(); ++l) {
+    auto gidx = array_dst.pattern().global(l);
+    EXPECT_EQ_U(static_cast<int>(gidx + 1000), array_dst.local[l]);
+  }
+  array_dst.barrier();
+}
+
 TEST_F(CopyTest, InputOutputTypeTest)
 {
   /* signed/unsigned and const conversion is permitted */
@@ -3,6 +3,7 @@
 
 #include <dash/Array.h>
 #include <dash/Team.h>
+#include <dash/algorithm/Fill.h>
 #include <dash/algorithm/Find.h>
 
 #include <limits>
@@ -323,3 +324,34 @@ TEST_F(FindTest, LessElementsThanUnits)
   array.barrier();
 }
 
+
+TEST_F(FindTest, ExecutionPolicies)
+{
+  // Large enough for local ranges to be split into multiple parts:
+  Array_t array(dash::size() * 5000 + 3);
+  dash::fill(array.begin(), array.end(), 0);
+  array.barrier();
+
+  // Two matches in the same unit's local range, the first is found:
+  auto find_pos = static_cast<index_t>(array.size() - 4000);
+  if (dash::myid() == 0) {
+    array[find_pos]        = 1;
+    array[find_pos + 3000] = 1;
+  }
+  array.barrier();
+
+  auto found = dash::find(dash::execution::par(4),
+                          array.begin(), array.end(), 1);
+  EXPECT_EQ_U(array.begin() + find_pos, found);
+
+  found = dash::find_if(dash::execution::par,
+                        array.begin(), array.end(),
+                        [](Element_t v) { return v > 0; });
+  EXPECT_EQ_U(array.begin() + find_pos, found);
+
+  found = dash::find(dash::execution::par(4),
+                     array.begin(), array.end(), 2);
+  EXPECT_EQ_U(array.end(), found);
+
+  array.barrier();
+}
@@ -166,3 +166,40 @@ TEST_F(ForEachTest, Lambdas)
                  });
 }
 
+
+TEST_F(ForEachTest, ExecutionPolicies)
+{
+  // Large enough for local ranges to be split into multiple parts:
+  dash::Array<int> array(dash::size() * 5000 + 3, dash::BLOCKCYCLIC(7));
+  dash::fill(array.begin(), array.end(), 0);
+  array.barrier();
+
+  // -- dash::for_each -------------------------------------------
+
+  dash::for_each(dash::execution::par(4), array.begin(), array.end(),
+                 [](int & el) {
+                   el += 100;
+                 });
+  dash::for_each(dash::execution::par_unseq, array.begin(), array.end(),
+                 [](int & el) {
+                   el += 10;
+                 });
+  for (auto lit = array.lbegin(); lit != array.lend(); ++lit) {
+    EXPECT_EQ_U(110, *lit);
+  }
+
+  // -- dash::for_each_with_index --------------------------------
+
+  dash::for_each_with_index(
+                 dash::execution::par, array.begin(), array.end(),
+                 [](int & el, index_t gindex) {
+                   el += gindex;
+                 });
+  array.barrier();
+  if (dash::myid() == 0) {
+    for (size_t i = 0; i < array.size(); ++i) {
+      EXPECT_EQ_U(110 + static_cast<int>(i), static_cast<int>(array[i]));
+    }
+  }
+  array.barrier();
+}
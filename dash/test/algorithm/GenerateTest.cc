@@ -55,3 +55,27 @@ TEST_F(GenerateTest, TestGenerateWithIndex)
     }
   }
 }
+
+TEST_F(GenerateTest, ExecutionPolicies)
+{
+  // Large enough for local ranges to be split into multiple parts:
+  Array_t array(dash::size() * 5000 + 3, dash::BLOCKCYCLIC(7));
+
+  dash::generate(dash::execution::par(4), array.begin(), array.end(),
+                 []() { return 17; });
+  for (auto lit = array.lbegin(); lit != array.lend(); ++lit) {
+    ASSERT_EQ_U(17, *lit);
+  }
+
+  dash::generate_with_index(
+    dash::execution::par, array.begin(), array.end(),
+    [](Array_t::index_type idx) { return 2 * idx; });
+  array.barrier();
+
+  if (dash::myid() == 0) {
+    for (size_t idx = 0; idx != array.size(); ++idx) {
+      ASSERT_EQ_U(idx * 2.0, array[idx]);
+    }
+  }
+  array.barrier();
+}
@@ -5,8 +5,10 @@
 #include "ReduceTest.h"
 
 #include <dash/Array.h>
+#include <dash/Matrix.h>
 #include <dash/algorithm/Reduce.h>
 #include <dash/algorithm/Fill.h>
+#include <dash/algorithm/Generate.h>
 
 #include <array>
 
@@ -154,3 +156,120 @@ TEST_F(ReduceTest, LocalStdIterator) {
 
   ASSERT_EQ_U(((dash::size()-1)*(dash::size())/2) * (1 + 2 + 3)  + 1, result);
 }
+
+TEST_F(ReduceTest, Async) {
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+  auto value = 2, start = 10;
+
+  dash::Array<int> target(num_elem_total, dash::BLOCKED);
+
+  dash::fill(target.begin(), target.end(), value);
+
+  dash::barrier();
+
+  auto fut_global = dash::reduce_async(target.begin(), target.end(), start);
+
+  int lvalue    = dash::myid();
+  auto fut_max  = dash::reduce_async(
+                    &lvalue, std::next(&lvalue), 0, dash::max<int>(), false);
+
+  // local range may be modified once the reduction has been started
+  lvalue = -1;
+
+  while (!fut_max.test()) { }
+  ASSERT_EQ_U(dash::size() - 1, fut_max.get());
+  ASSERT_EQ_U(num_elem_total * value + start, fut_global.get());
+}
+
+TEST_F(ReduceTest, ExecutionPolicies) {
+  // Large enough for local ranges to be split into multiple parts:
+  const size_t num_elem_local = 5000;
+  size_t num_elem_total       = _dash_size * num_elem_local + 3;
+
+  dash::Array<int> target(num_elem_total, dash::BLOCKCYCLIC(7));
+  dash::generate_with_index(target.begin(), target.end(),
+                            [](dash::default_index_t i) { return i; });
+  dash::barrier();
+
+  int result = dash::reduce(dash::execution::par(4),
+                            target.begin(), target.end(), 10);
+  ASSERT_EQ_U(num_elem_total * (num_elem_total - 1) / 2 + 10, result);
+
+  result = dash::reduce(dash::execution::par, target.begin() + 5,
+                        target.end(), 0, dash::max<int>());
+  ASSERT_EQ_U(num_elem_total - 1, result);
+
+  // Reduce the elements in a block of rows of a matrix:
+  dash::Matrix<int, 2> matrix(dash::size() * 100, 150);
+  dash::fill(matrix.begin(), matrix.end(), 1);
+  dash::barrier();
+
+  auto rows = matrix.sub<0>(3, dash::size() * 50);
+  result = dash::reduce(dash::execution::par(3), rows.begin(), rows.end(), 0);
+  ASSERT_EQ_U(dash::size() * 50 * 150, result);
+}
+
+TEST_F(ReduceTest, EmptyUnits) {
+  // Only the first unit holds elements:
+  dash::Array<int> target(1, dash::BLOCKED);
+  dash::fill(target.begin(), target.end(), 7);
+  dash::barrier();
+
+  int result = dash::reduce(target.begin(), target.end(), 10);
+  ASSERT_EQ_U(17, result);
+
+  result = dash::reduce(target.begin(), target.end(), 10, dash::min<int>());
+  ASSERT_EQ_U(7, result);
+
+  result = dash::reduce(target.begin(), target.end(), 3, dash::max<int>());
+  ASSERT_EQ_U(7, result);
+
+  double lvalue = 1.5;
+  auto lend     = (dash::myid() == 0) ? std::next(&lvalue) : &lvalue;
+  double dresult = dash::reduce(&lvalue, lend, 10.0, dash::min<double>(),
+                                false);
+  ASSERT_EQ_U(1.5, dresult);
+
+  // No unit holds elements in the range:
+  result = dash::reduce(target.begin(), target.begin(), 10);
+  ASSERT_EQ_U(10, result);
+}
+
+TEST_F(ReduceTest, RepeatedCustomOp) {
+  const size_t num_elem_local = 10;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> target(num_elem_total, dash::BLOCKED);
+  dash::generate_with_index(target.begin(), target.end(),
+                            [](dash::default_index_t i) { return i; });
+  dash::barrier();
+
+  // The custom reduction operation is created once and must invoke the
+  // binary operation instance of every reduction:
+  for (int mod = 2; mod < 7; ++mod) {
+    auto max_mod = [mod](int a, int b) {
+                     return std::max(a % mod, b % mod);
+                   };
+    int result = dash::reduce(target.begin(), target.end(), 0, max_mod);
+    ASSERT_EQ_U(mod - 1, result);
+  }
+
+  // Reductions in a split team use their own operation:
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  auto & team = dash::Team::All().split(2);
+  dash::Array<int> team_target(team.size() * num_elem_local,
+                               dash::BLOCKED, team);
+  dash::fill(team_target.begin(), team_target.end(), 5);
+  team.barrier();
+  for (int mod = 2; mod < 4; ++mod) {
+    auto max_mod = [mod](int a, int b) {
+                     return std::max(a % mod, b % mod);
+                   };
+    int result = dash::reduce(team_target.begin(), team_target.end(), 0,
+                              max_mod);
+    ASSERT_EQ_U(5 % mod, result);
+  }
+}
@@ -7,6 +7,7 @@
 
 #include <iomanip>
 #include <sstream>
+#include <vector>
 
 #define SKIP_TEST_IF_NO_SUMMA()           \
   auto conf = dash::util::DashConfig;     \
@@ -275,3 +276,116 @@ TEST_F(SUMMATest, SeqTilePatternMatrix)
 
   dash::barrier();
 }
+
+TEST_F(SUMMATest, LocalBlockedGEMM)
+{
+  typedef double value_t;
+
+  // Extents chosen to cover partial register tiles and multiple cache
+  // blocks in every dimension:
+  const long long m = 263;
+  const long long n = 77;
+  const long long k = 301;
+
+  std::vector<value_t> matrix_a(m * k);
+  std::vector<value_t> matrix_b(k * n);
+  for (long long i = 0; i < m * k; ++i) {
+    matrix_a[i] = static_cast<value_t>((i * 7) % 11) - 5;
+  }
+  for (long long i = 0; i < k * n; ++i) {
+    matrix_b[i] = static_cast<value_t>((i * 3) % 13) - 6;
+  }
+
+  for (auto storage : { dash::ROW_MAJOR, dash::COL_MAJOR }) {
+    std::vector<value_t> matrix_c(m * n, 1);
+    dash::internal::gemm_blocked(
+      matrix_a.data(), matrix_b.data(), matrix_c.data(), m, n, k, storage);
+
+    for (long long i = 0; i < m; ++i) {
+      for (long long j = 0; j < n; ++j) {
+        value_t expect = 1;
+        for (long long p = 0; p < k; ++p) {
+          expect += (storage == dash::ROW_MAJOR)
+                    ? matrix_a[i * k + p] * matrix_b[p * n + j]
+                    : matrix_a[p * m + i] * matrix_b[j * k + p];
+        }
+        value_t actual = (storage == dash::ROW_MAJOR)
+                         ? matrix_c[i * n + j]
+                         : matrix_c[j * m + i];
+        ASSERT_EQ_U(expect, actual);
+      }
+    }
+  }
+}
+
+TEST_F(SUMMATest, DeducedPatternProduct)
+{
+  SKIP_TEST_IF_NO_SUMMA();
+
+  typedef double value_t;
+
+  // Deduced blocks are not square for most team sizes, e.g. 20 x 40 for
+  // two units:
+  size_t num_units = dash::size();
+  size_t extent    = num_units * 20;
+  dash::SizeSpec<2> size_spec(extent, extent);
+  dash::TeamSpec<2> team_spec(num_units, 1);
+  team_spec.balance_extents();
+
+  auto pattern = dash::make_pattern<
+                   dash::summa_pattern_partitioning_constraints,
+                   dash::summa_pattern_mapping_constraints,
+                   dash::summa_pattern_layout_constraints
+                 >(size_spec,
+                   team_spec);
+
+  typedef decltype(pattern)              pattern_t;
+  typedef typename pattern_t::index_type index_t;
+
+  LOG_MESSAGE("Deduced pattern: tilesize(%lu,%lu)",
+              pattern.block(0).extent(0),
+              pattern.block(0).extent(1));
+
+  auto value_a = [](index_t row, index_t col) -> value_t {
+                   return static_cast<value_t>((row * 7 + col * 3) % 11);
+                 };
+  auto value_b = [](index_t row, index_t col) -> value_t {
+                   return static_cast<value_t>((row * 5 + col * 2) % 13);
+                 };
+
+  dash::Matrix<value_t, 2, index_t, pattern_t> matrix_a(pattern);
+  dash::Matrix<value_t, 2, index_t, pattern_t> matrix_b(pattern);
+  dash::Matrix<value_t, 2, index_t, pattern_t> matrix_c(pattern);
+
+  if (dash::myid().id == 0) {
+    for (index_t row = 0; row < static_cast<index_t>(extent); ++row) {
+      for (index_t col = 0; col < static_cast<index_t>(extent); ++col) {
+        matrix_a[row][col] = value_a(row, col);
+        matrix_b[row][col] = value_b(row, col);
+        matrix_c[row][col] = 0;
+      }
+    }
+  }
+  dash::barrier();
+
+  dash::mmult(matrix_a,
+              matrix_b,
+              matrix_c);
+
+  dash::barrier();
+
+  if (dash::myid().id == 0) {
+    for (index_t row = 0; row < static_cast<index_t>(extent); ++row) {
+      for (index_t col = 0; col < static_cast<index_t>(extent); ++col) {
+        value_t expect = 0;
+        for (index_t k = 0; k < static_cast<index_t>(extent); ++k) {
+          expect += value_a(row, k) * value_b(k, col);
+        }
+        value_t actual = matrix_c[row][col];
+        ASSERT_EQ_U(expect, actual);
+      }
+    }
+  }
+
+  dash::barrier();
+}
@@ -0,0 +1,179 @@
+
+#include "SegmentsTest.h"
+
+#include <dash/Array.h>
+#include <dash/Matrix.h>
+#include <dash/algorithm/Copy.h>
+#include <dash/algorithm/Fill.h>
+#include <dash/algorithm/Find.h>
+#include <dash/algorithm/ForEach.h>
+#include <dash/algorithm/Segments.h>
+
+#include <vector>
+
+
+TEST_F(SegmentsTest, ArrayBlockcyclic)
+{
+  typedef dash::Array<int>                       array_t;
+  typedef typename array_t::pattern_type::index_type index_t;
+
+  const size_t block_size = 3;
+  // Last block is underfilled:
+  const size_t num_elem   = dash::size() * block_size * 4 + 2;
+
+  array_t array(num_elem, dash::BLOCKCYCLIC(block_size));
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = array.pattern().global(li);
+  }
+  array.barrier();
+
+  auto first = array.begin() + 1;
+  auto last  = array.end()   - 2;
+
+  index_t pos = 0;
+  for (const auto & seg : dash::segments(first, last)) {
+    EXPECT_EQ_U(pos, seg.pos);
+    EXPECT_GT_U(seg.size, 0);
+    EXPECT_EQ_U(first.pos() + pos, seg.gindex);
+    for (index_t i = 0; i < seg.size; ++i) {
+      EXPECT_EQ_U(array.pattern().unit_at(seg.gindex + i), seg.unit);
+    }
+    if (seg.unit == array.team().myid()) {
+      ASSERT_NE_U(nullptr, seg.lbegin);
+      for (index_t i = 0; i < seg.size; ++i) {
+        EXPECT_EQ_U(seg.gindex + i, seg.lbegin[i]);
+      }
+    } else {
+      EXPECT_EQ_U(nullptr, seg.lbegin);
+    }
+    pos += seg.size;
+  }
+  EXPECT_EQ_U(dash::distance(first, last), pos);
+
+  // Local segments contain all local elements in the range:
+  index_t num_local_elem = 0;
+  for (index_t g = first.pos(); g < last.pos(); ++g) {
+    if (array.pattern().unit_at(g) == array.team().myid()) {
+      ++num_local_elem;
+    }
+  }
+  index_t num_lsegment_elem = 0;
+  for (const auto & seg : dash::local_segments(first, last)) {
+    EXPECT_EQ_U(array.team().myid(), seg.unit);
+    EXPECT_EQ_U(first.pos() + seg.pos, seg.gindex);
+    for (index_t i = 0; i < seg.size; ++i) {
+      EXPECT_EQ_U(seg.gindex + i, seg.lbegin[i]);
+    }
+    num_lsegment_elem += seg.size;
+  }
+  EXPECT_EQ_U(num_local_elem, num_lsegment_elem);
+}
+
+TEST_F(SegmentsTest, MatrixSubView)
+{
+  typedef dash::Matrix<int, 2>                    matrix_t;
+  typedef typename matrix_t::index_type           index_t;
+
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+
+  const size_t block_rows = 2;
+  const size_t block_cols = 3;
+  const size_t rows       = block_rows * teamspec.extent(0) * 3;
+  const size_t cols       = block_cols * teamspec.extent(1) * 3;
+
+  matrix_t matrix(
+    dash::SizeSpec<2>(rows, cols),
+    dash::DistributionSpec<2>(
+      dash::BLOCKCYCLIC(block_rows),
+      dash::BLOCKCYCLIC(block_cols)),
+    dash::Team::All(),
+    teamspec);
+
+  auto value_at = [](index_t row, index_t col) {
+    return static_cast<int>(row * 1000 + col);
+  };
+
+  if (dash::myid() == 0) {
+    for (size_t r = 0; r < rows; ++r) {
+      for (size_t c = 0; c < cols; ++c) {
+        matrix[r][c] = value_at(r, c);
+      }
+    }
+  }
+  matrix.barrier();
+
+  // View excluding the outermost rows and columns of the matrix:
+  const index_t view_row_offset = 1;
+  const index_t view_col_offset = 2;
+  const index_t view_rows       = rows - 2;
+  const index_t view_cols       = cols - 3;
+  auto view = matrix.sub<0>(view_row_offset, view_rows)
+                    .sub<1>(view_col_offset, view_cols);
+  ASSERT_EQ_U(view_rows * view_cols, view.size());
+
+  // Segments are limited to rows of the view and follow its iteration
+  // order:
+  index_t pos = 0;
+  for (const auto & seg : dash::segments(view)) {
+    EXPECT_EQ_U(pos, seg.pos);
+    EXPECT_GT_U(seg.size, 0);
+    EXPECT_LE_U((pos % view_cols) + seg.size, view_cols);
+    for (index_t i = 0; i < seg.size; ++i) {
+      index_t row = view_row_offset + (pos + i) / view_cols;
+      index_t col = view_col_offset + (pos + i) % view_cols;
+      EXPECT_EQ_U(matrix.pattern().unit_at(
+                    std::array<index_t, 2> {{ row, col }}),
+                  seg.unit);
+      if (seg.lbegin != nullptr) {
+        EXPECT_EQ_U(value_at(row, col), seg.lbegin[i]);
+      }
+    }
+    pos += seg.size;
+  }
+  EXPECT_EQ_U(view.size(), pos);
+
+  // Global indices passed to for_each_with_index match the elements:
+  dash::for_each_with_index(view.begin(), view.end(),
+    [&](int value, index_t gindex) {
+      auto coords = matrix.pattern().coords(gindex);
+      EXPECT_EQ_U(value_at(coords[0], coords[1]), value);
+    });
+
+  // Copy view to local buffer:
+  std::vector<int> buf(view.size());
+  dash::copy(view.begin(), view.end(), buf.data());
+  for (index_t i = 0; i < static_cast<index_t>(buf.size()); ++i) {
+    EXPECT_EQ_U(value_at(view_row_offset + i / view_cols,
+                         view_col_offset + i % view_cols),
+                buf[i]);
+  }
+  matrix.barrier();
+
+  // Find elements in the view:
+  auto find_pos = view.size() - view_cols - 1;
+  auto found    = dash::find(
+                    view.begin(), view.end(),
+                    value_at(view_row_offset + find_pos / view_cols,
+                             view_col_offset + find_pos % view_cols));
+  EXPECT_EQ_U(view.begin() + find_pos, found);
+  auto not_found = dash::find(view.begin(), view.end(), value_at(0, 0));
+  EXPECT_EQ_U(view.end(), not_found);
+
+  // Fill view, elements outside of the view must not be modified:
+  dash::fill(view.begin(), view.end(), -1);
+  matrix.barrier();
+  if (dash::myid() == 0) {
+    for (index_t r = 0; r < static_cast<index_t>(rows); ++r) {
+      for (index_t c = 0; c < static_cast<index_t>(cols); ++c) {
+        bool in_view = r >= view_row_offset &&
+                       r <  view_row_offset + view_rows &&
+                       c >= view_col_offset &&
+                       c <  view_col_offset + view_cols;
+        int value = matrix[r][c];
+        EXPECT_EQ_U(in_view ? -1 : value_at(r, c), value);
+      }
+    }
+  }
+  matrix.barrier();
+}
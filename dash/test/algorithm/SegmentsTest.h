@@ -0,0 +1,13 @@
+#ifndef DASH__TEST__SEGMENTS_TEST_H_
+#define DASH__TEST__SEGMENTS_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for the decomposition of global ranges into segments,
+ * see dash::segments.
+ */
+class SegmentsTest : public dash::test::TestBase {
+};
+
+#endif // DASH__TEST__SEGMENTS_TEST_H_
@@ -9,7 +9,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <numeric>
 #include <random>
+#include <vector>
 
 #ifndef DEBUG
 using random_dev_t = std::random_device;
@@ -432,3 +434,90 @@ TEST_F(SortTest, ExtremValues)
 
 // TODO: add additional unit tests with various pattern types and containers
 //
+
+TEST_F(SortTest, ParallelLocalSort)
+{
+  // Local sort with explicit thread count, independent of the thread
+  // capacity of the unit:
+  int const   nthreads = 4;
+  std::size_t nelem    = 100003;
+
+  static std::uniform_int_distribution<int32_t> i_dist(-1000000, 1000000);
+  static std::uniform_real_distribution<double> d_dist(-1.0, 1.0);
+  static random_dev_t                           rd;
+  static std::mt19937 generator(rd() + dash::myid());
+
+  // Radix sort of integral and floating point keys:
+  std::vector<int32_t> ints(nelem);
+  std::generate(ints.begin(), ints.end(), []() {
+    return i_dist(generator);
+  });
+  auto ints_exp = ints;
+  std::sort(ints_exp.begin(), ints_exp.end());
+  dash::detail::psort__local_sort(
+      ints.data(),
+      ints.data() + nelem,
+      [](int32_t const& v) { return v; },
+      std::less<int32_t>(),
+      nthreads);
+  EXPECT_TRUE_U(ints == ints_exp);
+
+  std::vector<double> doubles(nelem);
+  std::generate(doubles.begin(), doubles.end(), []() {
+    return d_dist(generator);
+  });
+  auto doubles_exp = doubles;
+  std::sort(doubles_exp.begin(), doubles_exp.end());
+  dash::detail::psort__local_sort(
+      doubles.data(),
+      doubles.data() + nelem,
+      [](double const& v) { return v; },
+      std::less<double>(),
+      nthreads);
+  EXPECT_TRUE_U(doubles == doubles_exp);
+
+  // Merge sort for keys not supported by radix sort, with many
+  // duplicates:
+  std::vector<Point> points(nelem);
+  std::generate(points.begin(), points.end(), []() {
+    return Point{i_dist(generator) % 100, i_dist(generator)};
+  });
+  auto const point_key = [](Point const& p) {
+    return static_cast<long double>(p.x);
+  };
+  auto const point_comp = [&point_key](Point const& a, Point const& b) {
+    return point_key(a) < point_key(b);
+  };
+  auto points_exp = points;
+  std::sort(points_exp.begin(), points_exp.end(), point_comp);
+  dash::detail::psort__local_sort(
+      points.data(), points.data() + nelem, point_key, point_comp, nthreads);
+  for (std::size_t i = 0; i < nelem; ++i) {
+    ASSERT_EQ_U(points_exp[i].x, points[i].x);
+  }
+}
+
+TEST_F(SortTest, ParallelMergeSequences)
+{
+  int const nthreads = 3;
+  // Sequences of different length, including empty sequences:
+  std::vector<std::size_t> seq_sizes{ 1000, 0, 17, 5000, 1, 0, 2345 };
+  std::vector<std::size_t> seq_psum{ 0 };
+  std::partial_sum(
+      seq_sizes.begin(), seq_sizes.end(), std::back_inserter(seq_psum));
+
+  std::vector<int> values(seq_psum.back());
+  for (std::size_t s = 0; s < seq_sizes.size(); ++s) {
+    for (auto i = seq_psum[s]; i < seq_psum[s + 1]; ++i) {
+      values[i] = static_cast<int>((i * 7919) % 1024);
+    }
+    std::sort(values.begin() + seq_psum[s], values.begin() + seq_psum[s + 1]);
+  }
+  auto values_exp = values;
+  std::sort(values_exp.begin(), values_exp.end());
+
+  std::vector<int> merged(values.size());
+  dash::detail::psort__merge_sequences(
+      values.data(), seq_psum, merged.data(), std::less<int>(), nthreads);
+  EXPECT_TRUE_U(merged == values_exp);
+}
@@ -1570,13 +1570,16 @@ TEST_F(MatrixTest, SubViewMatrix3Dim)
   }
   matrix.barrier();
 
-  EXPECT_EQ_U(sub_0_size, matrix[0].size());
-  EXPECT_EQ_U(sub_0_size, std::distance(matrix[0].begin(),
-                                        matrix[0].end()));
+  // View iterators reference the view's viewspec, the view must outlive
+  // them:
+  auto sub_0 = matrix[0];
+  EXPECT_EQ_U(sub_0_size, sub_0.size());
+  EXPECT_EQ_U(sub_0_size, std::distance(sub_0.begin(),
+                                        sub_0.end()));
 
   if (dash::myid().id == 0) {
   int visited = 0;
-    for (auto it = matrix[0].begin(); it != matrix[0].end();
+    for (auto it = sub_0.begin(); it != sub_0.end();
          ++it, ++visited) {
       double val = *it;
     }
@@ -548,3 +548,112 @@ TEST_F(UnorderedMapTest, MappedAtomics)
   }
 }
 
+
+TEST_F(UnorderedMapTest, HashDirectedLookup)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  if (dash::size() < 2) {
+    LOG_MESSAGE(
+      "UnorderedMapTest.HashDirectedLookup requires at least two units");
+    return;
+  }
+
+  size_type nunits         = dash::size();
+  size_type local_elements = 7;
+  map_t map(0, 3);
+
+  // Insert keys that are mapped to the next unit by the hash function:
+  auto target = (dash::myid().id + 1) % nunits;
+  for (int li = 0; li < local_elements; ++li) {
+    key_t     key    = (nunits * (100 + li)) + target;
+    mapped_t  mapped = 1.0 * (dash::myid().id + 1) + (0.01 * (li + 1));
+    map_value value({ key, mapped });
+
+    auto insertion = map.insert(value);
+    EXPECT_TRUE_U(insertion.second);
+    auto existing  = map.insert(value);
+    EXPECT_FALSE_U(existing.second);
+    EXPECT_EQ_U(insertion.first, existing.first);
+  }
+  EXPECT_EQ_U(local_elements, map.lsize());
+
+  map.barrier();
+
+  EXPECT_EQ_U(nunits * local_elements, map.size());
+
+  // Elements inserted by all units are resolved from the bucket index of
+  // their target unit:
+  for (int unit = 0; unit < nunits; ++unit) {
+    auto unit_target = (unit + 1) % nunits;
+    for (int li = 0; li < local_elements; ++li) {
+      key_t     key    = (nunits * (100 + li)) + unit_target;
+      mapped_t  mapped = 1.0 * (unit + 1) + (0.01 * (li + 1));
+      map_value value({ key, mapped });
+
+      auto found = map.find(key);
+      EXPECT_NE_U(map.end(), found);
+      EXPECT_EQ_U(unit, found.lpos().unit);
+      EXPECT_EQ_U(li,   found.lpos().index);
+      map_value found_value = *found;
+      EXPECT_EQ_U(value, found_value);
+      EXPECT_EQ_U(1, map.count(key));
+    }
+  }
+  key_t missing = nunits * 1000 + 1;
+  EXPECT_EQ_U(map.end(), map.find(missing));
+  EXPECT_EQ_U(0, map.count(missing));
+}
+
+TEST_F(UnorderedMapTest, BulkInsert)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  size_type nunits         = dash::size();
+  size_type local_elements = 20;
+  map_t map(0, 4);
+
+  // Every unit inserts keys that are mapped to all units, the first key
+  // is inserted by all units:
+  std::vector<std::pair<key_t, mapped_t>> values;
+  values.push_back(std::make_pair(0, 0.5));
+  for (int li = 1; li < local_elements; ++li) {
+    key_t key = (li * nunits) + dash::myid().id;
+    values.push_back(std::make_pair(key, 1.0 * key));
+  }
+  map.bulk_insert(values.begin(), values.end());
+
+  EXPECT_EQ_U(nunits * (local_elements - 1) + 1, map.size());
+
+  // Elements have been moved to their target units:
+  for (auto lit = map.lbegin(); lit != map.lend(); ++lit) {
+    map_value value = *lit;
+    EXPECT_EQ_U(dash::myid().id, value.first % nunits);
+  }
+  for (int unit = 0; unit < nunits; ++unit) {
+    for (int li = 1; li < local_elements; ++li) {
+      key_t key   = (li * nunits) + unit;
+      auto  found = map.find(key);
+      EXPECT_NE_U(map.end(), found);
+      EXPECT_EQ_U(key % nunits, found.lpos().unit);
+      map_value found_value = *found;
+      EXPECT_EQ_U(map_value(key, 1.0 * key), found_value);
+    }
+  }
+  EXPECT_EQ_U(1, map.count(0));
+
+  // Bulk insertion of existing keys has no effect:
+  auto ninserted = map.bulk_insert(values.begin(), values.end());
+  EXPECT_EQ_U(0, ninserted);
+  EXPECT_EQ_U(nunits * (local_elements - 1) + 1, map.size());
+}
@@ -2,6 +2,13 @@
 #include "DARTCollectiveTest.h"
 
 #include <dash/dart/if/dart.h>
+#include <dash/Array.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <vector>
 
 
 TEST_F(DARTCollectiveTest, Send_Recv) {
@@ -211,3 +218,182 @@ TEST_F(DARTCollectiveTest, MaxElementAt) {
   dart_op_destroy(&new_op);
 
 }
+
+TEST_F(DARTCollectiveTest, NonBlocking) {
+
+  using elem_t = int;
+  auto const team  = dash::Team::All().dart_id();
+  auto const dtype = dash::dart_datatype<elem_t>::value;
+  int32_t    flag  = 0;
+
+  dart_handle_t barrier_handle;
+  ASSERT_EQ_U(DART_OK, dart_ibarrier(team, &barrier_handle));
+  ASSERT_NE_U(DART_HANDLE_NULL, barrier_handle);
+  do {
+    ASSERT_EQ_U(DART_OK, dart_test_local(&barrier_handle, &flag));
+  } while (!flag);
+  ASSERT_EQ_U(DART_HANDLE_NULL, barrier_handle);
+
+  // all non-blocking collectives in flight at the same time
+  std::vector<dart_handle_t> handles(3, DART_HANDLE_NULL);
+
+  elem_t value = dash::myid();
+  elem_t sum   = 0;
+  ASSERT_EQ_U(DART_OK,
+    dart_iallreduce(&value, &sum, 1, dtype, DART_OP_SUM, team, &handles[0]));
+
+  elem_t bcast_value = (dash::myid() == 0) ? 42 : 0;
+  ASSERT_EQ_U(DART_OK,
+    dart_ibcast(&bcast_value, 1, dtype, dash::team_unit_t{0}, team,
+                &handles[1]));
+
+  std::vector<elem_t> send(dash::size());
+  std::vector<elem_t> recv(dash::size(), -1);
+  for (size_t u = 0; u < dash::size(); ++u) {
+    send[u] = dash::myid() * 100 + u;
+  }
+  ASSERT_EQ_U(DART_OK,
+    dart_ialltoall(send.data(), recv.data(), 1, dtype, team, &handles[2]));
+
+  ASSERT_EQ_U(DART_OK, dart_waitall_local(handles.data(), handles.size()));
+
+  ASSERT_EQ_U((dash::size() - 1) * dash::size() / 2, sum);
+  ASSERT_EQ_U(42, bcast_value);
+  for (size_t u = 0; u < dash::size(); ++u) {
+    ASSERT_EQ_U(static_cast<elem_t>(u * 100 + dash::myid()), recv[u]);
+  }
+}
+
+TEST_F(DARTCollectiveTest, Hierarchical) {
+
+  using elem_t = int;
+  auto const dtype = dash::dart_datatype<elem_t>::value;
+
+  // Combine data of units on the same node in shared memory, the setting
+  // is agreed on by all units in dart_init:
+  const char * env_hier = getenv("DART_HIER_COLLECTIVES");
+  std::string  prev_hier(env_hier != nullptr ? env_hier : "");
+  dash::finalize();
+  setenv("DART_HIER_COLLECTIVES", "1", 1);
+  dash::init(&TESTENV::argc, &TESTENV::argv);
+  if (env_hier != nullptr) {
+    setenv("DART_HIER_COLLECTIVES", prev_hier.c_str(), 1);
+  } else {
+    unsetenv("DART_HIER_COLLECTIVES");
+  }
+
+  dart_config_t * dart_cfg;
+  dart_config(&dart_cfg);
+  if (!dart_cfg->hier_collectives) {
+    SKIP_TEST_MSG("hierarchical collectives are not supported");
+  }
+
+  auto const team  = dash::Team::All().dart_id();
+
+  constexpr int num_iterations = 10;
+  for (int i = 0; i < num_iterations; ++i) {
+    ASSERT_EQ_U(DART_OK, dart_barrier(team));
+
+    std::vector<elem_t> values(3);
+    std::vector<elem_t> results(3);
+    values[0] = dash::myid() + i;
+    values[1] = 1;
+    values[2] = -static_cast<elem_t>(dash::myid());
+    ASSERT_EQ_U(DART_OK,
+      dart_allreduce(values.data(), results.data(), 3, dtype,
+                     DART_OP_SUM, team));
+    ASSERT_EQ_U((dash::size() - 1) * dash::size() / 2 + i * dash::size(),
+                results[0]);
+    ASSERT_EQ_U(dash::size(), results[1]);
+    ASSERT_EQ_U(-static_cast<elem_t>((dash::size() - 1) * dash::size() / 2),
+                results[2]);
+
+    elem_t value = dash::myid() * 2;
+    elem_t max;
+    ASSERT_EQ_U(DART_OK,
+      dart_allreduce(&value, &max, 1, dtype, DART_OP_MAX, team));
+    ASSERT_EQ_U((dash::size() - 1) * 2, max);
+
+    dash::team_unit_t root(i % dash::size());
+    std::vector<elem_t> bcast_values(4, -1);
+    if (dash::Team::All().myid() == root) {
+      std::iota(bcast_values.begin(), bcast_values.end(), i);
+    }
+    ASSERT_EQ_U(DART_OK,
+      dart_bcast(bcast_values.data(), 4, dtype, root, team));
+    for (int v = 0; v < 4; ++v) {
+      ASSERT_EQ_U(i + v, bcast_values[v]);
+    }
+
+    std::vector<elem_t> gathered(2 * dash::size(), -1);
+    elem_t own[2] = { static_cast<elem_t>(dash::myid()), i };
+    ASSERT_EQ_U(DART_OK,
+      dart_allgather(own, gathered.data(), 2, dtype, team));
+    for (size_t u = 0; u < dash::size(); ++u) {
+      ASSERT_EQ_U(static_cast<elem_t>(u), gathered[2 * u]);
+      ASSERT_EQ_U(i, gathered[2 * u + 1]);
+    }
+  }
+
+  // Messages exceeding the shared memory buffers use flat collectives:
+  std::vector<elem_t> large(1 << 12, 1);
+  std::vector<elem_t> large_sum(large.size());
+  ASSERT_EQ_U(DART_OK,
+    dart_allreduce(large.data(), large_sum.data(), large.size(), dtype,
+                   DART_OP_SUM, team));
+  ASSERT_EQ_U(dash::size(), large_sum.back());
+
+  // Collectives on a sub-team:
+  if (dash::size() >= 2) {
+    auto & split_team = dash::Team::All().split(2);
+    elem_t sum = 0;
+    elem_t one = 1;
+    ASSERT_EQ_U(DART_OK,
+      dart_allreduce(&one, &sum, 1, dtype, DART_OP_SUM,
+                     split_team.dart_id()));
+    ASSERT_EQ_U(split_team.size(), sum);
+    ASSERT_EQ_U(DART_OK, dart_barrier(split_team.dart_id()));
+  }
+}
+
+TEST_F(DARTCollectiveTest, NodeBarrier) {
+
+  auto const team = dash::Team::All().dart_id();
+
+  // Units located on the same node as the calling unit:
+  dart_unit_locality_t * myloc;
+  ASSERT_EQ_U(DART_OK,
+    dart_unit_locality(team, dash::Team::All().myid(), &myloc));
+  std::vector<size_t> node_units;
+  for (size_t u = 0; u < dash::size(); ++u) {
+    dart_unit_locality_t * uloc;
+    ASSERT_EQ_U(DART_OK,
+      dart_unit_locality(team, dash::team_unit_t(u), &uloc));
+    if (strcmp(uloc->hwinfo.host, myloc->hwinfo.host) == 0) {
+      node_units.push_back(u);
+    }
+  }
+
+  dash::Array<int> iterations(dash::size());
+  iterations.local[0] = 0;
+  dash::barrier();
+
+  constexpr int num_iterations = 10;
+  for (int i = 1; i <= num_iterations; ++i) {
+    iterations.local[0] = i;
+    ASSERT_EQ_U(DART_OK, dart_barrier_node_arrive(team));
+    // Local work between arrival and completion of the barrier:
+    int local_work = iterations.local[0] * 2;
+    ASSERT_EQ_U(DART_OK, dart_barrier_node_wait(team));
+    ASSERT_EQ_U(i * 2, local_work);
+    // All units on the node have entered iteration i:
+    for (auto u : node_units) {
+      EXPECT_GE_U(static_cast<int>(iterations[u]), i);
+    }
+    // Units on the node complete iteration i before any of them enters
+    // iteration i + 1:
+    ASSERT_EQ_U(DART_OK, dart_barrier_node_arrive(team));
+    ASSERT_EQ_U(DART_OK, dart_barrier_node_wait(team));
+  }
+  dash::barrier();
+}
@@ -252,3 +252,26 @@ TEST_F(DARTLocalityTest, ScopeDomains)
   }
 }
 
+
+TEST_F(DARTLocalityTest, InitTiming)
+{
+  dart_locality_init_timing_t timing;
+  EXPECT_EQ_U(DART_OK, dart_locality_init_timing(&timing));
+
+  DASH_LOG_TRACE_VAR("DARTLocalityTest.InitTiming", timing.node_topology_us);
+  DASH_LOG_TRACE_VAR("DARTLocalityTest.InitTiming", timing.unit_mapping_us);
+  DASH_LOG_TRACE_VAR("DARTLocalityTest.InitTiming", timing.host_topology_us);
+  DASH_LOG_TRACE_VAR("DARTLocalityTest.InitTiming",
+                     timing.domain_hierarchy_us);
+  DASH_LOG_TRACE_VAR("DARTLocalityTest.InitTiming", timing.total_us);
+
+  EXPECT_GE_U(timing.node_topology_us,    0);
+  EXPECT_GE_U(timing.unit_mapping_us,     0);
+  EXPECT_GE_U(timing.host_topology_us,    0);
+  EXPECT_GE_U(timing.domain_hierarchy_us, 0);
+  // Phases are measured within the complete initialization:
+  EXPECT_GT_U(timing.total_us, 0);
+  EXPECT_GE_U(timing.total_us,
+              timing.node_topology_us + timing.unit_mapping_us +
+              timing.host_topology_us + timing.domain_hierarchy_us);
+}
@@ -234,3 +234,47 @@ TEST_F(DARTLockTest, TeamLockUnlock) {
     dart_team_lock_destroy(&lock));
 
 }
+
+TEST_F(DARTLockTest, MixedLockTryLockUnlock) {
+  using value_t = int;
+  constexpr int num_iterations = 100;
+  dash::Shared<value_t> shared;
+  dart_lock_t lock;
+
+  if (dash::myid() == 0) {
+    shared.set(0);
+  }
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_init(DART_TEAM_ALL, &lock));
+
+  dash::barrier();
+  for (int i = 0; i < num_iterations; ++i) {
+    // Contend with blocking and non-blocking acquisition on every unit:
+    if ((i + dash::myid()) % 2 == 0) {
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_lock_acquire(lock));
+    } else {
+      int32_t acquired;
+      do {
+        ASSERT_EQ_U(
+          DART_OK,
+          dart_lock_try_acquire(lock, &acquired));
+      } while (!acquired);
+    }
+    shared.set(shared.get() + 1);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_release(lock));
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(num_iterations * dash::size(),
+              static_cast<value_t>(shared.get()));
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_destroy(&lock));
+}
@@ -3,6 +3,7 @@
 
 #include <dash/Array.h>
 #include <dash/Onesided.h>
+#include <algorithm>
 
 
 TEST_F(DARTOnesidedTest, GetBlockingSingleBlock)
@@ -213,6 +214,80 @@ TEST_F(DARTOnesidedTest, StridedGetSimple) {
 }
 
 
+TEST_F(DARTOnesidedTest, StridedGetRepeated) {
+  constexpr size_t num_elem_per_unit = 200;
+  constexpr size_t stride            = 2;
+  constexpr int    num_reps          = 3;
+
+  dart_gptr_t gptr;
+  int *local_ptr;
+  dart_team_memalloc_aligned(
+    DART_TEAM_ALL, num_elem_per_unit, DART_TYPE_INT, &gptr);
+  gptr.unitid = dash::myid();
+  dart_gptr_getaddr(gptr, (void**)&local_ptr);
+  for (int i = 0; i < num_elem_per_unit; ++i) {
+    local_ptr[i] = i;
+  }
+
+  dash::barrier();
+  auto *buf = new int[num_elem_per_unit];
+
+  dart_unit_t neighbor = (dash::myid() + 1) % dash::size();
+  gptr.unitid = neighbor;
+
+  dart_datatype_t new_type;
+  dart_type_create_strided(DART_TYPE_INT, stride, 1, &new_type);
+
+  size_t hits_begin, misses_begin;
+  dart_type_cache_stats(&hits_begin, &misses_begin);
+
+  // Repeated transfers of varying size exceed the capacity of the
+  // MPI type cache:
+  for (int rep = 0; rep < num_reps; ++rep) {
+    for (size_t nelem = 1; nelem <= num_elem_per_unit / stride; ++nelem) {
+      memset(buf, 0, sizeof(int)*num_elem_per_unit);
+      dart_get_blocking(buf, gptr, nelem, new_type, DART_TYPE_INT);
+      for (size_t i = 0; i < nelem; ++i) {
+        ASSERT_EQ_U(i*stride, buf[i]);
+      }
+      ASSERT_EQ_U(0, buf[nelem]);
+    }
+  }
+
+  size_t hits_evict, misses_evict;
+  dart_type_cache_stats(&hits_evict, &misses_evict);
+
+  // Repeated transfers of a few sizes reuse cached types:
+  constexpr size_t num_sizes = 8;
+  for (int rep = 0; rep < num_reps; ++rep) {
+    for (size_t nelem = 1; nelem <= num_sizes; ++nelem) {
+      memset(buf, 0, sizeof(int)*num_elem_per_unit);
+      dart_get_blocking(buf, gptr, nelem, new_type, DART_TYPE_INT);
+      for (size_t i = 0; i < nelem; ++i) {
+        ASSERT_EQ_U(i*stride, buf[i]);
+      }
+    }
+  }
+  dart_type_destroy(&new_type);
+
+  size_t hits_end, misses_end;
+  dart_type_cache_stats(&hits_end, &misses_end);
+  if (dash::size() > 1) {
+    EXPECT_GE_U(misses_evict - misses_begin, num_elem_per_unit / stride);
+    EXPECT_LE_U(misses_end - misses_evict, num_sizes);
+    EXPECT_GE_U(hits_end - hits_evict, (num_reps - 1) * num_sizes);
+  }
+
+  dash::barrier();
+
+  // clean-up
+  gptr.unitid = 0;
+  dart_team_memfree(gptr);
+
+  delete[] buf;
+}
+
+
 TEST_F(DARTOnesidedTest, StridedPutSimple) {
   constexpr size_t num_elem_per_unit = 120;
   constexpr size_t max_stride_size   = 5;
@@ -596,3 +671,117 @@ TEST_F(DARTOnesidedTest, IndexedToIndexedGet) {
   dart_team_memfree(gptr);
 }
 
+
+TEST_F(DARTOnesidedTest, PutCombining)
+{
+  typedef int value_t;
+  const size_t block_size = 200;
+  dash::Array<value_t> array(dash::size() * block_size, dash::BLOCKED);
+  std::fill(array.lbegin(), array.lend(), -1);
+  array.barrier();
+
+  // Write every other element of the next unit's block in descending order
+  // and overwrite it, the last value written must be visible:
+  dart_unit_t unit_dst = (dash::myid() + 1) % dash::size();
+  for (int l = block_size - 1; l >= 0; --l) {
+    if (l % 2 != 0) {
+      continue;
+    }
+    auto    gptr  = array[unit_dst * block_size + l].dart_gptr();
+    value_t first = 0;
+    value_t last  = (dash::myid() + 1) * 1000 + l;
+    ASSERT_EQ_U(DART_OK, dart_put_combining(gptr, &first, 1, DART_TYPE_INT));
+    ASSERT_EQ_U(DART_OK, dart_put_combining(gptr, &last,  1, DART_TYPE_INT));
+  }
+  array.barrier();
+
+  dart_unit_t unit_src = (dash::myid() + dash::size() - 1) % dash::size();
+  for (size_t l = 0; l < block_size; ++l) {
+    value_t expected = (l % 2 == 0)
+                       ? static_cast<value_t>((unit_src + 1) * 1000 + l)
+                       : -1;
+    EXPECT_EQ_U(expected, array.local[l]);
+  }
+}
+
+TEST_F(DARTOnesidedTest, AccumulateCombining)
+{
+  typedef int value_t;
+  const size_t block_size  = 50;
+  const int    num_repeats = 3;
+  dash::Array<value_t> array(dash::size() * block_size, dash::BLOCKED);
+  std::fill(array.lbegin(), array.lend(), 0);
+  array.barrier();
+
+  // Every unit adds its id + 1 to all elements several times:
+  value_t value = dash::myid() + 1;
+  for (int r = 0; r < num_repeats; ++r) {
+    for (size_t g = array.size(); g > 0; --g) {
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_accumulate_combining(
+          array[g - 1].dart_gptr(), &value, 1, DART_TYPE_INT, DART_OP_SUM));
+    }
+  }
+  // Combined accumulates are applied before a subsequent fetch-and-op:
+  value_t result;
+  value_t nothing = 0;
+  dart_unit_t unit_dst = (dash::myid() + 1) % dash::size();
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_fetch_and_op(
+      array[unit_dst * block_size].dart_gptr(), &nothing, &result,
+      DART_TYPE_INT, DART_OP_NO_OP));
+  array.flush();
+  EXPECT_GE_U(result, num_repeats * value);
+  array.barrier();
+
+  value_t expected = num_repeats * dash::size() * (dash::size() + 1) / 2;
+  for (size_t l = 0; l < block_size; ++l) {
+    EXPECT_EQ_U(expected, array.local[l]);
+  }
+}
+
+TEST_F(DARTOnesidedTest, CombiningOrder)
+{
+  typedef int value_t;
+  const size_t block_size = 4;
+  dash::Array<value_t> array(dash::size() * block_size, dash::BLOCKED);
+  std::fill(array.lbegin(), array.lend(), 0);
+  array.barrier();
+
+  dart_unit_t unit_dst = (dash::myid() + 1) % dash::size();
+  auto gptr_first  = array[unit_dst * block_size].dart_gptr();
+  auto gptr_second = array[unit_dst * block_size + 1].dart_gptr();
+
+  // Replace and sum on the same element are applied in issue order:
+  value_t replace = 5;
+  value_t add     = 1;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_accumulate_combining(
+      gptr_first, &replace, 1, DART_TYPE_INT, DART_OP_REPLACE));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_accumulate_combining(
+      gptr_first, &add, 1, DART_TYPE_INT, DART_OP_SUM));
+
+  // A put of a single element overwrites the overlapping put of two
+  // elements issued before:
+  value_t pair[2] = { 7, 8 };
+  value_t single  = 9;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_put_combining(gptr_second, pair, 2, DART_TYPE_INT));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_put_combining(gptr_second, &single, 1, DART_TYPE_INT));
+
+  ASSERT_EQ_U(DART_OK, dart_flush_all(gptr_first));
+  array.barrier();
+
+  EXPECT_EQ_U(6, array.local[0]);
+  EXPECT_EQ_U(9, array.local[1]);
+  EXPECT_EQ_U(8, array.local[2]);
+  EXPECT_EQ_U(0, array.local[3]);
+}
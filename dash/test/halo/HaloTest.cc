@@ -5,7 +5,9 @@
 #include <dash/Algorithm.h>
 #include <dash/halo/HaloMatrixWrapper.h>
 
+#include <chrono>
 #include <iostream>
+#include <thread>
 
 using namespace dash;
 
@@ -1294,3 +1296,377 @@ TEST_F(HaloTest, HaloMatrixWrapperBigMultiStencil)
 
   dash::Team::All().barrier();
 }
+
+TEST_F(HaloTest, StencilOperatorUpdate)
+{
+  using Pattern_t  = dash::Pattern<3>;
+  using index_type = typename Pattern_t::index_type;
+  using Matrix_t   = dash::Matrix<long, 3, index_type, Pattern_t>;
+  using DistSpec_t = dash::DistributionSpec<3>;
+  using TeamSpec_t = dash::TeamSpec<3>;
+  using SizeSpec_t = dash::SizeSpec<3>;
+
+  using GlobBoundSpec_t = GlobalBoundarySpec<3>;
+  using StencilP_t      = StencilPoint<3>;
+
+  constexpr long ext = 24;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext, ext, ext), dist_spec, team_spec,
+                    dash::Team::All());
+
+  Matrix_t matrix_halo(pattern);
+  auto lsize = matrix_halo.local_size();
+  for(decltype(lsize) i = 0; i < lsize; ++i)
+    matrix_halo.lbegin()[i] = dash::myid() * 100000 + i;
+
+  dash::Team::All().barrier();
+
+  StencilSpec<StencilP_t, 7> stencil_spec(
+      StencilP_t(-1, 0, 0), StencilP_t( 1, 0, 0),
+      StencilP_t( 0,-1, 0), StencilP_t( 0, 1, 0),
+      StencilP_t( 0, 0,-1), StencilP_t( 0, 0, 1),
+      StencilP_t(-1,-1, 1)
+  );
+  GlobBoundSpec_t bound_spec(BoundaryProp::CYCLIC, BoundaryProp::CYCLIC,
+                             BoundaryProp::CYCLIC);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper(matrix_halo, bound_spec,
+                                           stencil_spec);
+  auto stencil_op = halo_wrapper.stencil_operator(stencil_spec);
+  auto num_stencil_points = stencil_spec.num_stencil_points();
+
+  auto stencil_sum = [&](decltype(stencil_op.begin())& it) {
+    long value = *it;
+    for(decltype(num_stencil_points) i = 0; i < num_stencil_points; ++i)
+      value += it.value_at(i);
+    return value;
+  };
+
+  // Reference values computed by the stencil iterator:
+  halo_wrapper.update();
+  std::vector<long> ref(lsize, -1);
+  auto it_end = stencil_op.end();
+  for(auto it = stencil_op.begin(); it != it_end; ++it)
+    ref[it.lpos()] = stencil_sum(it);
+
+  auto boundary_op = [&](decltype(stencil_op.boundary.begin())& it) {
+    long value = *it;
+    for(decltype(num_stencil_points) i = 0; i < num_stencil_points; ++i)
+      value += it.value_at(i);
+    return value;
+  };
+
+  // Element-wise inner update overlapped with the halo exchange:
+  std::vector<long> res_point(lsize, -1);
+  stencil_op.update(
+    halo_wrapper, res_point.data(),
+    [&](long* center, long* center_dst, index_type, const auto& offs) {
+      long value = *center;
+      for(decltype(num_stencil_points) i = 0; i < num_stencil_points; ++i)
+        value += center[offs[i]];
+      *center_dst = value;
+    },
+    boundary_op);
+
+  // Row-wise inner update:
+  std::vector<long> res_row(lsize, -1);
+  halo_wrapper.update();
+  stencil_op.inner.update_rows(
+    res_row.data(),
+    [&](long* center, long* center_dst, index_type, index_type row_size,
+        const auto& offs) {
+      for(index_type j = 0; j < row_size; ++j) {
+        long value = center[j];
+        for(decltype(num_stencil_points) i = 0; i < num_stencil_points; ++i)
+          value += center[j + offs[i]];
+        center_dst[j] = value;
+      }
+    });
+  stencil_op.boundary.update(res_row.data(), boundary_op);
+
+  for(decltype(lsize) i = 0; i < lsize; ++i) {
+    EXPECT_EQ_U(ref[i], res_point[i]);
+    EXPECT_EQ_U(ref[i], res_row[i]);
+  }
+
+  dash::Team::All().barrier();
+}
+
+// Unit given by lagging_unit is delayed before every halo update
+template <typename MatrixT, typename StencilSpecT>
+void jacobi_iterations(MatrixT& matrix_a, MatrixT& matrix_b,
+                       const StencilSpecT& stencil_spec,
+                       HaloExchange exchange, int iterations,
+                       const GlobalBoundarySpec<2>& bound_spec =
+                         GlobalBoundarySpec<2>(BoundaryProp::CYCLIC,
+                                               BoundaryProp::CYCLIC),
+                       int lagging_unit = -1) {
+  HaloMatrixWrapper<MatrixT> halo_a(matrix_a, exchange, bound_spec,
+                                    stencil_spec);
+  HaloMatrixWrapper<MatrixT> halo_b(matrix_b, exchange, bound_spec,
+                                    stencil_spec);
+  auto op_a = halo_a.stencil_operator(stencil_spec);
+  auto op_b = halo_b.stencil_operator(stencil_spec);
+  auto num_stencil_points = stencil_spec.num_stencil_points();
+
+  for(int i = 0; i < iterations; ++i) {
+    auto& halo_src = (i % 2 == 0) ? halo_a : halo_b;
+    auto& op_src   = (i % 2 == 0) ? op_a : op_b;
+    auto* dst      = (i % 2 == 0) ? matrix_b.lbegin() : matrix_a.lbegin();
+
+    if(exchange == HaloExchange::PULL)
+      dash::Team::All().barrier();
+    if(static_cast<int>(dash::myid()) == lagging_unit)
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    halo_src.update();
+
+    auto it_end = op_src.end();
+    for(auto it = op_src.begin(); it != it_end; ++it) {
+      long value = *it;
+      for(decltype(num_stencil_points) s = 0; s < num_stencil_points; ++s)
+        value += it.value_at(s);
+      dst[it.lpos()] = value % 1000;
+    }
+    if(exchange == HaloExchange::PULL)
+      dash::Team::All().barrier();
+  }
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, HaloMatrixWrapperPush2D)
+{
+  using Pattern_t  = dash::Pattern<2>;
+  using index_type = typename Pattern_t::index_type;
+  using Matrix_t   = dash::Matrix<long, 2, index_type, Pattern_t>;
+  using DistSpec_t = dash::DistributionSpec<2>;
+  using TeamSpec_t = dash::TeamSpec<2>;
+  using SizeSpec_t = dash::SizeSpec<2>;
+  using StencilP_t = StencilPoint<2>;
+
+  constexpr long ext        = 40;
+  constexpr int  iterations = 7;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext, ext), dist_spec, team_spec,
+                    dash::Team::All());
+
+  StencilSpec<StencilP_t, 5> stencil_spec(
+      StencilP_t(-1, 0), StencilP_t( 1, 0),
+      StencilP_t( 0,-1), StencilP_t( 0, 1),
+      StencilP_t(-1, 1)
+  );
+
+  Matrix_t matrix_pull_a(pattern);
+  Matrix_t matrix_pull_b(pattern);
+  Matrix_t matrix_push_a(pattern);
+  Matrix_t matrix_push_b(pattern);
+  auto lsize = matrix_pull_a.local_size();
+  for(decltype(lsize) i = 0; i < lsize; ++i) {
+    long value = (dash::myid() * 37 + i * 11) % 101;
+    matrix_pull_a.lbegin()[i] = value;
+    matrix_push_a.lbegin()[i] = value;
+  }
+  dash::Team::All().barrier();
+
+  jacobi_iterations(matrix_pull_a, matrix_pull_b, stencil_spec,
+                    HaloExchange::PULL, iterations);
+  jacobi_iterations(matrix_push_a, matrix_push_b, stencil_spec,
+                    HaloExchange::PUSH, iterations);
+
+  for(decltype(lsize) i = 0; i < lsize; ++i) {
+    EXPECT_EQ_U(matrix_pull_a.lbegin()[i], matrix_push_a.lbegin()[i]);
+    EXPECT_EQ_U(matrix_pull_b.lbegin()[i], matrix_push_b.lbegin()[i]);
+  }
+
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, HaloMatrixWrapperPushOneWay)
+{
+  using Pattern_t  = dash::Pattern<2>;
+  using index_type = typename Pattern_t::index_type;
+  using Matrix_t   = dash::Matrix<long, 2, index_type, Pattern_t>;
+  using DistSpec_t = dash::DistributionSpec<2>;
+  using TeamSpec_t = dash::TeamSpec<2>;
+  using SizeSpec_t = dash::SizeSpec<2>;
+  using StencilP_t = StencilPoint<2>;
+
+  constexpr long ext        = 40;
+  constexpr int  iterations = 6;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext, ext), dist_spec, team_spec,
+                    dash::Team::All());
+
+  // Without cyclic boundary in the first dimension, halo regions are only
+  // sent to the neighbors in positive direction, which never send a halo
+  // region back. The last unit receives halo regions and is delayed, so
+  // its neighbors are ahead by at least one update.
+  // Elements at the global boundary are not updated, both matrices are
+  // initialized.
+  StencilSpec<StencilP_t, 1> stencil_spec(StencilP_t(-1, 0));
+  GlobalBoundarySpec<2> bound_spec(BoundaryProp::NONE, BoundaryProp::CYCLIC);
+  int lagging_unit = dash::size() - 1;
+
+  Matrix_t matrix_pull_a(pattern);
+  Matrix_t matrix_pull_b(pattern);
+  Matrix_t matrix_push_a(pattern);
+  Matrix_t matrix_push_b(pattern);
+  auto lsize = matrix_pull_a.local_size();
+  for(decltype(lsize) i = 0; i < lsize; ++i) {
+    long value = (dash::myid() * 37 + i * 11) % 101;
+    matrix_pull_a.lbegin()[i] = value;
+    matrix_pull_b.lbegin()[i] = value;
+    matrix_push_a.lbegin()[i] = value;
+    matrix_push_b.lbegin()[i] = value;
+  }
+  dash::Team::All().barrier();
+
+  jacobi_iterations(matrix_pull_a, matrix_pull_b, stencil_spec,
+                    HaloExchange::PULL, iterations, bound_spec);
+  jacobi_iterations(matrix_push_a, matrix_push_b, stencil_spec,
+                    HaloExchange::PUSH, iterations, bound_spec,
+                    lagging_unit);
+
+  for(decltype(lsize) i = 0; i < lsize; ++i) {
+    EXPECT_EQ_U(matrix_pull_a.lbegin()[i], matrix_push_a.lbegin()[i]);
+    EXPECT_EQ_U(matrix_pull_b.lbegin()[i], matrix_push_b.lbegin()[i]);
+  }
+
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, StencilOperatorUpdateSteps)
+{
+  using Pattern_t  = dash::Pattern<2>;
+  using index_type = typename Pattern_t::index_type;
+  using Matrix_t   = dash::Matrix<long, 2, index_type, Pattern_t>;
+  using DistSpec_t = dash::DistributionSpec<2>;
+  using TeamSpec_t = dash::TeamSpec<2>;
+  using SizeSpec_t = dash::SizeSpec<2>;
+
+  using GlobBoundSpec_t = GlobalBoundarySpec<2>;
+  using HaloSpec_t      = HaloSpec<2>;
+  using StencilP_t      = StencilPoint<2>;
+
+  constexpr long ext       = 40;
+  constexpr int  num_steps = 3;
+  constexpr int  rounds    = 2;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext, ext), dist_spec, team_spec,
+                    dash::Team::All());
+
+  StencilSpec<StencilP_t, 5> stencil_spec(
+      StencilP_t(-1, 0), StencilP_t( 1, 0),
+      StencilP_t( 0,-1), StencilP_t( 0, 1),
+      StencilP_t(-1, 1)
+  );
+
+  HaloSpec_t halo_spec = HaloSpec_t::for_steps(stencil_spec, num_steps);
+  for(const auto& spec : halo_spec.specs()) {
+    if(spec.index() != RegionCoords<2>().index())
+      EXPECT_EQ_U(spec.extent(), num_steps);
+  }
+  EXPECT_EQ_U(halo_spec.num_regions(), 8);
+
+  auto row_op = [](const long* center, long* center_dst, std::size_t size,
+                   const std::array<long, 5>& offs) {
+    for(std::size_t i = 0; i < size; ++i) {
+      long value = center[i];
+      for(auto off : offs)
+        value += center[i + off];
+      center_dst[i] = value % 1000;
+    }
+  };
+
+  for(auto bound : { BoundaryProp::CYCLIC, BoundaryProp::NONE }) {
+    GlobBoundSpec_t bound_spec(bound, BoundaryProp::CYCLIC);
+
+    Matrix_t matrix_ref_a(pattern);
+    Matrix_t matrix_ref_b(pattern);
+    Matrix_t matrix_steps_a(pattern);
+    Matrix_t matrix_steps_b(pattern);
+    Matrix_t matrix_push(pattern);
+    auto lsize = matrix_ref_a.local_size();
+    for(decltype(lsize) i = 0; i < lsize; ++i) {
+      long value = (dash::myid() * 37 + i * 11) % 101;
+      matrix_ref_a.lbegin()[i]   = value;
+      matrix_ref_b.lbegin()[i]   = value;
+      matrix_steps_a.lbegin()[i] = value;
+      matrix_steps_b.lbegin()[i] = value;
+      matrix_push.lbegin()[i]    = value;
+    }
+    dash::Team::All().barrier();
+
+    // one halo update per step
+    HaloMatrixWrapper<Matrix_t> halo_ref_a(matrix_ref_a, bound_spec,
+                                           stencil_spec);
+    HaloMatrixWrapper<Matrix_t> halo_ref_b(matrix_ref_b, bound_spec,
+                                           stencil_spec);
+    auto op_ref_a = halo_ref_a.stencil_operator(stencil_spec);
+    auto op_ref_b = halo_ref_b.stencil_operator(stencil_spec);
+    for(int step = 0; step < num_steps * rounds; ++step) {
+      auto& halo_src = (step % 2 == 0) ? halo_ref_a : halo_ref_b;
+      auto& op_src   = (step % 2 == 0) ? op_ref_a : op_ref_b;
+      auto* dst      = (step % 2 == 0) ? matrix_ref_b.lbegin()
+                                       : matrix_ref_a.lbegin();
+      halo_src.update();
+      auto it_end = op_src.end();
+      for(auto it = op_src.begin(); it != it_end; ++it) {
+        long value = *it;
+        for(auto s = 0; s < stencil_spec.num_stencil_points(); ++s)
+          value += it.value_at(s);
+        dst[it.lpos()] = value % 1000;
+      }
+      dash::Team::All().barrier();
+    }
+    auto& matrix_ref = (num_steps * rounds % 2 == 0) ? matrix_ref_a
+                                                     : matrix_ref_b;
+
+    // one halo update per num_steps steps
+    HaloMatrixWrapper<Matrix_t> halo_steps_a(matrix_steps_a, bound_spec,
+                                             halo_spec);
+    HaloMatrixWrapper<Matrix_t> halo_steps_b(matrix_steps_b, bound_spec,
+                                             halo_spec);
+    auto op_steps_a = halo_steps_a.stencil_operator(stencil_spec);
+    auto op_steps_b = halo_steps_b.stencil_operator(stencil_spec);
+    for(int round = 0; round < rounds; ++round) {
+      auto* dst = (round % 2 == 0) ? matrix_steps_b.lbegin()
+                                   : matrix_steps_a.lbegin();
+      if(round % 2 == 0)
+        op_steps_a.update_steps(halo_steps_a, dst, num_steps, row_op);
+      else
+        op_steps_b.update_steps(halo_steps_b, dst, num_steps, row_op);
+      dash::Team::All().barrier();
+    }
+    auto& matrix_steps = (rounds % 2 == 0) ? matrix_steps_a
+                                           : matrix_steps_b;
+
+    // wavefront tiles, in-place update with pushed halo regions
+    HaloMatrixWrapper<Matrix_t> halo_push(matrix_push, HaloExchange::PUSH,
+                                          bound_spec, halo_spec);
+    auto op_push = halo_push.stencil_operator(stencil_spec);
+    for(int round = 0; round < rounds; ++round) {
+      op_push.update_steps(halo_push, matrix_push.lbegin(), num_steps,
+                           row_op, 2);
+    }
+    halo_push.wait();
+    dash::Team::All().barrier();
+
+    for(decltype(lsize) i = 0; i < lsize; ++i) {
+      EXPECT_EQ_U(matrix_ref.lbegin()[i], matrix_steps.lbegin()[i]);
+      EXPECT_EQ_U(matrix_ref.lbegin()[i], matrix_push.lbegin()[i]);
+    }
+
+    dash::Team::All().barrier();
+  }
+}
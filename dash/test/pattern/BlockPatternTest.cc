@@ -1203,3 +1203,45 @@ TEST_F(BlockPatternTest, UnderfilledPatternExtent1Dim)
 
   EXPECT_EQ_U(bextent, desired);
 }
+
+TEST_F(BlockPatternTest, IndexDivisors)
+{
+  DASH_TEST_LOCAL_ONLY();
+  // Divisors used for global-to-local index mapping must match integer
+  // division for power-of-two and other block sizes:
+  for (long divisor : { 1L, 2L, 3L, 7L, 16L, 100L, 1023L, 4096L,
+                        (1L << 31) + 1, (1L << 40) - 3 }) {
+    dash::math::FastDivisor<long> div(divisor);
+    EXPECT_EQ_U(divisor, div.divisor());
+    for (long n : { 0L, 1L, divisor - 1, divisor, divisor + 1,
+                    3 * divisor + 2, 123456789L, (1L << 62) + 12345 }) {
+      EXPECT_EQ_U(n / divisor, div.div(n));
+      EXPECT_EQ_U(n % divisor, div.mod(n));
+    }
+  }
+  for (int divisor : { 1, 5, 12, 64, 1000003 }) {
+    dash::math::FastDivisor<int> div(divisor);
+    for (int n : { 0, 17, 65535, 2147483647 }) {
+      EXPECT_EQ_U(n / divisor, div.div(n));
+      EXPECT_EQ_U(n % divisor, div.mod(n));
+    }
+  }
+  constexpr dash::math::StaticDivisor<long, 12> sdiv { };
+  static_assert(sdiv.div(100) == 8 && sdiv.mod(100) == 4,
+                "StaticDivisor must be evaluated at compile time");
+  EXPECT_EQ_U(dash::math::FastDivisor<long>(12).div(100),
+              static_cast<dash::math::FastDivisor<long>>(sdiv).div(100));
+
+  // Global-to-local mapping with block size not a power of two:
+  const int blocksize = 3;
+  const int extent    = 7 * blocksize * _dash_size + 2;
+  dash::Pattern<1> pattern(
+    dash::SizeSpec<1>(extent),
+    dash::DistributionSpec<1>(dash::BLOCKCYCLIC(blocksize)));
+  for (int g = 0; g < extent; ++g) {
+    auto l_pos = pattern.local(g);
+    EXPECT_EQ_U((g / blocksize) % _dash_size, l_pos.unit.id);
+    EXPECT_EQ_U((g / blocksize) / _dash_size * blocksize + g % blocksize,
+                l_pos.index);
+  }
+}
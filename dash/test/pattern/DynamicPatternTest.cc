@@ -0,0 +1,91 @@
+
+#include "DynamicPatternTest.h"
+
+#include <dash/pattern/DynamicPattern.h>
+#include <dash/memory/GlobHeapMem.h>
+
+#include <numeric>
+#include <vector>
+
+
+TEST_F(DynamicPatternTest, Balance)
+{
+  typedef dash::DynamicPattern<1>   pattern_t;
+  typedef pattern_t::size_type      size_type;
+
+  auto nunits = dash::size();
+  std::vector<size_type> local_sizes(nunits, 0);
+  local_sizes[0] = 10 * nunits + 3;
+
+  pattern_t pattern(local_sizes);
+  EXPECT_EQ_U(10 * nunits + 3, pattern.size());
+
+  // Every unit changes its own local size only:
+  pattern.local_resize(pattern.local_size() + dash::myid());
+  pattern.balance();
+
+  size_type total = 10 * nunits + 3 + (nunits - 1) * nunits / 2;
+  EXPECT_EQ_U(total, pattern.size());
+  size_type total_local = 0;
+  for (size_type u = 0; u < nunits; ++u) {
+    auto l_size = pattern.local_size(dash::team_unit_t(u));
+    EXPECT_GE_U(l_size, total / nunits);
+    EXPECT_LE_U(l_size, total / nunits + 1);
+    total_local += l_size;
+  }
+  EXPECT_EQ_U(total, total_local);
+
+  // Weighted distribution:
+  std::vector<double> weights(nunits);
+  std::iota(weights.begin(), weights.end(), 1.0);
+  pattern.balance(weights);
+  EXPECT_EQ_U(total, pattern.size());
+  for (size_type u = 1; u < nunits; ++u) {
+    EXPECT_GE_U(pattern.local_size(dash::team_unit_t(u)),
+                pattern.local_size(dash::team_unit_t(u - 1)));
+  }
+}
+
+TEST_F(DynamicPatternTest, BalanceGlobHeapMem)
+{
+  typedef dash::DynamicPattern<1>   pattern_t;
+  typedef pattern_t::size_type      size_type;
+  typedef int                       value_t;
+
+  auto nunits = dash::size();
+  auto myid   = dash::myid();
+
+  // Unbalanced initial distribution, unit u holds (u * 7 + 1) elements with
+  // the last unit holding most elements:
+  std::vector<size_type> local_sizes(nunits);
+  for (size_type u = 0; u < nunits; ++u) {
+    local_sizes[u] = u * 7 + 1;
+  }
+  local_sizes[nunits - 1] += 50;
+  auto g_offset = std::accumulate(local_sizes.begin(),
+                                  local_sizes.begin() + myid, 0);
+
+  pattern_t pattern(local_sizes);
+  dash::GlobHeapMem<value_t> gdmem(local_sizes[myid] / 2);
+  // Grow local memory in a second bucket:
+  gdmem.grow(local_sizes[myid] - local_sizes[myid] / 2);
+  auto lit = gdmem.lbegin();
+  for (size_type l = 0; l < local_sizes[myid]; ++l, ++lit) {
+    *lit = g_offset + l;
+  }
+
+  pattern.balance(gdmem);
+
+  auto total = pattern.size();
+  EXPECT_EQ_U(total, gdmem.size());
+  EXPECT_EQ_U(pattern.local_size(), gdmem.local_size());
+  EXPECT_LE_U(pattern.local_size(), total / nunits + 1);
+
+  // Global order of elements is preserved:
+  auto new_offset = pattern.lbegin();
+  lit = gdmem.lbegin();
+  for (size_type l = 0; l < gdmem.local_size(); ++l, ++lit) {
+    EXPECT_EQ_U(static_cast<value_t>(new_offset + l),
+                static_cast<value_t>(*lit));
+  }
+}
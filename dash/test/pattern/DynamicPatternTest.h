@@ -0,0 +1,12 @@
+#ifndef DASH__TEST__DYNAMIC_PATTERN_TEST_H_
+#define DASH__TEST__DYNAMIC_PATTERN_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for dash::DynamicPattern
+ */
+class DynamicPatternTest : public dash::test::TestBase {
+};
+
+#endif // DASH__TEST__DYNAMIC_PATTERN_TEST_H_
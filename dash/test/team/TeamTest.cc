@@ -7,7 +7,9 @@
 #include <dash/Dimensional.h>
 #include <dash/util/TeamLocality.h>
 
+#include <algorithm>
 #include <array>
+#include <vector>
 #include <sstream>
 #include <unistd.h>
 #include <iostream>
@@ -34,6 +36,64 @@ TEST_F(TeamTest, Deallocate) {
   // Array will be deallocated when going out of scope
 }
 
+TEST_F(TeamTest, BarrierAsync) {
+  auto & team = dash::Team::All();
+
+  auto fut_barrier = team.barrier_async();
+  while (!fut_barrier.test()) { }
+
+  // unwaited barrier is completed when the future goes out of scope
+  {
+    auto fut_scoped = team.barrier_async();
+  }
+  team.barrier_async().wait();
+}
+
+TEST_F(TeamTest, UnitIdTranslation)
+{
+  auto & team_all = dash::Team::All();
+  if (team_all.size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+
+  auto & team_split = team_all.split(2);
+  ASSERT_FALSE_U(team_split.is_null());
+
+  dart_group_t group;
+  ASSERT_EQ_U(DART_OK, dart_team_get_group(team_split.dart_id(), &group));
+  size_t group_size;
+  ASSERT_EQ_U(DART_OK, dart_group_size(group, &group_size));
+  ASSERT_EQ_U(team_split.size(), group_size);
+  std::vector<dart_global_unit_t> members(group_size);
+  ASSERT_EQ_U(DART_OK, dart_group_getmembers(group, members.data()));
+  ASSERT_EQ_U(DART_OK, dart_group_destroy(&group));
+
+  for (size_t l = 0; l < team_split.size(); ++l) {
+    dash::team_unit_t   luid(l);
+    dash::global_unit_t guid = team_split.global_id(luid);
+    EXPECT_EQ_U(members[l].id, guid.id);
+    EXPECT_EQ_U(luid, team_split.relative_id(guid));
+  }
+  // Units not contained in the team have no team-relative ID:
+  for (size_t g = 0; g < team_all.size(); ++g) {
+    dash::global_unit_t guid(g);
+    if (std::find_if(members.begin(), members.end(),
+                     [&](const dart_global_unit_t & m) {
+                       return m.id == guid.id;
+                     }) == members.end()) {
+      EXPECT_LT_U(team_split.relative_id(guid).id, 0);
+    }
+  }
+  // Invalid team-relative IDs are rejected:
+  dart_global_unit_t guid;
+  EXPECT_EQ_U(DART_ERR_INVAL,
+              dart_team_unit_l2g(team_split.dart_id(),
+                                 dash::team_unit_t(team_split.size()),
+                                 &guid));
+
+  team_all.barrier();
+}
+
 TEST_F(TeamTest, SplitTeamSync)
 {
   auto & team_all = dash::Team::All();
@@ -18,6 +18,8 @@
 #include <algorithm>
 #include <iostream>
 #include <iomanip>
+#include <cstdlib>
+#include <string>
 #include <sstream>
 #include <numeric>
 #include <thread>
@@ -737,3 +739,59 @@ TEST_F(AtomicTest, LongDouble){
   // array[0].compare_exchange(dash::size()*1.0, dash::myid()*1.0);
 
 }
+
+TEST_F(AtomicTest, SharedMemoryAtomics){
+  using value_t = int;
+  using atom_t  = dash::Atomic<value_t>;
+  using array_t = dash::Array<atom_t>;
+
+  // Use processor atomics for units on the same node, the setting is
+  // validated and agreed on by all units in dart_init:
+  const char * env_atomics = getenv("DART_SHMEM_ATOMICS");
+  std::string  prev_atomics(env_atomics != nullptr ? env_atomics : "");
+  dash::finalize();
+  setenv("DART_SHMEM_ATOMICS", "1", 1);
+  dash::init(&TESTENV::argc, &TESTENV::argv);
+  if (env_atomics != nullptr) {
+    setenv("DART_SHMEM_ATOMICS", prev_atomics.c_str(), 1);
+  } else {
+    unsetenv("DART_SHMEM_ATOMICS");
+  }
+
+  dart_config_t * dart_cfg;
+  dart_config(&dart_cfg);
+  if (!dart_cfg->shmem_atomics) {
+    SKIP_TEST_MSG("atomic operations in shared memory are not supported");
+  }
+
+  array_t counters(dash::size());
+  dash::Array<dash::Atomic<double>> sums(dash::size());
+  counters[dash::myid()].set(0);
+  sums[dash::myid()].set(0.0);
+  dash::barrier();
+
+  constexpr int num_iterations = 100;
+  for (int i = 0; i < num_iterations; ++i) {
+    for (size_t u = 0; u < dash::size(); ++u) {
+      counters[u].fetch_add(1);
+      counters[u].add(1);
+      sums[u].add(0.5);
+    }
+  }
+  // Every unit increments the counter at unit 0 with compare-and-swap:
+  value_t current;
+  do {
+    current = counters[0].load();
+  } while (!counters[0].compare_exchange(current, current + 1));
+  dash::barrier();
+
+  value_t expected = 2 * num_iterations * dash::size();
+  EXPECT_EQ_U(expected + static_cast<value_t>(dash::size()),
+              counters[0].load());
+  for (size_t u = 1; u < dash::size(); ++u) {
+    EXPECT_EQ_U(expected, counters[u].load());
+  }
+  EXPECT_EQ_U(0.5 * num_iterations * dash::size(), sums[dash::myid()].get());
+
+  dash::barrier();
+}
@@ -0,0 +1,81 @@
+
+#include "CommStatsTest.h"
+
+#include <dash/Array.h>
+#include <dash/Onesided.h>
+#include <dash/util/CommStats.h>
+
+
+TEST_F(CommStatsTest, GetPathsAndTargets)
+{
+  typedef int value_t;
+  const size_t block_size = 10;
+  dash::Array<value_t> array(dash::size() * block_size, dash::BLOCKED);
+  for (size_t l = 0; l < block_size; ++l) {
+    array.local[l] = dash::myid() * 1000 + l;
+  }
+  array.barrier();
+
+  dash::util::CommStats::reset();
+  dash::util::CommStats::enable();
+  ASSERT_TRUE_U(dash::util::CommStats::enabled());
+
+  dash::team_unit_t unit_src((dash::myid() + 1) % dash::size());
+  value_t local_copy[block_size];
+  dash::dart_storage<value_t> ds(block_size);
+  // Get from own block and from the block of the next unit:
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_blocking(
+      local_copy, (array.begin() + dash::myid() * block_size).dart_gptr(),
+      ds.nelem, ds.dtype, ds.dtype));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_blocking(
+      local_copy, (array.begin() + unit_src * block_size).dart_gptr(),
+      ds.nelem, ds.dtype, ds.dtype));
+
+  dash::util::CommStats::disable();
+  // Not recorded while disabled:
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_blocking(
+      local_copy, (array.begin() + unit_src * block_size).dart_gptr(),
+      ds.nelem, ds.dtype, ds.dtype));
+
+  dash::util::CommStats stats;
+  const auto & get_stats = stats[DART_STATS_GET_BLOCKING];
+  EXPECT_EQ_U(2, get_stats.calls);
+  EXPECT_EQ_U(2 * block_size * sizeof(value_t), get_stats.bytes);
+  EXPECT_EQ_U(2, get_stats.path_calls[DART_STATS_PATH_LOCAL]
+                 + get_stats.path_calls[DART_STATS_PATH_SHMEM]
+                 + get_stats.path_calls[DART_STATS_PATH_MPI]);
+  if (dash::size() > 1) {
+    EXPECT_EQ_U(1, get_stats.path_calls[DART_STATS_PATH_LOCAL]);
+    EXPECT_EQ_U(1, stats.target_calls()[unit_src]);
+  } else {
+    EXPECT_EQ_U(2, get_stats.path_calls[DART_STATS_PATH_LOCAL]);
+  }
+  EXPECT_EQ_U(0, stats[DART_STATS_PUT].calls);
+  EXPECT_EQ_U("get_blocking",
+              dash::util::CommStats::op_name(DART_STATS_GET_BLOCKING));
+
+  auto team_stats = stats.reduce(dash::Team::All());
+  EXPECT_EQ_U(dash::size(), team_stats.num_units());
+  EXPECT_EQ_U(2 * dash::size(),
+              team_stats[DART_STATS_GET_BLOCKING].calls);
+  EXPECT_EQ_U(2 * block_size * sizeof(value_t),
+              team_stats.max_bytes(DART_STATS_GET_BLOCKING));
+  // Every unit is target of its own get and the get of its predecessor:
+  for (size_t u = 0; u < dash::size(); ++u) {
+    EXPECT_EQ_U(2 * block_size * sizeof(value_t),
+                team_stats.target_bytes()[u]);
+  }
+
+  if (dash::myid() == 0) {
+    std::ostringstream os;
+    team_stats.dump(os);
+    EXPECT_NE_U(std::string::npos, os.str().find("get_blocking"));
+  }
+  dash::util::CommStats::reset();
+}
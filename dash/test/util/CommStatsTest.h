@@ -0,0 +1,12 @@
+#ifndef DASH__TEST__COMM_STATS_TEST_H_
+#define DASH__TEST__COMM_STATS_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for class dash::util::CommStats
+ */
+class CommStatsTest : public dash::test::TestBase {
+};
+
+#endif // DASH__TEST__COMM_STATS_TEST_H_
@@ -0,0 +1,97 @@
+#include "TraceTest.h"
+
+#include <dash/util/Config.h>
+#include <dash/util/Trace.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <thread>
+
+
+TEST_F(TraceTest, ChromeAndBinaryExport)
+{
+  using dash::util::Config;
+  using dash::util::TraceStore;
+
+  bool trace_enabled = Config::get<bool>("DASH_ENABLE_TRACE");
+  Config::set("DASH_ENABLE_TRACE", true);
+  ASSERT_TRUE_U(TraceStore::on());
+  TraceStore::clear();
+
+  dash::util::Trace trace("TraceTest");
+  for (int i = 0; i < 3; ++i) {
+    trace.enter_state("outer", i);
+    trace.enter_state("inner");
+    trace.exit_state("inner");
+    trace.event("marker", 12, 34);
+    trace.exit_state("outer");
+  }
+  TraceStore::off();
+
+  // Events are not recorded while tracing is disabled:
+  trace.enter_state("disabled");
+  trace.exit_state("disabled");
+
+  std::ostringstream json;
+  TraceStore::write_chrome_json(json);
+  std::string json_s = json.str();
+  DASH_LOG_TRACE("TraceTest.ChromeAndBinaryExport", json_s);
+  EXPECT_NE_U(std::string::npos, json_s.find("\"traceEvents\""));
+  EXPECT_NE_U(std::string::npos, json_s.find("\"name\":\"outer\""));
+  EXPECT_NE_U(std::string::npos, json_s.find("\"cat\":\"TraceTest\""));
+  EXPECT_NE_U(std::string::npos, json_s.find("\"payload\":[12,34]"));
+  EXPECT_EQ_U(std::string::npos, json_s.find("disabled"));
+
+  std::ostringstream csv;
+  TraceStore::write(csv, false);
+  std::string csv_s = csv.str();
+  // One line per completed state and instant event:
+  EXPECT_EQ_U(9, std::count(csv_s.begin(), csv_s.end(), '\n'));
+
+  std::ostringstream bin;
+  TraceStore::write_binary(bin);
+  std::string bin_s = bin.str();
+  EXPECT_EQ_U("DASHTRC1", bin_s.substr(0, 8));
+  // 3 iterations with 5 records each:
+  EXPECT_GE_U(bin_s.size(), 15 * sizeof(dash::util::trace_record_t));
+
+  TraceStore::clear();
+  Config::set("DASH_ENABLE_TRACE", trace_enabled);
+}
+
+TEST_F(TraceTest, RingBufferOverflow)
+{
+  using dash::util::Config;
+  using dash::util::TraceStore;
+
+  bool trace_enabled = Config::get<bool>("DASH_ENABLE_TRACE");
+  Config::set("DASH_ENABLE_TRACE", true);
+  Config::set("DASH_TRACE_BUFFER_SIZE", 8);
+  ASSERT_TRUE_U(TraceStore::on());
+  TraceStore::clear();
+
+  // Buffer capacity is applied to buffers of threads that record their
+  // first event:
+  std::thread tracer([]() {
+    dash::util::Trace trace("TraceTest");
+    for (int i = 0; i < 20; ++i) {
+      trace.event("overflow", i);
+    }
+  });
+  tracer.join();
+  TraceStore::off();
+
+  std::ostringstream json;
+  TraceStore::write_chrome_json(json);
+  std::string json_s = json.str();
+  DASH_LOG_TRACE("TraceTest.RingBufferOverflow", json_s);
+  // Only the most recent 8 records are retained:
+  EXPECT_EQ_U(std::string::npos, json_s.find("\"payload\":[11,0]"));
+  EXPECT_NE_U(std::string::npos, json_s.find("\"payload\":[12,0]"));
+  EXPECT_NE_U(std::string::npos, json_s.find("\"payload\":[19,0]"));
+
+  TraceStore::clear();
+  Config::set("DASH_TRACE_BUFFER_SIZE", 1 << 16);
+  Config::set("DASH_ENABLE_TRACE", trace_enabled);
+}
@@ -0,0 +1,12 @@
+#ifndef DASH__TEST__TRACE_TEST_H_
+#define DASH__TEST__TRACE_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for classes dash::util::Trace and dash::util::TraceStore
+ */
+class TraceTest : public dash::test::TestBase {
+};
+
+#endif // DASH__TEST__TRACE_TEST_H_